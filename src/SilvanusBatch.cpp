@@ -0,0 +1,259 @@
+//
+//  SilvanusPro
+//
+//  Created by Hobbyist Maker on 9/25/20.
+//  Copyright © 2020 HobbyistMaker. All rights reserved.
+//
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/filesystem.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "lib/generatebox/batch/BatchGenerator.hpp"
+#include "lib/generatebox/batch/ParameterSweep.hpp"
+#include "lib/generatebox/batch/replayDialogInputs.hpp"
+
+using namespace silvanus::generatebox::batch;
+using silvanus::generatebox::dialog::readDialogInputLogs;
+
+namespace {
+
+    void usage() {
+        std::cerr << "usage: SilvanusBatch [-o directory] [-j threads] [--dxf] [--gcode] [--snapshot] [--bom file] [--quote [--feed mm/min]] [--calls] [spec ...]\n"
+                  << "       SilvanusBatch --sweep name=from:to:step ... [-o directory] [-j threads] [spec]\n"
+                  << "       SilvanusBatch --replay log [--preview]\n"
+                  << "\n"
+                  << "Reads box specifications as CSV or JSON lines from each spec file, or from\n"
+                  << "standard input when none are given, and writes one flat pack per box plus a\n"
+                  << "bill of materials. --gcode also nests every box onto stock sheets and writes\n"
+                  << "its laser G-code. --snapshot also keeps a registry snapshot of every box;\n"
+                  << "snapshot files given as specs, ending in .silvanus, are drawn again without\n"
+                  << "configuring their boxes.\n"
+                  << "With --quote no files are drawn; each box gets one row with its estimated\n"
+                  << "cut length, sheet area and laser time instead. Lengths are in millimeters.\n"
+                  << "--calls renders every box against a recording Fusion backend and reports the\n"
+                  << "Fusion calls a direct model of it takes.\n"
+                  << "\n"
+                  << "--sweep runs every combination of the given ranges over the first box of\n"
+                  << "spec, or the dialog defaults without one, and writes the joint and material\n"
+                  << "metrics of each to sweep.csv. Ranges are in millimeters over length, width,\n"
+                  << "height, thickness, finger_width or kerf, and can be repeated.\n"
+                  << "\n"
+                  << "--replay runs a dialog input log, recorded by the add-in when\n"
+                  << "SILVANUS_DIALOG_LOG names a file, through the dialog systems and reports\n"
+                  << "latency percentiles per input. --preview adds the preview work to every event.\n";
+    }
+
+}
+
+int main(int argc, char** argv) {
+    auto options  = BatchOptions{};
+    auto bom_path = std::string{};
+    auto inputs   = std::vector<std::string>{};
+    auto replay   = std::string{};
+    auto preview  = false;
+    auto sweep    = std::vector<SweepRange>{};
+
+    for (auto i = 1; i < argc; ++i) {
+        auto const argument = std::string{argv[i]};
+        auto const has_value = i + 1 < argc;
+
+        if (argument == "-o" && has_value) {
+            options.output_directory = argv[++i];
+        } else if (argument == "-j" && has_value) {
+            options.threads = std::stoul(argv[++i]);
+        } else if (argument == "--bom" && has_value) {
+            bom_path = argv[++i];
+        } else if (argument == "--dxf") {
+            options.extension = ".dxf";
+        } else if (argument == "--gcode") {
+            options.gcode = true;
+        } else if (argument == "--snapshot") {
+            options.snapshot = true;
+        } else if (argument == "--quote") {
+            options.quote = true;
+        } else if (argument == "--feed" && has_value) {
+            options.machine.cut_feed = std::stod(argv[++i]);
+        } else if (argument == "--calls") {
+            options.fusion_calls = true;
+        } else if (argument == "--sweep" && has_value) {
+            try {
+                sweep.push_back(parseSweepRange(argv[++i]));
+            } catch (const std::invalid_argument& error) {
+                std::cerr << error.what() << "\n";
+                return 2;
+            }
+        } else if (argument == "--replay" && has_value) {
+            replay = argv[++i];
+        } else if (argument == "--preview") {
+            preview = true;
+        } else if (argument == "-h" || argument == "--help") {
+            usage();
+            return 0;
+        } else if (!argument.empty() && argument.front() == '-' && argument != "-") {
+            usage();
+            return 2;
+        } else {
+            inputs.push_back(argument);
+        }
+    }
+
+    if (!replay.empty()) {
+        auto file = std::ifstream{replay};
+        if (!file) {
+            std::cerr << "could not open " << replay << "\n";
+            return 1;
+        }
+
+        try {
+            auto const report = replayDialogInputs(readDialogInputLogs(file), preview);
+            writeReplayReport(report, std::cout);
+            return report.failed > 0 ? 1 : 0;
+        } catch (const std::exception& error) {
+            std::cerr << replay << ": " << error.what() << "\n";
+            return 1;
+        }
+    }
+
+    if (!sweep.empty()) {
+        if (inputs.size() > 1) {
+            usage();
+            return 2;
+        }
+
+        auto base = BoxSpecification{};
+        if (!inputs.empty()) {
+            auto file = std::ifstream{};
+            if (inputs.front() != "-") {
+                file.open(inputs.front());
+                if (!file) {
+                    std::cerr << "could not open " << inputs.front() << "\n";
+                    return 1;
+                }
+            }
+
+            try {
+                auto reader = BoxSpecificationReader(inputs.front() == "-" ? std::cin : file);
+                if (!reader.next(base)) {
+                    std::cerr << inputs.front() << ": no box specification\n";
+                    return 1;
+                }
+            } catch (const std::exception& error) {
+                std::cerr << inputs.front() << ": " << error.what() << "\n";
+                return 1;
+            }
+        }
+
+        auto const sweep_path = options.output_directory + "/sweep.csv";
+        auto output = std::ofstream{};
+        try {
+            boost::filesystem::create_directories(options.output_directory);
+            output.open(sweep_path);
+        } catch (const std::exception& error) {
+            std::cerr << error.what() << "\n";
+            return 1;
+        }
+        if (!output) {
+            std::cerr << "could not open " << sweep_path << "\n";
+            return 1;
+        }
+
+        auto const results = sweepParameters(base, sweep, options.threads);
+        writeSweepCsv(results, output);
+
+        auto const failed = std::count(results.failed.begin(), results.failed.end(), 1);
+        std::cout << fmt::format("{} points, {} failed\n", results.points, failed);
+        return failed > 0 ? 1 : 0;
+    }
+
+    auto snapshots = std::vector<std::string>{};
+    auto const is_snapshot = [](const std::string& input) { return boost::algorithm::iends_with(input, ".silvanus"); };
+    std::copy_if(inputs.begin(), inputs.end(), std::back_inserter(snapshots), is_snapshot);
+    inputs.erase(std::remove_if(inputs.begin(), inputs.end(), is_snapshot), inputs.end());
+
+    if (!snapshots.empty() && (options.quote || options.fusion_calls)) {
+        std::cerr << "--quote and --calls need box specifications, not snapshots\n";
+        return 2;
+    }
+
+    if (bom_path.empty()) bom_path = options.output_directory + (options.quote ? "/quote.csv" : "/bom.csv");
+    if (inputs.empty() && snapshots.empty()) inputs.emplace_back("-");
+
+    auto bom = std::ofstream{};
+    try {
+        boost::filesystem::create_directories(options.output_directory);
+        bom.open(bom_path);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << "\n";
+        return 1;
+    }
+    if (!bom) {
+        std::cerr << "could not open " << bom_path << "\n";
+        return 1;
+    }
+    writeBomHeader(bom, options);
+
+    auto total = BatchSummary{};
+
+    for (auto const& input: inputs) {
+        auto file = std::ifstream{};
+        if (input != "-") {
+            file.open(input);
+            if (!file) {
+                std::cerr << "could not open " << input << "\n";
+                return 1;
+            }
+        }
+
+        auto reader  = BoxSpecificationReader(input == "-" ? std::cin : file);
+        auto summary = BatchSummary{};
+
+        try {
+            summary = generateBatch(reader, bom, options);
+        } catch (const std::exception& error) {
+            std::cerr << input << ": " << error.what() << "\n";
+            return 1;
+        }
+
+        for (auto const& error: summary.errors) {
+            std::cerr << input << ": " << error << "\n";
+        }
+
+        total.boxes        += summary.boxes;
+        total.panels       += summary.panels;
+        total.failed       += summary.failed;
+        total.fusion_calls += summary.fusion_calls;
+        total.seconds      += summary.seconds;
+    }
+
+    if (!snapshots.empty()) {
+        auto const summary = generateSnapshots(snapshots, bom, options);
+
+        for (auto const& error: summary.errors) {
+            std::cerr << error << "\n";
+        }
+
+        total.boxes   += summary.boxes;
+        total.panels  += summary.panels;
+        total.failed  += summary.failed;
+        total.seconds += summary.seconds;
+    }
+
+    std::cout << fmt::format(
+        "{} boxes, {} panels, {} failed in {:.2f}s ({:.1f} boxes/s)\n",
+        total.boxes, total.panels, total.failed, total.seconds, total.boxesPerSecond()
+    );
+
+    if (options.fusion_calls) {
+        std::cout << fmt::format("{} Fusion calls ({:.1f} per box)\n", total.fusion_calls, total.fusionCallsPerBox());
+    }
+
+    return total.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,115 @@
+//
+//  SilvanusPro
+//
+//  Created by Hobbyist Maker on 9/23/20.
+//  Copyright © 2020 HobbyistMaker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_THREADPOOL_HPP
+#define SILVANUSPRO_THREADPOOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace silvanus::common {
+
+    class ThreadPool
+    {
+        std::vector<std::thread>          m_workers;
+        std::queue<std::function<void()>> m_tasks;
+        std::mutex                        m_mutex;
+        std::condition_variable           m_ready;
+        bool                              m_stopping = false;
+
+        void work() {
+            while (true) {
+                auto task = std::function<void()>{};
+                {
+                    auto lock = std::unique_lock<std::mutex>{m_mutex};
+                    m_ready.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+                    if (m_stopping && m_tasks.empty()) return;
+
+                    task = std::move(m_tasks.front());
+                    m_tasks.pop();
+                }
+                task();
+            }
+        }
+
+    public:
+        explicit ThreadPool(size_t threads = 0) {
+            if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+            m_workers.reserve(threads);
+            for (size_t i = 0; i < threads; ++i) {
+                m_workers.emplace_back([this] { work(); });
+            }
+        };
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool() {
+            {
+                auto lock = std::lock_guard<std::mutex>{m_mutex};
+                m_stopping = true;
+            }
+            m_ready.notify_all();
+
+            for (auto& worker: m_workers) {
+                worker.join();
+            }
+        };
+
+        [[nodiscard]] auto size() const -> size_t { return m_workers.size(); };
+
+        template<class F>
+        auto submit(F&& function) -> std::future<decltype(function())> {
+            using result_type = decltype(function());
+
+            auto task   = std::make_shared<std::packaged_task<result_type()>>(std::forward<F>(function));
+            auto result = task->get_future();
+            {
+                auto lock = std::lock_guard<std::mutex>{m_mutex};
+                m_tasks.emplace([task] { (*task)(); });
+            }
+            m_ready.notify_one();
+
+            return result;
+        };
+
+        // Calls function(index) for every index in [0, count) across the pool and
+        // blocks until all of them have finished. Indices are handed out one at a
+        // time, so uneven work still balances across the workers.
+        template<class F>
+        void parallelFor(size_t count, F&& function) {
+            auto next    = std::make_shared<std::atomic<size_t>>(0);
+            auto workers = std::min(count, size());
+            auto pending = std::vector<std::future<void>>{};
+            pending.reserve(workers);
+
+            for (size_t i = 0; i < workers; ++i) {
+                pending.emplace_back(submit([next, count, &function] {
+                    for (auto index = (*next)++; index < count; index = (*next)++) {
+                        function(index);
+                    }
+                }));
+            }
+
+            for (auto& result: pending) {
+                result.get();
+            }
+        };
+    };
+
+}
+
+#endif /* silvanuspro_threadpool_hpp */
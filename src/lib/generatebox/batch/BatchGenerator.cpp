@@ -0,0 +1,314 @@
+//
+// Created by Hobbyist Maker on 9/25/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "BatchGenerator.hpp"
+#include "initializePanelsFromSpecification.hpp"
+
+#include "common/threadpool.hpp"
+#include "render/flatpack/DxfWriter.hpp"
+#include "render/flatpack/exportFlatPack.hpp"
+#include "render/flatpack/SvgWriter.hpp"
+#include "render/gcode/exportGCode.hpp"
+#include "render/geometry/collectPanelGeometry.hpp"
+#include "render/geometry/PanelOutline.hpp"
+#include "render/presentation/countFusionCalls.hpp"
+#include "render/snapshot/RegistrySnapshot.hpp"
+#include "render/systems/ConfigureJoints.hpp"
+#include "render/systems/ConfigurePanels.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+#include <fmt/format.h>
+
+#include <cctype>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <stdexcept>
+
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::estimate;
+using namespace silvanus::generatebox::flatpack;
+using namespace silvanus::generatebox::gcode;
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::render;
+using namespace silvanus::generatebox::snapshot;
+
+namespace {
+
+    struct PanelRecord {
+        std::string name;
+        AxisFlag    orientation;
+        double      length;
+        double      width;
+        double      thickness;
+        double      area;
+        double      cut_length;
+        size_t      cuts;
+    };
+
+    struct BoxRecord {
+        std::string              name;
+        std::vector<PanelRecord> panels;
+        std::string              error;
+        BoxMetrics               metrics;
+        size_t                   fusion_calls = 0;
+    };
+
+    auto fileName(const std::string& name) -> std::string {
+        auto result = name;
+        for (auto& character: result) {
+            auto const allowed = std::isalnum(static_cast<unsigned char>(character)) || character == '-' || character == '_' || character == '.';
+            if (!allowed) character = '_';
+        }
+        return result.empty() ? "box" : result;
+    }
+
+    auto orientationName(AxisFlag orientation) -> const char* {
+        switch (orientation) {
+            case AxisFlag::Length:
+                return "length";
+            case AxisFlag::Width:
+                return "width";
+            default:
+                return "height";
+        }
+    }
+
+    auto csvField(const std::string& text) -> std::string {
+        if (text.find_first_of(",\"\n") == std::string::npos) return text;
+        return "\"" + boost::algorithm::replace_all_copy(text, "\"", "\"\"") + "\"";
+    }
+
+    // Writes the flat pack of a box, and its G-code when asked, and fills in
+    // its bill of material rows.
+    void writePanels(BoxRecord& record, const boost::filesystem::path& base, const std::vector<PanelGeometry>& panels, const BatchOptions& options) {
+        auto const layout = layoutFlatPack(panels, {});
+
+        auto const path = base.string() + options.extension;
+        auto stream = std::ofstream(path);
+        if (!stream) throw std::runtime_error("could not open " + path);
+
+        auto writer = std::unique_ptr<FlatPackWriter>{};
+        if (boost::algorithm::iequals(options.extension, ".dxf")) {
+            writer = std::make_unique<DxfWriter>(stream);
+        } else {
+            writer = std::make_unique<SvgWriter>(stream);
+        }
+
+        auto outliner = PanelOutliner{};
+        auto outline  = PanelOutline{};
+
+        record.panels.reserve(panels.size());
+        writer->begin(layout.width, layout.height);
+        for (auto const& placement: layout.placements) {
+            auto const& panel = panels[placement.panel];
+            outliner.build(panel, outline);
+            writer->panel(panel.name, outline, placement.x, placement.y);
+
+            record.panels.push_back({
+                panel.name, panel.orientation, panel.length, panel.width, panel.thickness,
+                outlineArea(outline), outlineLength(outline), panel.cuts.size()
+            });
+        }
+        writer->end();
+
+        if (!stream) throw std::runtime_error("could not write " + path);
+
+        if (options.gcode) {
+            auto const gcode_path = base.string() + ".nc";
+            auto gcode = std::ofstream(gcode_path);
+            writeGCode(panels, gcode);
+            if (!gcode) throw std::runtime_error("could not write " + gcode_path);
+        }
+    }
+
+    auto buildBox(const BoxSpecification& specification, const BatchOptions& options) -> BoxRecord {
+        auto record = BoxRecord{specification.name, {}, {}, {}, 0};
+
+        auto registry = entt::registry{};
+        configureBox(specification, registry);
+
+        if (options.fusion_calls) {
+            record.fusion_calls = countFusionCalls(registry);
+        }
+
+        if (options.quote) {
+            record.metrics = estimateBoxMetrics(registry, options.machine);
+            return record;
+        }
+
+        auto const base = boost::filesystem::path(options.output_directory) / fileName(specification.name);
+
+        if (options.snapshot) {
+            auto const snapshot_path = base.string() + ".silvanus";
+            auto snapshot = std::ofstream(snapshot_path, std::ios::out | std::ios::trunc | std::ios::binary);
+            writeSnapshot(registry, snapshot);
+            if (!snapshot) throw std::runtime_error("could not write " + snapshot_path);
+        }
+
+        writePanels(record, base, collectPanelGeometry(registry), options);
+        return record;
+    }
+
+    // Loads a snapshot an earlier batch wrote and draws it like a configured box.
+    auto loadBox(const std::string& filename, const BatchOptions& options) -> BoxRecord {
+        auto const name = boost::filesystem::path(filename).stem().string();
+        auto record     = BoxRecord{name, {}, {}, {}, 0};
+
+        auto const file = SnapshotFile(filename);
+        writePanels(record, boost::filesystem::path(options.output_directory) / fileName(name), snapshotPanelGeometry(file.view()), options);
+        return record;
+    }
+
+    void writeRecord(std::ostream& bom, const BoxRecord& record, const BatchOptions& options) {
+        if (options.quote) {
+            auto const& metrics = record.metrics;
+            bom << fmt::format(
+                "{},{},{},{:.2f},{:.2f},{:.2f},{:.2f},{:.1f}",
+                csvField(record.name), metrics.panels, metrics.contours,
+                metrics.cut_length * 10, metrics.toolpath_length * 10,
+                metrics.sheet_area * 100, metrics.material_area * 100, metrics.laser_time
+            );
+            if (options.fusion_calls) bom << "," << record.fusion_calls;
+            bom << "\n";
+            return;
+        }
+
+        for (auto const& panel: record.panels) {
+            bom << fmt::format(
+                "{},{},{},{:.3f},{:.3f},{:.3f},{:.2f},{:.2f},{}\n",
+                csvField(record.name), csvField(panel.name), orientationName(panel.orientation),
+                panel.length * 10, panel.width * 10, panel.thickness * 10,
+                panel.area * 100, panel.cut_length * 10, panel.cuts
+            );
+        }
+    }
+
+    void addRecord(BatchSummary& summary, std::ostream& bom, const BoxRecord& record, const BatchOptions& options) {
+        if (!record.error.empty()) {
+            ++summary.failed;
+            summary.errors.push_back(record.name + ": " + record.error);
+            return;
+        }
+
+        writeRecord(bom, record, options);
+        ++summary.boxes;
+        summary.fusion_calls += record.fusion_calls;
+        summary.panels += options.quote ? record.metrics.panels : record.panels.size();
+    }
+
+}
+
+void silvanus::generatebox::batch::configureBox(const BoxSpecification& specification, entt::registry& registry) {
+    initializePanelsFromSpecification(specification, registry);
+    systems::ConfigurePanels(registry).execute();
+    systems::ConfigureJoints(registry).execute();
+}
+
+auto silvanus::generatebox::batch::generateBox(const BoxSpecification& specification) -> std::vector<PanelGeometry> {
+    auto registry = entt::registry{};
+    configureBox(specification, registry);
+
+    return collectPanelGeometry(registry);
+}
+
+auto silvanus::generatebox::batch::estimateBox(const BoxSpecification& specification, const estimate::MachineProfile& machine) -> BoxMetrics {
+    auto registry = entt::registry{};
+    configureBox(specification, registry);
+
+    return estimateBoxMetrics(registry, machine);
+}
+
+void silvanus::generatebox::batch::writeBomHeader(std::ostream& bom, const BatchOptions& options) {
+    if (options.quote) {
+        bom << "box,panels,contours,cut_length_mm,toolpath_length_mm,sheet_area_mm2,material_area_mm2,laser_time_s";
+        bom << (options.fusion_calls ? ",fusion_calls\n" : "\n");
+        return;
+    }
+
+    bom << "box,panel,orientation,length_mm,width_mm,thickness_mm,area_mm2,cut_length_mm,cuts\n";
+}
+
+auto silvanus::generatebox::batch::generateBatch(BoxSpecificationReader& reader, std::ostream& bom, const BatchOptions& options) -> BatchSummary {
+    auto summary = BatchSummary{};
+    auto const start = std::chrono::steady_clock::now();
+
+    if (!options.quote) boost::filesystem::create_directories(options.output_directory);
+
+    auto pool  = common::ThreadPool{options.threads};
+    auto depth = options.queue_depth > 0 ? options.queue_depth : pool.size() * 4;
+
+    auto in_flight = std::deque<std::future<BoxRecord>>{};
+
+    auto const finish = [&]() {
+        addRecord(summary, bom, in_flight.front().get(), options);
+        in_flight.pop_front();
+    };
+
+    while (true) {
+        auto specification = BoxSpecification{};
+        try {
+            if (!reader.next(specification)) break;
+        } catch (const std::runtime_error& error) {
+            ++summary.failed;
+            summary.errors.emplace_back(error.what());
+            continue;
+        }
+
+        in_flight.push_back(pool.submit([specification = std::move(specification), &options]() {
+            try {
+                return buildBox(specification, options);
+            } catch (const std::exception& error) {
+                return BoxRecord{specification.name, {}, error.what(), {}, 0};
+            }
+        }));
+
+        if (in_flight.size() >= depth) finish();
+    }
+
+    while (!in_flight.empty()) finish();
+    bom.flush();
+
+    summary.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return summary;
+}
+
+auto silvanus::generatebox::batch::generateSnapshots(
+    const std::vector<std::string>& filenames, std::ostream& bom, const BatchOptions& options
+) -> BatchSummary {
+    if (options.quote || options.fusion_calls) {
+        throw std::invalid_argument("snapshots can not be quoted or rendered, only drawn");
+    }
+
+    auto summary = BatchSummary{};
+    auto const start = std::chrono::steady_clock::now();
+
+    boost::filesystem::create_directories(options.output_directory);
+
+    auto pool    = common::ThreadPool{options.threads};
+    auto records = std::vector<std::future<BoxRecord>>{};
+    records.reserve(filenames.size());
+
+    for (auto const& filename: filenames) {
+        records.push_back(pool.submit([&filename, &options]() {
+            try {
+                return loadBox(filename, options);
+            } catch (const std::exception& error) {
+                return BoxRecord{filename, {}, error.what(), {}, 0};
+            }
+        }));
+    }
+
+    for (auto& record: records) {
+        addRecord(summary, bom, record.get(), options);
+    }
+    bom.flush();
+
+    summary.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return summary;
+}
@@ -0,0 +1,93 @@
+//
+// Created by Hobbyist Maker on 9/25/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_BATCHGENERATOR_HPP
+#define SILVANUSPRO_BATCHGENERATOR_HPP
+
+#include "BoxSpecification.hpp"
+#include "BoxSpecificationReader.hpp"
+#include "render/estimate/estimateBoxMetrics.hpp"
+#include "render/geometry/PanelGeometry.hpp"
+
+#include <entt/entt.hpp>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace silvanus::generatebox::batch {
+
+    struct BatchOptions {
+        std::string output_directory = ".";
+        std::string extension        = ".svg";
+        size_t      threads          = 0;
+
+        // Boxes allowed in flight at once. Zero keeps four per thread, enough to
+        // hide uneven boxes without reading the whole specification stream ahead.
+        size_t queue_depth = 0;
+
+        // Also writes a registry snapshot of every box next to its flat pack.
+        bool snapshot = false;
+
+        // Also nests every box onto stock sheets and writes its laser G-code
+        // next to its flat pack.
+        bool gcode = false;
+
+        // Quote mode skips the flat packs and writes one estimate row per box.
+        bool                     quote = false;
+        estimate::MachineProfile machine;
+
+        // Also renders every box with the direct renderer against a recording
+        // backend and counts the Fusion calls it takes.
+        bool fusion_calls = false;
+    };
+
+    struct BatchSummary {
+        size_t                   boxes        = 0;
+        size_t                   panels       = 0;
+        size_t                   failed       = 0;
+        size_t                   fusion_calls = 0;
+        double                   seconds      = 0;
+        std::vector<std::string> errors;
+
+        [[nodiscard]] auto boxesPerSecond() const -> double {
+            return seconds > 0 ? static_cast<double>(boxes) / seconds : 0;
+        };
+
+        [[nodiscard]] auto fusionCallsPerBox() const -> double {
+            return boxes > 0 ? static_cast<double>(fusion_calls) / static_cast<double>(boxes) : 0;
+        };
+    };
+
+    // Runs one specification through the same systems the add-in runs when the
+    // dialog is accepted, leaving the configured panels and joints in registry.
+    void configureBox(const BoxSpecification& specification, entt::registry& registry);
+
+    // Configures a box in a scratch registry and returns the finished panels.
+    auto generateBox(const BoxSpecification& specification) -> std::vector<geometry::PanelGeometry>;
+
+    // Configures a box in a scratch registry and estimates it without tracing
+    // any outlines.
+    auto estimateBox(const BoxSpecification& specification, const estimate::MachineProfile& machine = {}) -> estimate::BoxMetrics;
+
+    // Column names for the rows generateBatch writes, lengths in millimeters.
+    void writeBomHeader(std::ostream& bom, const BatchOptions& options);
+
+    // Generates every specification the reader yields across a thread pool. Each
+    // box is written to its own flat pack file in the output directory as soon as
+    // it is done; bill of material rows are streamed to bom in input order,
+    // without a header so several batches can share one file. Boxes that fail
+    // are counted and reported in the summary without stopping the rest.
+    auto generateBatch(BoxSpecificationReader& reader, std::ostream& bom, const BatchOptions& options) -> BatchSummary;
+
+    // Draws registry snapshots written by an earlier batch with --snapshot the
+    // same way, without configuring the boxes again; each box is named after
+    // its file. Quote mode and Fusion call counts need the configured registry,
+    // so they throw std::invalid_argument here.
+    auto generateSnapshots(const std::vector<std::string>& filenames, std::ostream& bom, const BatchOptions& options) -> BatchSummary;
+
+}
+
+#endif //SILVANUSPRO_BATCHGENERATOR_HPP
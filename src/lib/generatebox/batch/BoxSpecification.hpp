@@ -0,0 +1,73 @@
+//
+// Created by Hobbyist Maker on 9/25/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_BOXSPECIFICATION_HPP
+#define SILVANUSPRO_BOXSPECIFICATION_HPP
+
+#include "entities/FingerPattern.hpp"
+#include "entities/JointDirection.hpp"
+#include "entities/JointPattern.hpp"
+
+#include <optional>
+#include <string>
+
+namespace silvanus::generatebox::batch {
+
+    using entities::FingerPatternType;
+    using entities::JointDirectionType;
+    using entities::JointPatternType;
+
+    struct PanelSpecification {
+        bool                  enabled = true;
+        std::optional<double> thickness;
+    };
+
+    // Dividers along one axis. The two patterns follow the divider inputs of the
+    // dialog: front/back then top/bottom for length dividers, left/right then
+    // top/bottom for width dividers and front/back then left/right for height
+    // dividers.
+    struct DividerSpecification {
+        int              count  = 0;
+        JointPatternType first  = JointPatternType::BoxJoint;
+        JointPatternType second = JointPatternType::BoxJoint;
+    };
+
+    // Everything the dialog asks for, as plain values. Lengths are in Fusion's
+    // internal centimeters and the defaults are the dialog's metric defaults.
+    struct BoxSpecification {
+        std::string name = "box";
+
+        double length       = 28.5;
+        double width        = 14.25;
+        double height       = 4.0;
+        double thickness    = 0.32;
+        double finger_width = 0.96;
+        double kerf         = 0.0;
+
+        FingerPatternType  finger_mode     = FingerPatternType::AutomaticWidth;
+        JointPatternType   joint_pattern   = JointPatternType::BoxJoint;
+        JointDirectionType joint_direction = JointDirectionType::Normal;
+
+        PanelSpecification top{false, std::nullopt};
+        PanelSpecification bottom;
+        PanelSpecification left;
+        PanelSpecification right;
+        PanelSpecification front;
+        PanelSpecification back;
+
+        bool y_up = true;
+
+        // 0: length & width, 1: length & height, 2: width & height.
+        int  divider_orientations = 0;
+        bool divider_inverse      = false;
+
+        DividerSpecification length_dividers;
+        DividerSpecification width_dividers;
+        DividerSpecification height_dividers;
+    };
+
+}
+
+#endif //SILVANUSPRO_BOXSPECIFICATION_HPP
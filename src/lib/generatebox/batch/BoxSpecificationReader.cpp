@@ -0,0 +1,294 @@
+//
+// Created by Hobbyist Maker on 9/25/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "BoxSpecificationReader.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace silvanus::generatebox::batch;
+
+namespace {
+
+    using FieldSetter = std::function<void(BoxSpecification&, const std::string&)>;
+
+    auto invalid(const std::string& field, const std::string& value) -> std::invalid_argument {
+        return std::invalid_argument("invalid " + field + " '" + value + "'");
+    }
+
+    auto parseNumber(const std::string& field, const std::string& value) -> double {
+        auto consumed = size_t{0};
+        auto result   = 0.0;
+        try {
+            result = std::stod(value, &consumed);
+        } catch (const std::exception&) {
+            throw invalid(field, value);
+        }
+        if (consumed != value.size()) throw invalid(field, value);
+        return result;
+    }
+
+    // Specifications are written in millimeters, the registry works in centimeters.
+    auto parseLength(const std::string& field, const std::string& value) -> double {
+        auto const result = parseNumber(field, value);
+        if (result < 0) throw invalid(field, value);
+        return result / 10;
+    }
+
+    auto parseCount(const std::string& field, const std::string& value) -> int {
+        auto const result = parseNumber(field, value);
+        if (result < 0 || result != static_cast<int>(result)) throw invalid(field, value);
+        return static_cast<int>(result);
+    }
+
+    auto parseBool(const std::string& field, const std::string& value) -> bool {
+        auto const lowered = boost::algorithm::to_lower_copy(value);
+        if (lowered == "true" || lowered == "yes" || lowered == "1") return true;
+        if (lowered == "false" || lowered == "no" || lowered == "0") return false;
+        throw invalid(field, value);
+    }
+
+    template<class T>
+    auto parseChoice(const std::string& field, const std::string& value, const std::unordered_map<std::string, T>& choices) -> T {
+        auto const found = choices.find(boost::algorithm::to_lower_copy(value));
+        if (found == choices.end()) throw invalid(field, value);
+        return found->second;
+    }
+
+    auto parseFingerMode(const std::string& field, const std::string& value) -> FingerPatternType {
+        static auto const choices = std::unordered_map<std::string, FingerPatternType>{
+            {"automatic", FingerPatternType::AutomaticWidth},
+            {"constant", FingerPatternType::ConstantWidth},
+            {"count", FingerPatternType::ConstantCount},
+            {"none", FingerPatternType::None}
+        };
+        return parseChoice(field, value, choices);
+    }
+
+    auto parseJointPattern(const std::string& field, const std::string& value) -> JointPatternType {
+        static auto const choices = std::unordered_map<std::string, JointPatternType>{
+            {"box", JointPatternType::BoxJoint},
+            {"lap", JointPatternType::LapJoint},
+            {"tenon", JointPatternType::Tenon},
+            {"double_tenon", JointPatternType::DoubleTenon},
+            {"triple_tenon", JointPatternType::TripleTenon},
+            {"quad_tenon", JointPatternType::QuadTenon},
+            {"trim", JointPatternType::Trim},
+            {"none", JointPatternType::None}
+        };
+        return parseChoice(field, value, choices);
+    }
+
+    auto parseDirection(const std::string& field, const std::string& value) -> bool {
+        static auto const choices = std::unordered_map<std::string, bool>{
+            {"normal", false},
+            {"inverse", true}
+        };
+        return parseChoice(field, value, choices);
+    }
+
+    auto parseOrientations(const std::string& field, const std::string& value) -> int {
+        static auto const choices = std::unordered_map<std::string, int>{
+            {"length_width", 0},
+            {"length_height", 1},
+            {"width_height", 2}
+        };
+        return parseChoice(field, value, choices);
+    }
+
+    auto panelSetters(const std::string& name, PanelSpecification BoxSpecification::* panel) -> std::vector<std::pair<std::string, FieldSetter>> {
+        return {
+            {name, [name, panel](BoxSpecification& spec, const std::string& value) {
+                (spec.*panel).enabled = parseBool(name, value);
+            }},
+            {name + "_thickness", [name, panel](BoxSpecification& spec, const std::string& value) {
+                (spec.*panel).thickness = parseLength(name + "_thickness", value);
+            }}
+        };
+    }
+
+    auto dividerSetters(
+        const std::string& name, DividerSpecification BoxSpecification::* dividers, const std::string& first, const std::string& second
+    ) -> std::vector<std::pair<std::string, FieldSetter>> {
+        auto const prefix = name + "_divider_";
+        return {
+            {name + "_dividers", [name, dividers](BoxSpecification& spec, const std::string& value) {
+                (spec.*dividers).count = parseCount(name + "_dividers", value);
+            }},
+            {prefix + first + "_joint", [field = prefix + first + "_joint", dividers](BoxSpecification& spec, const std::string& value) {
+                (spec.*dividers).first = parseJointPattern(field, value);
+            }},
+            {prefix + second + "_joint", [field = prefix + second + "_joint", dividers](BoxSpecification& spec, const std::string& value) {
+                (spec.*dividers).second = parseJointPattern(field, value);
+            }}
+        };
+    }
+
+    auto fieldSetters() -> std::unordered_map<std::string, FieldSetter> {
+        auto setters = std::unordered_map<std::string, FieldSetter>{
+            {"name", [](BoxSpecification& spec, const std::string& value) { spec.name = value; }},
+            {"length", [](BoxSpecification& spec, const std::string& value) { spec.length = parseLength("length", value); }},
+            {"width", [](BoxSpecification& spec, const std::string& value) { spec.width = parseLength("width", value); }},
+            {"height", [](BoxSpecification& spec, const std::string& value) { spec.height = parseLength("height", value); }},
+            {"thickness", [](BoxSpecification& spec, const std::string& value) { spec.thickness = parseLength("thickness", value); }},
+            {"finger_width", [](BoxSpecification& spec, const std::string& value) { spec.finger_width = parseLength("finger_width", value); }},
+            {"kerf", [](BoxSpecification& spec, const std::string& value) { spec.kerf = parseLength("kerf", value); }},
+            {"finger_mode", [](BoxSpecification& spec, const std::string& value) { spec.finger_mode = parseFingerMode("finger_mode", value); }},
+            {"joint_pattern", [](BoxSpecification& spec, const std::string& value) { spec.joint_pattern = parseJointPattern("joint_pattern", value); }},
+            {"joint_direction", [](BoxSpecification& spec, const std::string& value) {
+                spec.joint_direction = static_cast<JointDirectionType>(parseDirection("joint_direction", value));
+            }},
+            {"y_up", [](BoxSpecification& spec, const std::string& value) { spec.y_up = parseBool("y_up", value); }},
+            {"divider_orientations", [](BoxSpecification& spec, const std::string& value) {
+                spec.divider_orientations = parseOrientations("divider_orientations", value);
+            }},
+            {"divider_joint", [](BoxSpecification& spec, const std::string& value) { spec.divider_inverse = parseDirection("divider_joint", value); }}
+        };
+
+        auto const add = [&setters](const std::vector<std::pair<std::string, FieldSetter>>& more) {
+            setters.insert(more.begin(), more.end());
+        };
+
+        add(panelSetters("top", &BoxSpecification::top));
+        add(panelSetters("bottom", &BoxSpecification::bottom));
+        add(panelSetters("left", &BoxSpecification::left));
+        add(panelSetters("right", &BoxSpecification::right));
+        add(panelSetters("front", &BoxSpecification::front));
+        add(panelSetters("back", &BoxSpecification::back));
+
+        add(dividerSetters("length", &BoxSpecification::length_dividers, "fb", "tb"));
+        add(dividerSetters("width", &BoxSpecification::width_dividers, "lr", "tb"));
+        add(dividerSetters("height", &BoxSpecification::height_dividers, "fb", "lr"));
+
+        return setters;
+    }
+
+}
+
+auto silvanus::generatebox::batch::splitCsvLine(const std::string& line) -> std::vector<std::string> {
+    auto fields = std::vector<std::string>{};
+    auto field  = std::string{};
+    auto quoted = false;
+
+    for (size_t i = 0; i < line.size(); ++i) {
+        auto const character = line[i];
+
+        if (quoted) {
+            if (character != '"') {
+                field += character;
+            } else if (i + 1 < line.size() && line[i + 1] == '"') {
+                field += '"';
+                ++i;
+            } else {
+                quoted = false;
+            }
+            continue;
+        }
+
+        if (character == '"') {
+            quoted = true;
+        } else if (character == ',') {
+            fields.push_back(boost::algorithm::trim_copy(field));
+            field.clear();
+        } else {
+            field += character;
+        }
+    }
+
+    if (quoted) throw std::invalid_argument("unterminated quote");
+
+    fields.push_back(boost::algorithm::trim_copy(field));
+    return fields;
+}
+
+auto silvanus::generatebox::batch::parseJsonLine(const std::string& line) -> SpecificationFields {
+    auto tree   = boost::property_tree::ptree{};
+    auto stream = std::istringstream{line};
+
+    try {
+        boost::property_tree::read_json(stream, tree);
+    } catch (const boost::property_tree::json_parser_error& error) {
+        throw std::invalid_argument(error.message());
+    }
+
+    auto fields = SpecificationFields{};
+    for (auto const& [key, value]: tree) {
+        if (!value.empty()) throw std::invalid_argument("nested value for " + key);
+        fields[key] = value.data();
+    }
+    return fields;
+}
+
+void silvanus::generatebox::batch::specificationFromFields(const SpecificationFields& fields, BoxSpecification& specification) {
+    static auto const setters = fieldSetters();
+
+    for (auto const& [key, value]: fields) {
+        if (value.empty()) continue;
+
+        auto const setter = setters.find(boost::algorithm::to_lower_copy(key));
+        if (setter == setters.end()) continue;
+
+        setter->second(specification, value);
+    }
+}
+
+auto BoxSpecificationReader::nextLine(std::string& line) -> bool {
+    while (std::getline(m_stream, line)) {
+        ++m_line;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        auto const trimmed = boost::algorithm::trim_copy(line);
+        if (trimmed.empty() || trimmed.front() == '#') continue;
+
+        line = trimmed;
+        return true;
+    }
+    return false;
+}
+
+auto BoxSpecificationReader::next(BoxSpecification& specification) -> bool {
+    auto line = std::string{};
+    if (!nextLine(line)) return false;
+
+    try {
+        if (!m_started) {
+            m_started = true;
+            m_json    = line.front() == '{';
+
+            if (!m_json) {
+                m_header = splitCsvLine(line);
+                for (auto& name: m_header) boost::algorithm::to_lower(name);
+                if (!nextLine(line)) return false;
+            }
+        }
+
+        auto fields = SpecificationFields{};
+        if (m_json) {
+            fields = parseJsonLine(line);
+        } else {
+            auto const values = splitCsvLine(line);
+            if (values.size() > m_header.size()) throw std::invalid_argument("more values than header columns");
+
+            for (size_t i = 0; i < values.size(); ++i) {
+                fields[m_header[i]] = values[i];
+            }
+        }
+
+        ++m_records;
+        specification = BoxSpecification{};
+        specification.name = "box-" + std::to_string(m_records);
+        specificationFromFields(fields, specification);
+    } catch (const std::invalid_argument& error) {
+        throw std::runtime_error("line " + std::to_string(m_line) + ": " + error.what());
+    }
+
+    return true;
+}
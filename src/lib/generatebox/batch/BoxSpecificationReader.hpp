@@ -0,0 +1,69 @@
+//
+// Created by Hobbyist Maker on 9/25/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_BOXSPECIFICATIONREADER_HPP
+#define SILVANUSPRO_BOXSPECIFICATIONREADER_HPP
+
+#include "BoxSpecification.hpp"
+
+#include <istream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace silvanus::generatebox::batch {
+
+    using SpecificationFields = std::map<std::string, std::string>;
+
+    // Reads box specifications one record at a time, either as CSV with a header
+    // row or as JSON lines with one flat object per line; the first record decides
+    // which. Field names are the snake case names of the dialog inputs and every
+    // length is in millimeters:
+    //
+    //   name, length, width, height, thickness, finger_width, kerf,
+    //   finger_mode (automatic, constant, count, none),
+    //   joint_pattern (box, lap, tenon, double_tenon, triple_tenon, quad_tenon, trim, none),
+    //   joint_direction (normal, inverse),
+    //   top, bottom, left, right, front, back (enabled),
+    //   top_thickness ... back_thickness (overrides), y_up,
+    //   divider_orientations (length_width, length_height, width_height),
+    //   divider_joint (normal, inverse),
+    //   length_dividers, width_dividers, height_dividers,
+    //   length_divider_fb_joint, length_divider_tb_joint, width_divider_lr_joint,
+    //   width_divider_tb_joint, height_divider_fb_joint, height_divider_lr_joint
+    //
+    // Empty fields keep the dialog defaults and unknown fields are ignored, so
+    // product sheets can carry their own columns. Blank lines and lines starting
+    // with # are skipped.
+    class BoxSpecificationReader {
+            std::istream&            m_stream;
+            std::vector<std::string> m_header;
+            size_t                   m_line    = 0;
+            size_t                   m_records = 0;
+            bool                     m_started = false;
+            bool                     m_json    = false;
+
+            auto nextLine(std::string& line) -> bool;
+
+        public:
+            explicit BoxSpecificationReader(std::istream& stream) : m_stream{stream} {};
+
+            // Returns false once the stream is exhausted. A malformed record throws
+            // std::runtime_error naming its line; the record is consumed, so reading
+            // can carry on with the next one.
+            auto next(BoxSpecification& specification) -> bool;
+
+            [[nodiscard]] auto line() const -> size_t { return m_line; };
+    };
+
+    auto splitCsvLine(const std::string& line) -> std::vector<std::string>;
+    auto parseJsonLine(const std::string& line) -> SpecificationFields;
+
+    // Throws std::invalid_argument naming the first field that does not parse.
+    void specificationFromFields(const SpecificationFields& fields, BoxSpecification& specification);
+
+}
+
+#endif //SILVANUSPRO_BOXSPECIFICATIONREADER_HPP
@@ -0,0 +1,231 @@
+//
+// Created by Hobbyist Maker on 9/26/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "ParameterSweep.hpp"
+#include "BatchGenerator.hpp"
+
+#include "common/threadpool.hpp"
+#include "entities/Enabled.hpp"
+#include "entities/JointEnabled.hpp"
+#include "entities/JointGroup.hpp"
+#include "render/flatpack/exportFlatPack.hpp"
+#include "render/geometry/collectPanelGeometry.hpp"
+#include "render/geometry/PanelOutline.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::flatpack;
+using namespace silvanus::generatebox::geometry;
+
+namespace {
+
+    void evaluatePoint(const BoxSpecification& specification, SweepResults& results, size_t row) {
+        auto registry = entt::registry{};
+        configureBox(specification, registry);
+
+        auto joints    = 0;
+        auto fingers   = 0;
+        auto min_count = std::numeric_limits<int>::max();
+        auto max_count = 0;
+        auto min_width = std::numeric_limits<double>::max();
+        auto max_width = 0.0;
+
+        auto joint_view = registry.view<const Enabled, const JointEnabled, const JointGroup>().proxy();
+        for (auto &&[entity, enabled, joint_enabled, joint_group]: joint_view) {
+            if (!enabled.value || !joint_enabled.value) continue;
+
+            auto const& profile = joint_group.profile;
+            if ((profile.finger_type == FingerPatternType::None) || (profile.joint_type == JointPatternType::None)) continue;
+
+            ++joints;
+            fingers += profile.finger_count;
+            min_count = std::min(min_count, profile.finger_count);
+            max_count = std::max(max_count, profile.finger_count);
+
+            if (profile.finger_count == 0) continue;
+
+            min_width = std::min(min_width, profile.finger_width);
+            max_width = std::max(max_width, profile.finger_width);
+        }
+
+        auto const panels = collectPanelGeometry(registry);
+        auto const layout = layoutFlatPack(panels, {});
+
+        auto outliner   = PanelOutliner{};
+        auto outline    = PanelOutline{};
+        auto cut_length = 0.0;
+        auto area       = 0.0;
+
+        for (auto const& panel: panels) {
+            outliner.build(panel, outline);
+            cut_length += outlineLength(outline);
+            area += outlineArea(outline);
+        }
+
+        results.panels[row]           = static_cast<int>(panels.size());
+        results.joints[row]           = joints;
+        results.finger_count[row]     = fingers;
+        results.min_finger_count[row] = joints > 0 ? min_count : 0;
+        results.max_finger_count[row] = max_count;
+        results.min_finger_width[row] = max_width > 0 ? min_width : 0;
+        results.max_finger_width[row] = max_width;
+        results.cut_length[row]       = cut_length;
+        results.panel_area[row]       = area;
+        results.sheet_area[row]       = layout.width * layout.height;
+    }
+
+}
+
+auto SweepRange::count() const -> size_t {
+    if (step <= 0 || to < from) return from == to ? 1 : 0;
+
+    // Allow for the rounding error of decimal steps so the end point is kept.
+    return static_cast<size_t>(std::floor((to - from) / step + 1e-9)) + 1;
+}
+
+auto SweepRange::value(size_t index) const -> double {
+    return std::min(to, from + static_cast<double>(index) * step);
+}
+
+auto silvanus::generatebox::batch::parseSweepRange(const std::string& text) -> SweepRange {
+    static auto const fields = std::unordered_map<std::string, double BoxSpecification::*>{
+        {"length", &BoxSpecification::length},
+        {"width", &BoxSpecification::width},
+        {"height", &BoxSpecification::height},
+        {"thickness", &BoxSpecification::thickness},
+        {"finger_width", &BoxSpecification::finger_width},
+        {"kerf", &BoxSpecification::kerf}
+    };
+
+    auto const invalid = std::invalid_argument("invalid sweep range " + text + ", expected name=from:to:step");
+
+    auto const equals = text.find('=');
+    if (equals == std::string::npos) throw invalid;
+
+    auto range = SweepRange{};
+    range.name = text.substr(0, equals);
+
+    auto const field = fields.find(range.name);
+    if (field == fields.end()) throw std::invalid_argument("unknown sweep input " + range.name);
+    range.field = field->second;
+
+    auto values = std::vector<double>{};
+    auto start  = equals + 1;
+    while (values.size() < 3) {
+        auto const end   = std::min(text.find(':', start), text.size());
+        auto const value = text.substr(start, end - start);
+
+        auto consumed = size_t{0};
+        try {
+            values.push_back(std::stod(value, &consumed));
+        } catch (const std::exception&) {
+            throw invalid;
+        }
+        if (consumed != value.size()) throw invalid;
+
+        start = end + 1;
+        if (end == text.size()) break;
+    }
+    if (values.size() != 3 || start <= text.size()) throw invalid;
+
+    // Specifications are written in millimeters, the registry works in centimeters.
+    range.from = values[0] / 10;
+    range.to   = values[1] / 10;
+    range.step = values[2] / 10;
+    if (range.count() == 0) throw invalid;
+
+    return range;
+}
+
+void SweepResults::resize(size_t count) {
+    points = count;
+    for (auto& input: inputs) input.assign(count, 0);
+
+    failed.assign(count, 0);
+    panels.assign(count, 0);
+    joints.assign(count, 0);
+    finger_count.assign(count, 0);
+    min_finger_count.assign(count, 0);
+    max_finger_count.assign(count, 0);
+    min_finger_width.assign(count, 0);
+    max_finger_width.assign(count, 0);
+    cut_length.assign(count, 0);
+    panel_area.assign(count, 0);
+    sheet_area.assign(count, 0);
+}
+
+auto silvanus::generatebox::batch::sweepParameters(
+    const BoxSpecification& base, const std::vector<SweepRange>& ranges, size_t threads
+) -> SweepResults {
+    auto results = SweepResults{};
+    auto points  = size_t{1};
+
+    for (auto const& range: ranges) {
+        if (range.field == nullptr) throw std::invalid_argument("sweep range " + range.name + " has no field");
+
+        results.input_names.push_back(range.name);
+        points *= range.count();
+    }
+
+    results.inputs.resize(ranges.size());
+    results.resize(points);
+    if (points == 0) return results;
+
+    // Decode every row into its inputs up front, last range fastest, so workers
+    // only read the input columns.
+    for (size_t row = 0; row < points; ++row) {
+        auto remainder = row;
+        for (auto column = ranges.size(); column-- > 0;) {
+            auto const count = ranges[column].count();
+            results.inputs[column][row] = ranges[column].value(remainder % count);
+            remainder /= count;
+        }
+    }
+
+    auto pool = common::ThreadPool{threads};
+    pool.parallelFor(points, [&](size_t row) {
+        auto specification = base;
+        for (size_t column = 0; column < ranges.size(); ++column) {
+            specification.*(ranges[column].field) = results.inputs[column][row];
+        }
+
+        try {
+            evaluatePoint(specification, results, row);
+        } catch (const std::exception&) {
+            results.failed[row] = 1;
+        }
+    });
+
+    return results;
+}
+
+void silvanus::generatebox::batch::writeSweepCsv(const SweepResults& results, std::ostream& stream) {
+    for (auto const& name: results.input_names) {
+        stream << name << "_mm,";
+    }
+    stream << "failed,panels,joints,finger_count,min_finger_count,max_finger_count,"
+              "min_finger_width_mm,max_finger_width_mm,cut_length_mm,panel_area_mm2,sheet_area_mm2\n";
+
+    for (size_t row = 0; row < results.points; ++row) {
+        for (auto const& input: results.inputs) {
+            stream << fmt::format("{:.3f},", input[row] * 10);
+        }
+        stream << fmt::format(
+            "{},{},{},{},{},{},{:.3f},{:.3f},{:.2f},{:.2f},{:.2f}\n",
+            results.failed[row], results.panels[row], results.joints[row], results.finger_count[row],
+            results.min_finger_count[row], results.max_finger_count[row],
+            results.min_finger_width[row] * 10, results.max_finger_width[row] * 10,
+            results.cut_length[row] * 10, results.panel_area[row] * 100, results.sheet_area[row] * 100
+        );
+    }
+}
@@ -0,0 +1,69 @@
+//
+// Created by Hobbyist Maker on 9/26/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_PARAMETERSWEEP_HPP
+#define SILVANUSPRO_PARAMETERSWEEP_HPP
+
+#include "BoxSpecification.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace silvanus::generatebox::batch {
+
+    // One swept input. Values run from..to inclusive in steps of step, in the
+    // same centimeters as the specification field they replace.
+    struct SweepRange {
+        std::string name;
+        double BoxSpecification::* field = nullptr;
+        double from = 0;
+        double to   = 0;
+        double step = 0;
+
+        [[nodiscard]] auto count() const -> size_t;
+        [[nodiscard]] auto value(size_t index) const -> double;
+    };
+
+    // Parses name=from:to:step with the values in millimeters, for example
+    // height=40:120:10. The name is one of length, width, height, thickness,
+    // finger_width or kerf. Throws std::invalid_argument naming the range.
+    auto parseSweepRange(const std::string& text) -> SweepRange;
+
+    // Metrics for every point of a sweep, one column per metric. Row i of every
+    // column belongs to the same point; inputs holds one column per range in the
+    // order the ranges were given. The first range varies slowest.
+    struct SweepResults {
+        size_t                           points = 0;
+        std::vector<std::string>         input_names;
+        std::vector<std::vector<double>> inputs;
+
+        std::vector<std::uint8_t> failed;
+        std::vector<int>          panels;
+        std::vector<int>          joints;
+        std::vector<int>          finger_count;
+        std::vector<int>          min_finger_count;
+        std::vector<int>          max_finger_count;
+        std::vector<double>       min_finger_width;
+        std::vector<double>       max_finger_width;
+        std::vector<double>       cut_length;
+        std::vector<double>       panel_area;
+        std::vector<double>       sheet_area;
+
+        void resize(size_t count);
+    };
+
+    // Runs the full panel and joint pipeline for every combination of the ranges
+    // across a thread pool. Each point writes only its own row, so the columns
+    // are filled without locking. Points that throw are flagged in failed.
+    auto sweepParameters(const BoxSpecification& base, const std::vector<SweepRange>& ranges, size_t threads = 0) -> SweepResults;
+
+    // Writes the results as CSV with lengths in millimeters.
+    void writeSweepCsv(const SweepResults& results, std::ostream& stream);
+
+}
+
+#endif //SILVANUSPRO_PARAMETERSWEEP_HPP
@@ -0,0 +1,288 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "ReplayDialog.hpp"
+
+#include "dialog/presentation/DialogDefaults.hpp"
+#include "dialog/presentation/OutsidePanelRows.hpp"
+#include "dialog/presentation/PanelConfigurationManager.hpp"
+#include "dialog/presentation/entity_helpers.hpp"
+#include "dialog/presentation/updateDividers.hpp"
+
+#include "entities/EntitiesAll.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <fmt/format.h>
+
+#include <memory>
+#include <stdexcept>
+
+using namespace silvanus::generatebox;
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::dialog;
+using namespace silvanus::generatebox::entities;
+
+namespace {
+
+    // Spinners are created with a value in the units they show, and report
+    // their value in Fusion's internal centimeters.
+    auto floatInput(const std::string& id, double value, const std::string& unit_type) -> FloatInputControl {
+        auto const scale = unit_type == "mm" ? .1 : unit_type == "in" ? 2.54 : 1.0;
+        return std::make_shared<FloatInputStandIn>(id, value * scale, fmt::format("{} {}", value, unit_type), unit_type);
+    }
+
+    auto checkInput(const std::string& id, bool value) -> BoolInputControl {
+        return std::make_shared<ValueInputStandIn<bool>>(id, value);
+    }
+
+    auto stringInput(const std::string& id, const std::string& value) -> StringInputControl {
+        return std::make_shared<ValueInputStandIn<std::string>>(id, value);
+    }
+
+    auto countInput(const std::string& id) -> IntegerInputControl {
+        return std::make_shared<ValueInputStandIn<int>>(id, 0);
+    }
+
+    auto choiceInput(const std::string& id) -> ChoiceInputControl {
+        return std::make_shared<ChoiceInputStandIn>(id, 0);
+    }
+
+}
+
+ReplayDialog::ReplayDialog(bool is_metric, ModelOrientation orientation) {
+    m_configuration.set<DialogErrorMessage>("");
+    m_configuration.set<DialogModelingUnits>(is_metric);
+    m_configuration.set<DialogModelingOrientation>(orientation);
+
+    m_configuration.set<DialogCreationMode>(addInput(choiceInput("creationTypeCommandInput")));
+    m_configuration.set<DialogInstancedPanels>(addInput(checkInput("instancedPanelsCommandInput", false)));
+    m_configuration.set<DialogUpdateExisting>(addInput(checkInput("updateExistingCommandInput", false)));
+    m_configuration.set<DialogBoxName>(addInput(stringInput("boxNameCommandInput", default_box_name)));
+    m_configuration.set<DialogFingerMode>(addInput(choiceInput("fingerTypeCommandInput")));
+    m_configuration.set<DialogFastPreviewMode>(addInput(checkInput("fastPreviewCommandInput", true)));
+
+    createPanelInputs(is_metric);
+    createDividerInputs();
+    createJointInputs();
+}
+
+void ReplayDialog::createDimensionInputs(bool is_metric) {
+    auto const dimension = [this, is_metric](const dimensionConfig& defaults) {
+        auto const& config = defaults.at(is_metric);
+        return addInput(floatInput(config.id, config.initial_value, config.unit_type));
+    };
+
+    m_configuration.set<DialogLengthInput>(dimension(length_input_defaults));
+    m_configuration.set<DialogWidthInput>(dimension(width_input_defaults));
+    m_configuration.set<DialogHeightInput>(dimension(height_input_defaults));
+    m_configuration.set<DialogThicknessInput>(dimension(thickness_input_defaults));
+    m_configuration.set<DialogFingerWidthInput>(dimension(finger_input_defaults));
+    m_configuration.set<DialogKerfInput>(dimension(kerf_input_defaults));
+
+    auto const parameter = [this](const std::string& name, const FloatInputControl& control) {
+        auto entity = m_configuration.create();
+        m_configuration.emplace<FloatParameterInput>(entity, name, control);
+    };
+
+    parameter("length", m_configuration.ctx<DialogLengthInput>().control);
+    parameter("width", m_configuration.ctx<DialogWidthInput>().control);
+    parameter("height", m_configuration.ctx<DialogHeightInput>().control);
+    parameter("default_thickness", m_configuration.ctx<DialogThicknessInput>().control);
+    parameter("finger_width", m_configuration.ctx<DialogFingerWidthInput>().control);
+    parameter("kerf", m_configuration.ctx<DialogKerfInput>().control);
+}
+
+void ReplayDialog::createPanelInputs(bool is_metric) {
+    auto config_mgr = PanelConfigurationManager(m_configuration, is_metric);
+    auto panel_rows = OutsidePanelRows(config_mgr);
+
+    createDimensionInputs(is_metric);
+
+    panel_rows.configure(m_configuration.ctx<DialogModelingOrientation>().value);
+
+    auto default_thickness = m_configuration.ctx<DialogThicknessInput>().control;
+
+    for (auto &&[entity, panel, label_config, enable_config, override_config, thickness_config]: config_mgr.panels()) {
+        auto label_control    = std::make_shared<InputStandIn>(label_config.id);
+        auto enable_control   = addInput(checkInput(enable_config.id, enable_config.default_value));
+        auto override_control = addInput(checkInput(override_config.id, false));
+        override_control->isEnabled(enable_control->value());
+
+        auto thickness_control = addInput(floatInput(thickness_config.id, thickness_config.initial_value, thickness_config.unit_type));
+        thickness_control->isEnabled(enable_control->value() && override_control->value());
+
+        auto parameter = thickness_config.name + "_thickness";
+        auto controls  = config_mgr.addControls(entity);
+        controls.addLabel(label_control)
+                .addEnable(enable_control)
+                .addOverride(override_control)
+                .addThickness(thickness_control)
+                .addActiveThickness(default_thickness, parameter);
+    }
+
+    panel_rows.addHandlers(
+        [this](const std::string& input, const handler& input_handler) { addHandler(input, input_handler); },
+        [this](const std::string& input) { addCollisionHandler(input); }
+    );
+}
+
+void ReplayDialog::createDividerInputs() {
+    auto const update_dividers = [this](entt::registry& registry) {
+        updateDividers(registry, m_systems);
+    };
+
+    auto orientations = addInput(choiceInput("dividerOrientationCommandInput"));
+    m_configuration.set<DialogDividerOrientationsInput>(orientations);
+    addHandler(orientations->id(), [](entt::registry& registry) {
+        switch (selectedIndex(registry.ctx<DialogDividerOrientationsInput>().control)) {
+            case 0: {
+                registry.ctx<DialogHeightDividerCountInput>().control->value(0);
+                auto old_view = registry.view<HeightDivider>();
+                registry.destroy(old_view.begin(), old_view.end());
+                break;
+            }
+            case 1: {
+                registry.ctx<DialogWidthDividerCountInput>().control->value(0);
+                auto old_view = registry.view<WidthDivider>();
+                registry.destroy(old_view.begin(), old_view.end());
+                break;
+            }
+            case 2: {
+                registry.ctx<DialogLengthDividerCountInput>().control->value(0);
+                auto old_view = registry.view<LengthDivider>();
+                registry.destroy(old_view.begin(), old_view.end());
+                break;
+            }
+            default:
+                break;
+        }
+    });
+
+    auto divider_joint = addInput(choiceInput("dividerLapCommandInput"));
+    m_configuration.set<DialogDividerJointInput>(divider_joint);
+    addHandler(divider_joint->id(), [this](entt::registry&) {
+        run("lengthDividerCommandInput");
+        run("widthDividerCommandInput");
+        run("heightDividerCommandInput");
+    });
+
+    auto const joint = [this, &update_dividers](const std::string& id) {
+        auto control = addInput(choiceInput(id));
+        addHandler(id, update_dividers);
+        return control;
+    };
+
+    m_configuration.set<DialogLengthDividerFrontBackJointInput>(joint("lengthDividerOutsideFBJointInput"));
+    m_configuration.set<DialogLengthDividerTopBottomJointInput>(joint("lengthDividerOutsideTBJointInput"));
+    m_configuration.set<DialogLengthDividerCountInput>(addInput(countInput("lengthDividerCommandInput")));
+    addHandler("lengthDividerCommandInput", update_dividers);
+
+    m_configuration.set<DialogWidthDividerLeftRightJointInput>(joint("widthDividerOutsideLRJointInput"));
+    m_configuration.set<DialogWidthDividerTopBottomJointInput>(joint("widthDividerOutsideTBJointInput"));
+    m_configuration.set<DialogWidthDividerCountInput>(addInput(countInput("widthDividerCommandInput")));
+    addHandler("widthDividerCommandInput", update_dividers);
+
+    m_configuration.set<DialogHeightDividerFrontBackJointInput>(joint("heightDividerOutsideFBJointInput"));
+    m_configuration.set<DialogHeightDividerLeftRightJointInput>(joint("heightDividerOutsideLRJointInput"));
+    m_configuration.set<DialogHeightDividerCountInput>(addInput(countInput("heightDividerCommandInput")));
+    addHandler("heightDividerCommandInput", update_dividers);
+}
+
+// Rows are numbered in the order GenerateBoxDialog::populateJointTable adds
+// them, so each jointRowPattern and jointRowType input of a log reaches the
+// joint it was recorded for.
+void ReplayDialog::createJointInputs() {
+    m_systems.updateCollisions();
+    m_systems.findJoints<OutsidePanel, StandardJoint>();
+
+    auto row_num = 1;
+
+    auto view = m_configuration.view<JointPanels, DialogJointPattern, DialogPanelCollisionData>().proxy();
+    for (auto &&[entity, joints, pattern, data]: view) {
+        auto const row_str = std::to_string(row_num);
+
+        auto direction = addInput(choiceInput("jointRowPattern" + row_str));
+        m_configuration.emplace<DialogJointDirectionInputs>(entity, DialogJointDirectionInput{direction}, DialogJointDirectionInput{direction, true});
+
+        auto type = addInput(choiceInput("jointRowType" + row_str));
+        m_configuration.emplace<DialogJointPatternInput>(entity, type);
+
+        row_num += 1;
+    }
+
+    addCollisionHandler(length_input_defaults.at(true).id);
+    addCollisionHandler(width_input_defaults.at(true).id);
+    addCollisionHandler(height_input_defaults.at(true).id);
+    addCollisionHandler(thickness_input_defaults.at(true).id);
+
+    m_systems.postUpdate();
+}
+
+auto ReplayDialog::addInput(FloatInputControl control) -> FloatInputControl {
+    m_setters[control->id()] = [control](const std::string& value) {
+        auto const parsed = std::stod(value);
+        control->value(parsed);
+        control->expression(fmt::format("{} cm", parsed));
+    };
+    return control;
+}
+
+auto ReplayDialog::addInput(BoolInputControl control) -> BoolInputControl {
+    m_setters[control->id()] = [control](const std::string& value) { control->value(std::stoi(value) != 0); };
+    return control;
+}
+
+auto ReplayDialog::addInput(IntegerInputControl control) -> IntegerInputControl {
+    m_setters[control->id()] = [control](const std::string& value) { control->value(std::stoi(value)); };
+    return control;
+}
+
+auto ReplayDialog::addInput(StringInputControl control) -> StringInputControl {
+    m_setters[control->id()] = [control](const std::string& value) { control->value(value); };
+    return control;
+}
+
+auto ReplayDialog::addInput(ChoiceInputControl control) -> ChoiceInputControl {
+    m_setters[control->id()] = [control](const std::string& value) { control->selectedIndex(std::stoi(value)); };
+    return control;
+}
+
+void ReplayDialog::addHandler(const std::string& input, const handler& input_handler) {
+    m_handlers[input].emplace_back(input_handler);
+}
+
+void ReplayDialog::addCollisionHandler(const std::string& input) {
+    addHandler(input, [this](entt::registry&) {
+        m_systems.updateCollisions();
+        m_systems.postUpdate();
+    });
+}
+
+void ReplayDialog::run(const std::string& input) {
+    for (auto const& input_handler: m_handlers[input]) {
+        input_handler(m_configuration);
+    }
+
+    m_systems.postUpdate();
+}
+
+auto ReplayDialog::update(const std::string& input, const std::string& value) -> bool {
+    auto const found = m_setters.find(input);
+    if (found == m_setters.end()) return false;
+
+    try {
+        found->second(value);
+    } catch (const std::logic_error&) {
+        return false;
+    }
+
+    run(input);
+    return true;
+}
+
+void ReplayDialog::initializePanels(entt::registry& panels) {
+    panels.clear();
+    m_systems.initializePanels(panels);
+}
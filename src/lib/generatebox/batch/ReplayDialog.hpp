@@ -0,0 +1,71 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_REPLAYDIALOG_HPP
+#define SILVANUSPRO_REPLAYDIALOG_HPP
+
+#include "dialog/systems/DialogSystemManager.hpp"
+#include "entities/InputControls.hpp"
+#include "entities/ModelOrientation.hpp"
+
+#include <entt/entt.hpp>
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace silvanus::generatebox::batch {
+
+    // The configuration registry of the box dialog, with stand-ins for its
+    // command inputs. It is built from the same defaults and in the same order
+    // as GenerateBoxDialog::create, with its panels set up by the same
+    // OutsidePanelRows for the orientation the log recorded. A change to an
+    // input runs the handlers the dialog registers for that input followed by
+    // the dialog systems, as GenerateBoxDialog::update does. The joint table
+    // keeps one pattern and one direction input per row.
+    class ReplayDialog {
+            using handler = std::function<void(entt::registry&)>;
+            using setter  = std::function<void(const std::string&)>;
+
+            entt::registry              m_configuration;
+            dialog::DialogSystemManager m_systems{m_configuration};
+
+            std::unordered_map<std::string, setter>               m_setters;
+            std::unordered_map<std::string, std::vector<handler>> m_handlers;
+
+            auto addInput(entities::FloatInputControl control) -> entities::FloatInputControl;
+            auto addInput(entities::BoolInputControl control) -> entities::BoolInputControl;
+            auto addInput(entities::IntegerInputControl control) -> entities::IntegerInputControl;
+            auto addInput(entities::StringInputControl control) -> entities::StringInputControl;
+            auto addInput(entities::ChoiceInputControl control) -> entities::ChoiceInputControl;
+
+            void addHandler(const std::string& input, const handler& input_handler);
+            void addCollisionHandler(const std::string& input);
+
+            void createDimensionInputs(bool is_metric);
+            void createPanelInputs(bool is_metric);
+            void createDividerInputs();
+            void createJointInputs();
+
+            void run(const std::string& input);
+
+        public:
+            explicit ReplayDialog(bool is_metric, entities::ModelOrientation orientation = entities::ModelOrientation::YUp);
+
+            ReplayDialog(const ReplayDialog&) = delete;
+            auto operator=(const ReplayDialog&) -> ReplayDialog& = delete;
+
+            // Sets the input to a value as the dialog input log stores it and
+            // runs its handlers. Returns false, and changes nothing, for inputs
+            // the dialog has no stand-in for and for values that do not parse.
+            auto update(const std::string& input, const std::string& value) -> bool;
+
+            void initializePanels(entt::registry& panels);
+    };
+
+}
+
+#endif //SILVANUSPRO_REPLAYDIALOG_HPP
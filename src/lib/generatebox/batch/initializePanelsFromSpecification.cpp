@@ -0,0 +1,305 @@
+//
+// Created by Hobbyist Maker on 9/25/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "initializePanelsFromSpecification.hpp"
+
+#include "dialog/systems/DialogSystemManager.hpp"
+#include "entities/EntitiesAll.hpp"
+#include "entity_helpers.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <fmt/format.h>
+#include <plog/Log.h>
+
+#include <array>
+#include <string>
+
+using namespace silvanus::generatebox;
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::entities;
+
+namespace {
+
+    struct OutsidePanelConfiguration {
+        std::string name;
+        int         priority;
+        AxisFlag    orientation;
+        PanelAxis   axis;
+        bool        is_max;
+        PanelSpecification BoxSpecification::* panel;
+    };
+
+    void addOrientation(entt::registry& configuration, entt::entity entity, AxisFlag orientation) {
+        switch (orientation) {
+            case AxisFlag::Length:
+                configuration.emplace<LengthOrientation>(entity);
+                break;
+            case AxisFlag::Width:
+                configuration.emplace<WidthOrientation>(entity);
+                break;
+            default:
+                configuration.emplace<HeightOrientation>(entity);
+        }
+    }
+
+    // Mirrors the min/max panel helpers of the dialog, with the maximums taken from
+    // the specification instead of the dimension inputs. The min side of an axis has
+    // no dimension on that axis, so it keeps its thickness there.
+    void addOutsidePanel(entt::registry& configuration, const BoxSpecification& specification, const OutsidePanelConfiguration& config) {
+        auto const& panel     = specification.*config.panel;
+        auto const  thickness = panel.thickness.value_or(specification.thickness);
+        auto const& axis      = config.axis;
+
+        auto entity = makeDialogPanelEntity(configuration, Position::Outside, config.name, config.priority, config.orientation);
+        configuration.get<PanelEnabled>(entity).is_true = panel.enabled;
+        configuration.get<PanelThickness>(entity).value = thickness;
+        configuration.emplace<ThicknessParameter>(entity, boost::algorithm::to_lower_copy(config.name) + "_thickness", 0.0, "cm");
+
+        auto const has_length = config.is_max || !axis.length;
+        auto const has_width  = config.is_max || !axis.width;
+        auto const has_height = config.is_max || !axis.height;
+
+        if (has_length) configuration.emplace<MaxLengthParam>(entity, "length");
+        if (has_width) configuration.emplace<MaxWidthParam>(entity, "width");
+        if (has_height) configuration.emplace<MaxHeightParam>(entity, "height");
+
+        configuration.emplace<PanelMaximums>(
+            entity,
+            has_length ? specification.length : thickness,
+            has_width ? specification.width : thickness,
+            has_height ? specification.height : thickness
+        );
+        configuration.emplace<PanelMaxPoint>(entity);
+        configuration.emplace<PanelMaxParam>(entity);
+        configuration.emplace<PanelMinPoint>(entity);
+        configuration.emplace<PanelMinParam>(entity);
+        addOrientation(configuration, entity, config.orientation);
+        configuration.emplace<PanelOrientation>(entity, config.orientation);
+        configuration.emplace<OutsidePanel>(entity);
+        configuration.emplace<PanelAxis>(entity, axis.length, axis.width, axis.height);
+
+        PLOG_DEBUG << "Added " << config.name << " panel with thickness " << thickness;
+    }
+
+    void updateCollisions(entt::registry& configuration) {
+        updatePanelDimensionsImpl(configuration);
+        projectPlanesImpl(configuration);
+        projectPlaneParamsImpl(configuration);
+    }
+
+    // The dialog's postUpdate, with the finger, pattern and direction inputs read from
+    // the specification. updateJointPatternImpl only has the inside lap joints left to
+    // apply, as there are no pattern inputs in the configuration.
+    void postUpdate(entt::registry& configuration, const BoxSpecification& specification) {
+        updateJointPlanesImpl(configuration);
+        updateJointCollisionDataImpl(configuration);
+
+        for (auto &&[entity, pattern, mode]: configuration.view<FingerPattern, const DialogFingerMode>().proxy()) {
+            pattern.value = specification.finger_mode;
+        }
+
+        for (auto &&[entity, width, input]: configuration.view<FingerWidth, const FingerWidthInput>().proxy()) {
+            width.value = specification.finger_width;
+        }
+
+        for (auto &&[entity, pattern, standard]: configuration.view<JointPattern, const StandardJoint>().proxy()) {
+            pattern.value = specification.joint_pattern;
+        }
+
+        updateJointPatternImpl(configuration);
+
+        for (auto &&[entity, directions, standard]: configuration.view<JointDirections, const StandardJoint>().proxy()) {
+            directions.first  = specification.joint_direction;
+            directions.second = static_cast<JointDirectionType>(!(bool)specification.joint_direction);
+        }
+    }
+
+    struct DividerConfiguration {
+        std::string name_prefix;
+        int         priority;
+        AxisFlag    orientation;
+        PanelAxis   axis;
+        double      max_offset;
+        std::string max_expression;
+    };
+
+    template<class T, class O>
+    void addDividers(
+        entt::registry& configuration, const BoxSpecification& specification, const DividerSpecification& dividers, const DividerConfiguration& config
+    ) {
+        auto const divider_count     = dividers.count;
+        auto const divider_thickness = specification.thickness;
+
+        if (divider_count <= 0) return;
+
+        auto const pocket_count  = divider_count + 1;
+        auto const total_panels  = divider_count + 2;
+        auto const pocket_offset = (config.max_offset - divider_thickness * total_panels) / pocket_count;
+
+        auto const pocket_offset_expr = fmt::format("(({0} - thickness * ({1} + 2)) / ({1} + 1))", config.max_expression, divider_count);
+
+        for (auto divider_num = 1; divider_num < pocket_count; divider_num++) {
+            auto const name        = config.name_prefix + " Divider " + std::to_string(divider_num);
+            auto const divider_pos = pocket_offset * divider_num + divider_thickness * (divider_num + 1);
+            auto const divider_expr = fmt::format("(({0} * {1}) + (thickness * ({1} + 1)))", pocket_offset_expr, divider_num);
+
+            auto const is_length = config.orientation == AxisFlag::Length;
+            auto const is_width  = config.orientation == AxisFlag::Width;
+            auto const is_height = config.orientation == AxisFlag::Height;
+
+            auto entity = configuration.create();
+            configuration.emplace<T>(entity);
+            configuration.emplace<O>(entity);
+
+            configuration.emplace<FingerPattern>(entity);
+            configuration.emplace<InsidePanel>(entity);
+            configuration.emplace<JointPattern>(entity);
+            configuration.emplace<PanelPlanes>(entity);
+            configuration.emplace<PanelPlanesParams>(entity);
+            configuration.emplace<PanelMaxPoint>(entity);
+            configuration.emplace<PanelMaxParam>(entity);
+            configuration.emplace<PanelMinPoint>(entity);
+            configuration.emplace<PanelMinParam>(entity);
+            configuration.emplace<PanelThickness>(entity, divider_thickness);
+
+            configuration.emplace<ThicknessParameter>(entity, "thickness");
+            configuration.emplace<MaxLengthParam>(entity, is_length ? divider_expr : "length");
+            configuration.emplace<MaxWidthParam>(entity, is_width ? divider_expr : "width");
+            configuration.emplace<MaxHeightParam>(entity, is_height ? divider_expr : "height");
+
+            configuration.emplace<Panel>(entity, name, config.priority, config.orientation, config.axis);
+            configuration.emplace<PanelAxis>(entity, config.axis.length, config.axis.width, config.axis.height);
+            configuration.emplace<PanelEnabled>(entity, true);
+            configuration.emplace<PanelMaximums>(
+                entity,
+                is_length ? divider_pos : specification.length,
+                is_width ? divider_pos : specification.width,
+                is_height ? divider_pos : specification.height
+            );
+            configuration.emplace<PanelPosition>(entity, Position::Inside);
+
+            PLOG_DEBUG << "Added " << name << " at " << divider_pos;
+        }
+    }
+
+    void addLengthDividers(entt::registry& configuration, const BoxSpecification& specification) {
+        auto const orientations = specification.divider_orientations;
+        if (orientations == 2) return;
+
+        auto const divider_inverted = specification.divider_inverse;
+
+        addDividers<LengthDivider, LengthOrientation>(
+            configuration, specification, specification.length_dividers,
+            {"Length", 2, AxisFlag::Length, {1, 0, 0}, specification.length, "length"}
+        );
+
+        auto is_inverted = (orientations == 0 && divider_inverted) || (orientations == 1 && !divider_inverted);
+        auto inside_direction = static_cast<JointDirectionType>(is_inverted);
+        updateCollisions(configuration);
+        findJointsImpl<LengthDivider, LengthDividerJoint>(configuration);
+        updateJointPatternValuesImpl<LengthDividerJoint>(configuration, AxisFlag::Width, specification.length_dividers.first);
+        updateJointPatternValuesImpl<LengthDividerJoint>(configuration, AxisFlag::Height, specification.length_dividers.second);
+        updateJointDirectionImpl<LengthDividerJoint>(configuration, Position::Outside, Position::Inside, JointDirectionType::Normal);
+        updateJointDirectionImpl<LengthDividerJoint>(configuration, Position::Inside, Position::Inside, inside_direction);
+        postUpdate(configuration, specification);
+    }
+
+    void addWidthDividers(entt::registry& configuration, const BoxSpecification& specification) {
+        auto const orientations = specification.divider_orientations;
+        if (orientations == 1) return;
+
+        auto const divider_inverted = specification.divider_inverse;
+
+        addDividers<WidthDivider, WidthOrientation>(
+            configuration, specification, specification.width_dividers,
+            {"Width", 1, AxisFlag::Width, {0, 1, 0}, specification.width, "width"}
+        );
+
+        auto is_inverted = (orientations == 0 && !divider_inverted) || (orientations == 2 && divider_inverted);
+        auto inside_direction = static_cast<JointDirectionType>(is_inverted);
+        updateCollisions(configuration);
+        findJointsImpl<WidthDivider, WidthDividerJoint>(configuration);
+        updateJointPatternValuesImpl<WidthDividerJoint>(configuration, AxisFlag::Length, specification.width_dividers.first);
+        updateJointPatternValuesImpl<WidthDividerJoint>(configuration, AxisFlag::Height, specification.width_dividers.second);
+        updateJointDirectionImpl<WidthDividerJoint>(configuration, Position::Outside, Position::Inside, JointDirectionType::Normal);
+        updateJointDirectionImpl<WidthDividerJoint>(configuration, Position::Inside, Position::Inside, inside_direction);
+        postUpdate(configuration, specification);
+    }
+
+    void addHeightDividers(entt::registry& configuration, const BoxSpecification& specification) {
+        auto const orientations = specification.divider_orientations;
+        if (orientations == 0) return;
+
+        // The height dividers read the divider joint dropdown the other way around.
+        auto const divider_inverted = !specification.divider_inverse;
+
+        addDividers<HeightDivider, HeightOrientation>(
+            configuration, specification, specification.height_dividers,
+            {"Height", 0, AxisFlag::Height, {0, 0, 1}, specification.height, "height"}
+        );
+
+        auto is_inverted = (orientations == 1 && divider_inverted) || (orientations == 2 && !divider_inverted);
+        auto inside_direction = static_cast<JointDirectionType>(is_inverted);
+        updateCollisions(configuration);
+        findJointsImpl<HeightDivider, HeightDividerJoint>(configuration);
+        updateJointPatternValuesImpl<HeightDividerJoint>(configuration, AxisFlag::Width, specification.height_dividers.first);
+        updateJointPatternValuesImpl<HeightDividerJoint>(configuration, AxisFlag::Length, specification.height_dividers.second);
+        updateJointDirectionImpl<HeightDividerJoint>(configuration, Position::Outside, Position::Inside, JointDirectionType::Normal);
+        updateJointDirectionImpl<HeightDividerJoint>(configuration, Position::Inside, Position::Inside, inside_direction);
+        postUpdate(configuration, specification);
+    }
+
+    void addFloatParameter(entt::registry& registry, const std::string& name, double value) {
+        auto param_entity = registry.create();
+        registry.emplace<FloatParameter>(param_entity, name, value, fmt::format("{} cm", value), "cm");
+    }
+
+    void addFloatParameters(entt::registry& configuration, entt::registry& registry, const BoxSpecification& specification) {
+        for (auto &&[entity, parameter, thickness]: configuration.view<const ThicknessParameter, const PanelThickness>().proxy()) {
+            addFloatParameter(registry, parameter.name, thickness.value);
+        }
+
+        addFloatParameter(registry, "length", specification.length);
+        addFloatParameter(registry, "width", specification.width);
+        addFloatParameter(registry, "height", specification.height);
+        addFloatParameter(registry, "default_thickness", specification.thickness);
+        addFloatParameter(registry, "finger_width", specification.finger_width);
+        addFloatParameter(registry, "kerf", specification.kerf);
+    }
+
+}
+
+void silvanus::generatebox::batch::initializePanelsFromSpecification(const BoxSpecification& specification, entt::registry& registry) {
+    PLOG_DEBUG << "Initializing panels for " << specification.name;
+
+    auto configuration = entt::registry{};
+    configuration.set<DialogFingerMode>();
+    configuration.set<DialogFingerWidthInput>();
+    configuration.set<DialogThicknessInput>();
+
+    auto const outside_panels = std::array<OutsidePanelConfiguration, 6>{{
+        {"Back", 4, AxisFlag::Width, {0, 1, 0}, !specification.y_up, &BoxSpecification::back},
+        {"Front", 4, AxisFlag::Width, {0, 1, 0}, specification.y_up, &BoxSpecification::front},
+        {"Right", 5, AxisFlag::Length, {1, 0, 0}, true, &BoxSpecification::right},
+        {"Left", 5, AxisFlag::Length, {1, 0, 0}, false, &BoxSpecification::left},
+        {"Bottom", 3, AxisFlag::Height, {0, 0, 1}, false, &BoxSpecification::bottom},
+        {"Top", 3, AxisFlag::Height, {0, 0, 1}, true, &BoxSpecification::top}
+    }};
+
+    for (auto const& panel: outside_panels) {
+        addOutsidePanel(configuration, specification, panel);
+    }
+
+    updateCollisions(configuration);
+    findJointsImpl<OutsidePanel, StandardJoint>(configuration);
+    postUpdate(configuration, specification);
+
+    addLengthDividers(configuration, specification);
+    addWidthDividers(configuration, specification);
+    addHeightDividers(configuration, specification);
+
+    addFloatParameters(configuration, registry, specification);
+    initializePanelsFromConfigurationImpl(configuration, registry, specification.kerf);
+}
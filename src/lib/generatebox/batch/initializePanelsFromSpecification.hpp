@@ -0,0 +1,23 @@
+//
+// Created by Hobbyist Maker on 9/25/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_INITIALIZEPANELSFROMSPECIFICATION_HPP
+#define SILVANUSPRO_INITIALIZEPANELSFROMSPECIFICATION_HPP
+
+#include "BoxSpecification.hpp"
+
+#include <entt/entt.hpp>
+
+namespace silvanus::generatebox::batch {
+
+    // Fills the panel registry the same way the dialog does when it is accepted,
+    // ready for ConfigurePanels and ConfigureJoints. The dialog systems run against
+    // a private configuration registry with every input taken from the
+    // specification, so no Fusion controls are involved.
+    void initializePanelsFromSpecification(const BoxSpecification& specification, entt::registry& registry);
+
+}
+
+#endif //SILVANUSPRO_INITIALIZEPANELSFROMSPECIFICATION_HPP
@@ -0,0 +1,129 @@
+//
+// Created by Hobbyist Maker on 9/28/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "replayDialogInputs.hpp"
+#include "ReplayDialog.hpp"
+
+#include "render/estimate/estimateBoxMetrics.hpp"
+#include "render/systems/ConfigureJoints.hpp"
+#include "render/systems/ConfigurePanels.hpp"
+
+#include <fmt/format.h>
+#include <plog/Log.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <map>
+
+using namespace silvanus::generatebox;
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::dialog;
+using namespace silvanus::generatebox::estimate;
+
+namespace {
+
+    // Nearest rank, so every percentile is one of the measured values.
+    auto percentile(const std::vector<double>& sorted, double rank) -> double {
+        if (sorted.empty()) return 0;
+
+        auto const index = static_cast<size_t>(std::ceil(rank * static_cast<double>(sorted.size())));
+        return sorted[std::clamp<size_t>(index, 1, sorted.size()) - 1];
+    }
+
+    auto summarize(const std::string& input, std::vector<double>& latencies, std::vector<double>& recorded) -> ReplayLatency {
+        std::sort(latencies.begin(), latencies.end());
+        std::sort(recorded.begin(), recorded.end());
+
+        return {
+            input, latencies.size(),
+            percentile(latencies, .5), percentile(latencies, .9), percentile(latencies, .99),
+            latencies.empty() ? 0 : latencies.back(),
+            percentile(recorded, .5), percentile(recorded, .99)
+        };
+    }
+
+}
+
+auto silvanus::generatebox::batch::replayDialogInputs(const std::vector<DialogInputLog>& logs, bool preview) -> ReplayReport {
+    using clock = std::chrono::steady_clock;
+
+    auto const started = clock::now();
+
+    auto report    = ReplayReport{};
+    auto latencies = std::map<std::string, std::pair<std::vector<double>, std::vector<double>>>{};
+    auto all       = std::pair<std::vector<double>, std::vector<double>>{};
+    auto registry  = entt::registry{};
+
+    for (auto const& log: logs) {
+        ++report.sessions;
+        auto dialog = ReplayDialog{log.is_metric, log.orientation};
+
+        for (auto const& event: log.events) {
+            ++report.events;
+
+            auto const event_started = clock::now();
+
+            try {
+                if (!dialog.update(event.input, event.value)) {
+                    ++report.ignored;
+                    continue;
+                }
+
+                dialog.initializePanels(registry);
+
+                if (preview) {
+                    systems::ConfigurePanels(registry).execute();
+                    systems::ConfigureJoints(registry).execute();
+                    estimateBoxMetrics(registry);
+                }
+            } catch (const std::exception& error) {
+                PLOG_DEBUG << "Replaying " << event.input << " = " << event.value << " failed: " << error.what();
+                ++report.failed;
+                continue;
+            }
+
+            auto const elapsed = std::chrono::duration<double, std::micro>(clock::now() - event_started).count();
+            auto& [replayed, recorded] = latencies[event.input];
+
+            replayed.push_back(elapsed);
+            recorded.push_back(static_cast<double>(event.duration));
+            all.first.push_back(elapsed);
+            all.second.push_back(static_cast<double>(event.duration));
+        }
+    }
+
+    report.seconds = std::chrono::duration<double>(clock::now() - started).count();
+    report.total   = summarize("total", all.first, all.second);
+
+    for (auto& [input, samples]: latencies) {
+        report.inputs.push_back(summarize(input, samples.first, samples.second));
+    }
+
+    return report;
+}
+
+void silvanus::generatebox::batch::writeReplayReport(const ReplayReport& report, std::ostream& stream) {
+    stream << fmt::format(
+        "{} sessions, {} events, {} ignored, {} failed in {:.2f}s\n\n",
+        report.sessions, report.events, report.ignored, report.failed, report.seconds
+    );
+
+    stream << fmt::format(
+        "{:<36} {:>7} {:>10} {:>10} {:>10} {:>10} {:>13} {:>13}\n",
+        "input", "events", "p50 us", "p90 us", "p99 us", "max us", "recorded p50", "recorded p99"
+    );
+
+    auto const row = [&stream](const ReplayLatency& latency) {
+        stream << fmt::format(
+            "{:<36} {:>7} {:>10.0f} {:>10.0f} {:>10.0f} {:>10.0f} {:>13.0f} {:>13.0f}\n",
+            latency.input, latency.events, latency.p50, latency.p90, latency.p99, latency.max,
+            latency.recorded_p50, latency.recorded_p99
+        );
+    };
+
+    for (auto const& latency: report.inputs) row(latency);
+    row(report.total);
+}
@@ -0,0 +1,55 @@
+//
+// Created by Hobbyist Maker on 9/28/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_REPLAYDIALOGINPUTS_HPP
+#define SILVANUSPRO_REPLAYDIALOGINPUTS_HPP
+
+#include "dialog/presentation/DialogInputLog.hpp"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace silvanus::generatebox::batch {
+
+    // Latencies in microseconds. recorded_* are the durations the dialog logged
+    // for the same events, for comparing a replay against the session it came from.
+    struct ReplayLatency {
+        std::string input;
+        size_t      events       = 0;
+        double      p50          = 0;
+        double      p90          = 0;
+        double      p99          = 0;
+        double      max          = 0;
+        double      recorded_p50 = 0;
+        double      recorded_p99 = 0;
+    };
+
+    struct ReplayReport {
+        size_t                     sessions = 0;
+        size_t                     events   = 0;
+        size_t                     ignored  = 0;
+        size_t                     failed   = 0;
+        double                     seconds  = 0;
+        ReplayLatency              total;
+        std::vector<ReplayLatency> inputs;
+    };
+
+    // Replays every event of the logs in order. Each session gets a
+    // ReplayDialog built from the dialog defaults for its units; an event sets
+    // its input there and runs the handlers and dialog systems the dialog runs
+    // for it, and the panel registry is then initialized from the
+    // configuration as the add-in does before every preview. With preview the
+    // panels and joints are also configured and estimated, as the dialog
+    // preview does. Inputs the dialog has no stand-in for, such as the
+    // estimate text, are counted as ignored and events the systems throw on as
+    // failed; neither is part of the latencies.
+    auto replayDialogInputs(const std::vector<dialog::DialogInputLog>& logs, bool preview = false) -> ReplayReport;
+
+    void writeReplayReport(const ReplayReport& report, std::ostream& stream);
+
+}
+
+#endif //SILVANUSPRO_REPLAYDIALOGINPUTS_HPP
@@ -0,0 +1,145 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_DIALOGDEFAULTS_HPP
+#define SILVANUSPRO_DIALOGDEFAULTS_HPP
+
+#include "entities/DialogInputs.hpp"
+#include "entities/InputConfig.hpp"
+
+#include <string>
+#include <unordered_map>
+
+// The dialog inputs and their initial values for metric (true) and imperial
+// (false) designs. Values are in the units of the input; the dialog and the
+// batch replay both start from these.
+namespace silvanus::generatebox::dialog {
+
+    using dimensionConfig = std::unordered_map<bool, InputConfig>;
+
+    // Name the generated panels are tagged with when the box name is left empty.
+    inline const std::string default_box_name = "Box";
+
+    inline const dimensionConfig length_input_defaults = {
+        {true, {entities::DialogInputs::Length, "length", "lengthSpinnerInput", "Length", "mm", 0.01, 2540, .1, 285}},
+        {false, {entities::DialogInputs::Length, "length", "lengthSpinnerInput", "Length", "in", 0.005, 48, 0.0625, 12}}
+    };
+
+    inline const dimensionConfig width_input_defaults = {
+        {true, {entities::DialogInputs::Width, "width", "widthSpinnerInput", "Width", "mm", 0.01, 2540, .1, 142.5}},
+        {false, {entities::DialogInputs::Width, "width", "widthSpinnerInput", "Width", "in", 0.005, 48, 0.0625, 6}}
+    };
+
+    inline const dimensionConfig height_input_defaults = {
+        {true, {entities::DialogInputs::Height, "height", "heightSpinnerInput", "Height", "mm", 0.01, 2540, .1, 40}},
+        {false, {entities::DialogInputs::Height, "height", "heightSpinnerInput", "Height", "in", 0.005, 48, 0.0625, 3.5}}
+    };
+
+    inline const dimensionConfig thickness_input_defaults = {
+        {true, {entities::DialogInputs::Thickness, "thickness", "thicknessSpinnerInput", "Thickness", "mm", 0.01, 2540, .1, 3.2}},
+        {false, {entities::DialogInputs::Thickness, "thickness", "thicknessSpinnerInput", "Thickness", "in", 0.005, 48, 0.0625, .125}}
+    };
+
+    inline const dimensionConfig finger_input_defaults = {
+        {true, {entities::DialogInputs::FingerWidth, "finger_width", "fingerWidthSpinnerInput", "Finger Width", "mm", 0.01, 50.4,.1, 9.6}},
+        {false, {entities::DialogInputs::FingerWidth, "finger_width", "fingerWidthSpinnerInput", "Finger Width", "in", 0.005, 48, 0.0625, .375}}
+    };
+
+    inline const dimensionConfig kerf_input_defaults = {
+        {true, {entities::DialogInputs::Kerf, "kerf", "kerfSpinnerInput", "Kerf", "mm", 0, 25.4, .05, 0}},
+        {false, {entities::DialogInputs::Kerf, "kerf", "kerfSpinnerInput", "Kerf", "in", 0, 1, .05, 0}}
+    };
+
+    inline const PanelDefaultConfiguration top_panel_defaults = {
+        entities::Panels::Top,
+        3,
+        {"topPanelLabel", "Top", "<b>Top</b>", "top"},
+        {entities::DialogInputs::TopEnable, "topEnableInput", "Top", false},
+        {entities::DialogInputs::TopOverride, "topOverrideInput", "Top"},
+        {
+            entities::DialogInputs::TopThickness, "top_thickness", "topThicknessInput", "Top",
+            std::unordered_map<bool, entities::InputDefaults>{
+                {true,  {"mm", 0.01, 2540, .1, 3.2}},
+                {false, {"in", 0.005, 48, 0.0625, .125}}
+            }
+        },
+        entities::AxisFlag::Height
+    };
+
+    inline const PanelDefaultConfiguration bottom_panel_defaults = {
+        entities::Panels::Bottom,
+        3,
+        {"bottomPanelLabel", "Bottom", "<b>Bottom</b>", "bottom"},
+        {entities::DialogInputs::BottomEnable, "bottomEnableInput", "Bottom", true},
+        {entities::DialogInputs::BottomOverride, "bottomOverrideInput", "Bottom"},
+        {
+            entities::DialogInputs::BottomThickness, "bottom_thickness", "bottomThicknessInput", "Bottom",
+            std::unordered_map<bool, entities::InputDefaults>{
+                {true,  {"mm", 0.01, 2540, .1, 3.2}},
+                {false, {"in", 0.005, 48, 0.0625, .125}}
+            }
+        },
+        entities::AxisFlag::Height
+    };
+
+    inline const PanelDefaultConfiguration left_panel_defaults = {
+        entities::Panels::Left,
+        5,
+        {"leftPanelLabel", "Left", "<b>Left</b>", "left"},
+        {entities::DialogInputs::LeftEnable, "leftEnableInput", "Left", true},
+        {entities::DialogInputs::LeftOverride, "leftOverrideInput", "Left"},
+        {
+            entities::DialogInputs::LeftThickness, "left_thickness", "leftThicknessInput", "Left",
+            std::unordered_map<bool, entities::InputDefaults>{{true,  {"mm", 0.01, 2540, .1, 3.2}},
+                                                    {false, {"in", 0.005, 48, 0.0625, .125}}}
+        },
+        entities::AxisFlag::Length
+    };
+
+    inline const PanelDefaultConfiguration right_panel_defaults = {
+        entities::Panels::Right,
+        5,
+        {"rightPanelLabel", "Right", "<b>Right</b>", "right"},
+        {entities::DialogInputs::RightEnable, "rightEnableInput", "Right", true},
+        {entities::DialogInputs::RightOverride, "rightOverrideInput", "Right"},
+        {
+            entities::DialogInputs::RightThickness, "right_thickness", "rightThicknessInput", "Right",
+            std::unordered_map<bool, entities::InputDefaults>{{true,  {"mm", 0.01, 2540, .1, 3.2}},
+                                                    {false, {"in", 0.005, 48, 0.0625, .125}}}
+        },
+        entities::AxisFlag::Length
+    };
+
+    inline const PanelDefaultConfiguration front_panel_defaults = {
+        entities::Panels::Front,
+        4,
+        {"frontPanelLabel", "Front", "<b>Front</b>", "front"},
+        {entities::DialogInputs::FrontEnable, "frontEnableInput", "Front", true},
+        {entities::DialogInputs::FrontOverride, "frontOverrideInput", "Front"},
+        {
+            entities::DialogInputs::FrontThickness, "front_thickness", "frontThicknessInput", "Front",
+            std::unordered_map<bool, entities::InputDefaults>{{true,  {"mm", 0.01, 2540, .1, 3.2}},
+                                                    {false, {"in", 0.005, 48, 0.0625, .125}}}
+        },
+        entities::AxisFlag::Width
+    };
+
+    inline const PanelDefaultConfiguration back_panel_defaults = {
+        entities::Panels::Back,
+        4,
+        {"backPanelLabel", "Back", "<b>Back</b>", "back"},
+        {entities::DialogInputs::BackEnable, "backEnableInput", "Back", true},
+        {entities::DialogInputs::BackOverride, "backOverrideInput", "Back"},
+        {
+            entities::DialogInputs::BackThickness, "back_thickness", "backThicknessInput", "Back",
+            std::unordered_map<bool, entities::InputDefaults>{{true,  {"mm", 0.01, 2540, .1, 3.2}},
+                                                    {false, {"in", 0.005, 48, 0.0625, .125}}}
+        },
+        entities::AxisFlag::Width
+    };
+
+}
+
+#endif //SILVANUSPRO_DIALOGDEFAULTS_HPP
@@ -0,0 +1,116 @@
+//
+// Created by Hobbyist Maker on 9/28/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "DialogInputLog.hpp"
+
+#include <plog/Log.h>
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+using namespace silvanus::generatebox::dialog;
+using namespace silvanus::generatebox::entities;
+
+namespace {
+
+    auto constexpr log_header  = "# silvanus dialog inputs";
+    auto constexpr log_version = 1;
+
+    auto startsWith(const std::string& line, const std::string& prefix) -> bool {
+        return line.compare(0, prefix.size(), prefix) == 0;
+    }
+
+}
+
+void silvanus::generatebox::dialog::writeDialogInputLog(const DialogInputLog& log, std::ostream& stream) {
+    stream << log_header << " " << log_version << " " << (log.is_metric ? "metric" : "imperial")
+           << " " << (log.orientation == ModelOrientation::ZUp ? "z-up" : "y-up") << "\n";
+
+    for (auto const& event: log.events) {
+        stream << event.time << "\t" << event.duration << "\t" << event.input << "\t" << event.value << "\n";
+    }
+}
+
+auto silvanus::generatebox::dialog::readDialogInputLogs(std::istream& stream) -> std::vector<DialogInputLog> {
+    auto logs        = std::vector<DialogInputLog>{};
+    auto line        = std::string{};
+    auto line_number = 0;
+
+    while (std::getline(stream, line)) {
+        ++line_number;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+
+        if (startsWith(line, log_header)) {
+            auto header  = std::istringstream{line.substr(std::string{log_header}.size())};
+            auto version = 0;
+            auto units   = std::string{};
+            auto up      = std::string{};
+            header >> version >> units >> up;
+
+            if (version != log_version) {
+                throw std::runtime_error("line " + std::to_string(line_number) + ": unsupported dialog input log version");
+            }
+
+            logs.push_back({units != "imperial", up == "z-up" ? ModelOrientation::ZUp : ModelOrientation::YUp, {}});
+            continue;
+        }
+
+        if (line.front() == '#') continue;
+
+        if (logs.empty()) {
+            throw std::runtime_error("line " + std::to_string(line_number) + ": event before the dialog input log header");
+        }
+
+        auto fields = std::istringstream{line};
+        auto event  = DialogInputEvent{};
+        fields >> event.time >> event.duration;
+        fields.ignore(1);
+
+        if (!fields || !std::getline(fields, event.input, '\t')) {
+            throw std::runtime_error("line " + std::to_string(line_number) + ": malformed dialog input event");
+        }
+        std::getline(fields, event.value);
+
+        logs.back().events.push_back(std::move(event));
+    }
+
+    return logs;
+}
+
+void DialogInputRecorder::start(const std::string& filename, bool is_metric, ModelOrientation orientation) {
+    m_filename = filename;
+    m_start    = clock::now();
+    m_log      = DialogInputLog{is_metric, orientation, {}};
+    m_active   = true;
+
+    PLOG_DEBUG << "Recording dialog inputs to " << filename;
+}
+
+void DialogInputRecorder::record(const std::string& input, const std::string& value, clock::duration duration) {
+    if (!m_active) return;
+
+    auto const time = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - m_start).count();
+    auto const took = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+
+    m_log.events.push_back({static_cast<std::uint64_t>(time), static_cast<std::uint64_t>(took), input, value});
+}
+
+void DialogInputRecorder::finish() {
+    if (!m_active) return;
+    m_active = false;
+
+    auto file = std::ofstream(m_filename, std::ios::out | std::ios::app);
+    writeDialogInputLog(m_log, file);
+
+    if (!file) {
+        PLOG_DEBUG << "Could not write dialog inputs to " << m_filename;
+    } else {
+        PLOG_DEBUG << "Recorded " << m_log.events.size() << " dialog inputs to " << m_filename;
+    }
+
+    m_log.events.clear();
+}
@@ -0,0 +1,72 @@
+//
+// Created by Hobbyist Maker on 9/28/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_DIALOGINPUTLOG_HPP
+#define SILVANUSPRO_DIALOGINPUTLOG_HPP
+
+#include "entities/ModelOrientation.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace silvanus::generatebox::dialog {
+
+    // One input change as the dialog saw it. time is the number of microseconds
+    // since the dialog was created and duration how long the handlers and the
+    // dialog systems took to run for it. Lengths are in Fusion's internal
+    // centimeters, dropdowns are stored as the selected index, check boxes as
+    // 0 or 1 and text as it was entered.
+    struct DialogInputEvent {
+        std::uint64_t time     = 0;
+        std::uint64_t duration = 0;
+        std::string   input;
+        std::string   value;
+    };
+
+    struct DialogInputLog {
+        bool                          is_metric   = true;
+        entities::ModelOrientation    orientation = entities::ModelOrientation::YUp;
+        std::vector<DialogInputEvent> events;
+    };
+
+    // Every dialog session starts with a header line naming the units and the
+    // model orientation the dialog was created with, followed by one tab
+    // separated line per event:
+    //
+    //     # silvanus dialog inputs 1 metric y-up
+    //     <time>\t<duration>\t<input id>\t<value>
+    //
+    // Headers written before the orientation was recorded read as y-up.
+    void writeDialogInputLog(const DialogInputLog& log, std::ostream& stream);
+
+    // Reads every session in the stream, skipping blank lines and comments.
+    // Throws std::runtime_error on malformed lines.
+    auto readDialogInputLogs(std::istream& stream) -> std::vector<DialogInputLog>;
+
+    // Collects the events of one dialog session and appends them to a file when
+    // the session ends. Until start is called, record does nothing.
+    class DialogInputRecorder {
+            using clock = std::chrono::steady_clock;
+
+            std::string       m_filename;
+            clock::time_point m_start;
+            DialogInputLog    m_log;
+            bool              m_active = false;
+
+        public:
+            void start(const std::string& filename, bool is_metric, entities::ModelOrientation orientation);
+            void record(const std::string& input, const std::string& value, clock::duration duration);
+            void finish();
+
+            [[nodiscard]] auto active() const -> bool { return m_active; };
+    };
+
+}
+
+#endif //SILVANUSPRO_DIALOGINPUTLOG_HPP
@@ -6,8 +6,9 @@
 //
 
 #include "presentation/GenerateBoxDialog.hpp"
-#include "presentation/dividers.hpp"
+#include "presentation/OutsidePanelRows.hpp"
 #include "presentation/PanelDialogControls.hpp"
+#include "presentation/updateDividers.hpp"
 #include "presentation/validateDimensions.hpp"
 
 #include "entities/EntitiesAll.hpp"
@@ -19,6 +20,10 @@
 #include <Core/CoreAll.h>
 
 #include <boost/algorithm/string.hpp>
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cstdlib>
 
 using std::all_of;
 using std::get;
@@ -29,11 +34,11 @@ using adsk::core::Application;
 using adsk::core::BoolValueCommandInput;
 using adsk::core::CommandInput;
 using adsk::core::CommandInputs;
-using adsk::core::DefaultModelingOrientations;
 using adsk::core::DropDownCommandInput;
 using adsk::core::FloatSpinnerCommandInput;
 using adsk::core::GroupCommandInput;
 using adsk::core::IntegerSpinnerCommandInput;
+using adsk::core::StringValueCommandInput;
 using adsk::core::TabCommandInput;
 using adsk::core::TableCommandInput;
 using adsk::core::TablePresentationStyles;
@@ -48,7 +53,26 @@ using namespace silvanus::generatebox::dialog;
 using silvanus::generatebox::entities::JointDirections;
 using panelMap = std::map<silvanus::generatebox::entities::Panels, entt::entity>;
 
+namespace {
+
+    // The value of an input as the dialog input log stores it.
+    auto dialogInputValue(const Ptr<CommandInput>& input) -> std::string {
+        if (auto const spinner = Ptr<FloatSpinnerCommandInput>{input}) return fmt::format("{}", spinner->value());
+        if (auto const counter = Ptr<IntegerSpinnerCommandInput>{input}) return std::to_string(counter->value());
+        if (auto const check = Ptr<BoolValueCommandInput>{input}) return check->value() ? "1" : "0";
+        if (auto const text = Ptr<StringValueCommandInput>{input}) return text->value();
+        if (auto const dropdown = Ptr<DropDownCommandInput>{input}) {
+            auto const selected = dropdown->selectedItem();
+            return selected ? std::to_string(selected->index()) : "-1";
+        }
+
+        return "";
+    }
+
+}
+
 void GenerateBoxDialog::clear() {
+    m_recorder.finish();
     m_validators.clear();
     m_handlers.clear();
     m_results.clear();
@@ -62,23 +86,22 @@ void GenerateBoxDialog::create(
     const adsk::core::Ptr<Application> &app,
     const adsk::core::Ptr<CommandInputs> &inputs,
     const adsk::core::Ptr<Component> &root,
-    DefaultModelingOrientations orientation,
+    ModelOrientation orientation,
     bool is_metric
 ) {
     m_app = app;
+
+    // Set SILVANUS_DIALOG_LOG to a file name to record every input change for
+    // SilvanusBatch --replay.
+    if (auto const log_file = std::getenv("SILVANUS_DIALOG_LOG")) {
+        m_recorder.start(log_file, is_metric, orientation);
+    }
+
     m_configuration.set<DialogModelingUnits>(is_metric);
-    m_configuration.set<DialogCommandInputs>(inputs);
-    m_configuration.set<DialogApplication>(app);
-    m_configuration.set<DialogRootComponent>(root);
     m_configuration.set<DialogModelingOrientation>(orientation);
 
     auto config_mgr = PanelConfigurationManager(m_configuration, is_metric);
-    auto back   = config_mgr.initializePanel(m_back_row);
-    auto front  = config_mgr.initializePanel(m_front_row);
-    auto right  = config_mgr.initializePanel(m_right_row);
-    auto left   = config_mgr.initializePanel(m_left_row);
-    auto bottom = config_mgr.initializePanel(m_bottom_row);
-    auto top    = config_mgr.initializePanel(m_top_row);
+    auto panel_rows = OutsidePanelRows(config_mgr);
 
     auto const dimensions = inputs->addTabCommandInput("dimensionsTabInput", "", "resources/dimensions");
     dimensions->tooltip("Dimensions");
@@ -91,18 +114,7 @@ void GenerateBoxDialog::create(
 
     createDimensionParameters();
 
-    top.configure(maxHeightPanel);
-    bottom.configure(minHeightPanel);
-    left.configure(minLengthPanel);
-    right.configure(maxLengthPanel);
-
-    if (orientation == adsk::core::YUpModelingOrientation) {
-        front.configure(maxWidthPanel);
-        back.configure(minWidthPanel);
-    } else {
-        front.configure(minWidthPanel);
-        back.configure(maxWidthPanel);
-    }
+    panel_rows.configure(orientation);
 
     createPanelTable(dimensions_group->children(), config_mgr);
 
@@ -110,9 +122,17 @@ void GenerateBoxDialog::create(
     dividers->tooltip("Dividers");
     createDividerInputs(dividers->children());
 
-    createFollowThicknessValueHandlers(config_mgr);
-    createOverrideEnableHandlers(config_mgr);
-    createThicknessEnableHandlers(config_mgr);
+    panel_rows.addHandlers(
+        [this](const std::string& input, const std::function<void(entt::registry&)>& handler) {
+            m_handlers[input].emplace_back(handler);
+        },
+        [this](const std::string& input) {
+            m_handlers[input].emplace_back([this](entt::registry&) {
+                m_systems->updateCollisions();
+                m_systems->postUpdate();
+            });
+        }
+    );
 
     auto const joints = inputs->addTabCommandInput("panelJointsTabInput", "Joints");
     joints->tooltip("Panel Joints");
@@ -124,6 +144,9 @@ void GenerateBoxDialog::create(
 //
     createPreviewTable(inputs);
 
+    m_estimate = inputs->addTextBoxCommandInput("estimateCommandInput", "Estimate", "", 2, true);
+    m_ignore_updates.emplace_back(m_estimate->id());
+
     m_error = inputs->addTextBoxCommandInput("errorMessageCommandInput", "", "", 2, true);
     m_error->isVisible(false);
 
@@ -142,69 +165,6 @@ void GenerateBoxDialog::create(
     m_systems->postUpdate();
 }
 
-void GenerateBoxDialog::createFollowThicknessValueHandlers(PanelConfigurationManager& mgr) {
-    using floatPtr = adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput>&;
-    using boolPtr = adsk::core::Ptr<adsk::core::BoolValueCommandInput>&;
-
-    auto default_thickness = m_configuration.ctx<DialogThicknessInput>().control;
-
-    for (auto &&[entity, override, thickness]: mgr.overrideThicknessInputs()) {
-        PLOG_DEBUG << "Creating follow thickness handler";
-
-        auto callback = [](boolPtr override, floatPtr thickness, floatPtr default_thickness) {
-            return [override, thickness](entt::registry &registry) {
-                auto const &default_thickness = registry.ctx<DialogThicknessInput>().control;
-
-                auto thickness_enabled = override->value();
-
-                if (thickness_enabled) {
-                    return;
-                }
-
-                thickness->value(default_thickness->value());
-            };
-        };
-
-        addInputControl(default_thickness, callback(override.control, thickness.control, default_thickness));
-    }
-}
-
-void GenerateBoxDialog::createOverrideEnableHandlers(PanelConfigurationManager &mgr) {
-    using floatPtr = adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput>&;
-    using boolPtr = adsk::core::Ptr<adsk::core::BoolValueCommandInput>&;
-
-    for (auto &&[entity, enable, override]: mgr.enableOverrideInputs()) {
-
-        auto callback = [](boolPtr override, boolPtr enable) {
-            return [override, enable](entt::registry &registry) {
-                override->isEnabled(enable->value());
-            };
-        };
-
-        addInputControl(enable.control, callback(override.control, enable.control));
-        addCollisionHandler(enable.control);
-    }
-}
-
-void GenerateBoxDialog::createThicknessEnableHandlers(PanelConfigurationManager &mgr) {
-    using floatPtr = adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput>&;
-    using boolPtr = adsk::core::Ptr<adsk::core::BoolValueCommandInput>&;
-
-    for (auto &&[entity, enable, override, thickness]: mgr.allThicknessInputs()) {
-
-        auto callback = [](boolPtr override, floatPtr thickness) {
-            return [override = override, thickness = thickness](entt::registry &registry) {
-                thickness->isEnabled(override->value() && override->isEnabled());
-            };
-        };
-
-        addInputControl(override.control, callback(override.control, thickness.control));
-        addInputControl(enable.control, callback(override.control, thickness.control));
-        addCollisionHandler(override.control);
-        addCollisionHandler(thickness.control);
-    }
-}
-
 void GenerateBoxDialog::addInputControl(DialogInputs reference, const adsk::core::Ptr<CommandInput>& input) {
     m_inputs[reference] = input->id();
 }
@@ -246,8 +206,33 @@ void GenerateBoxDialog::createModelSelectionDropDown(const Ptr<CommandInputs> &i
 
     auto const &creation_items = creation_mode->listItems();
     creation_items->add("Parametric", true);
+    creation_items->add("Parametric Outline", false);
     creation_items->add("Direct Model", false);
-    creation_mode->maxVisibleItems(2);
+    creation_items->add("Flat Pack Export", false);
+    creation_mode->maxVisibleItems(4);
+
+    auto instanced = inputs->addBoolValueInput("instancedPanelsCommandInput", "Instanced Panels", true, "", false);
+    instanced->tooltip(
+        "Render identical parametric panels once and place the rest as occurrences of the same component. "
+        "The occurrences are placed where the panels are now and do not follow later edits of the parameters that offset them."
+    );
+    m_configuration.set<DialogInstancedPanels>(instanced);
+
+    auto update_existing = inputs->addBoolValueInput("updateExistingCommandInput", "Update Existing Box", true, "", false);
+    update_existing->tooltip(
+        "Keep the panels of the box with this name that did not change since it was last generated with this option on, "
+        "and replace only the ones that did. Boxes generated with it off cannot be updated later."
+    );
+    m_configuration.set<DialogUpdateExisting>(update_existing);
+
+    auto box_name = inputs->addStringValueInput("boxNameCommandInput", "Box Name", default_box_name);
+    box_name->tooltip("Update Existing Box only replaces panels of the box with this name, so boxes of other names in the design are kept.");
+    m_configuration.set<DialogBoxName>(box_name);
+}
+
+auto GenerateBoxDialog::box_name() -> std::string {
+    auto const name = m_configuration.ctx<DialogBoxName>().control->value();
+    return name.empty() ? default_box_name : name;
 }
 
 void GenerateBoxDialog::createFingerModeSelectionDropDown(const Ptr<CommandInputs> &inputs) {
@@ -423,7 +408,7 @@ void GenerateBoxDialog::createHeightDividerInputs(const Ptr<CommandInputs> &inpu
     addJointTypes(height_divider_fb_outside_joint);
     addInputControl(
         DialogInputs::HeightDividerFBJointInput, height_divider_fb_outside_joint, [this](entt::registry& registry) {
-            updateDividers(registry);
+            updateDividers(registry, *m_systems);
         }
     );
 
@@ -434,7 +419,7 @@ void GenerateBoxDialog::createHeightDividerInputs(const Ptr<CommandInputs> &inpu
     addJointTypes(height_divider_lr_outside_joint);
     addInputControl(
         DialogInputs::HeightDividerLRJointInput, height_divider_lr_outside_joint, [this](entt::registry& registry) {
-            updateDividers(registry);
+            updateDividers(registry, *m_systems);
         }
     );
 
@@ -447,49 +432,11 @@ void GenerateBoxDialog::createHeightDividerInputs(const Ptr<CommandInputs> &inpu
 
     addInputControl(
         DialogInputs::HeightDividerCount, height, [this](entt::registry& registry) {
-            updateDividers(registry);
+            updateDividers(registry, *m_systems);
         }
     );
 }
 
-void GenerateBoxDialog::updateHeightDividers(entt::registry& registry) {
-    auto orientations = registry.ctx<DialogDividerOrientationsInput>().control->selectedItem()->index();
-    if (orientations == 0) return;
-
-    auto const divider_height    = registry.ctx<DialogHeightInput>().control->value();
-    auto const divider_inverted = registry.ctx<DialogDividerJointInput>().control->selectedItem()->index() == 0 ;
-
-    auto old_view = registry.view<HeightDivider>();
-    registry.destroy(old_view.begin(), old_view.end());
-
-    auto static_view = registry.view<HeightDividerJoint>();
-    registry.destroy(static_view.begin(), static_view.end());
-
-    PLOG_DEBUG << "Updating Height Divider information";
-
-    auto dividers = Dividers<HeightDivider, DialogHeightDividerCountInput>(registry, m_app);
-    dividers.setAxis(0, 0, 1);
-    dividers.setMaxOffset(divider_height);
-    dividers.setNamePrefix("Height");
-    dividers.setOrientation(AxisFlag::Height);
-    dividers.addOrientation<HeightOrientation>();
-    dividers.setPriority(0);
-//    dividers.addMaxLength("length"); // TODO: Convert to user definable length
-//    dividers.addMaxWidth("width"); // TODO: Convert to user definable width
-    dividers.addMaxHeight("height"); // TODO: Convert to user definable height & thickness
-    dividers.create();
-
-    auto is_inverted = (orientations == 1 && divider_inverted) || (orientations == 2 && !divider_inverted);
-    auto inside_direction = static_cast<JointDirectionType>(is_inverted);
-    m_systems->updateCollisions();
-    m_systems->findJoints<HeightDivider, HeightDividerJoint>();
-    m_systems->updateJointPatternInputs<HeightDividerJoint, DialogHeightDividerFrontBackJointInput>(AxisFlag::Width);
-    m_systems->updateJointPatternInputs<HeightDividerJoint, DialogHeightDividerLeftRightJointInput>(AxisFlag::Length);
-    m_systems->updateJointDirection<HeightDividerJoint>(Position::Outside, Position::Inside, JointDirectionType::Normal);
-    m_systems->updateJointDirection<HeightDividerJoint>(Position::Inside, Position::Inside, inside_direction);
-    m_systems->postUpdate();
-}
-
 void GenerateBoxDialog::createWidthDividerInputs(const Ptr<CommandInputs> &inputs) {
     auto width_group    = inputs->addGroupCommandInput("widthDividerGroupInput", "Width Dividers");
     auto width_children = width_group->children();
@@ -502,7 +449,7 @@ void GenerateBoxDialog::createWidthDividerInputs(const Ptr<CommandInputs> &input
     addJointTypes(width_divider_lr_outside_joint);
     addInputControl(
         DialogInputs::WidthDividerLRJointInput, width_divider_lr_outside_joint, [this](entt::registry& registry) {
-            updateDividers(registry);
+            updateDividers(registry, *m_systems);
         }
     );
 
@@ -513,7 +460,7 @@ void GenerateBoxDialog::createWidthDividerInputs(const Ptr<CommandInputs> &input
     addJointTypes(width_divider_tb_outside_joint);
     addInputControl(
         DialogInputs::WidthDividerTBJointInput, width_divider_tb_outside_joint, [this](entt::registry& registry) {
-            updateDividers(registry);
+            updateDividers(registry, *m_systems);
         }
     );
 
@@ -526,47 +473,11 @@ void GenerateBoxDialog::createWidthDividerInputs(const Ptr<CommandInputs> &input
 
     addInputControl(
         DialogInputs::WidthDividerCount, width, [this](entt::registry& registry) {
-            updateDividers(registry);
+            updateDividers(registry, *m_systems);
         }
     );
 }
 
-void GenerateBoxDialog::updateWidthDividers(entt::registry& registry) {
-    auto orientations = registry.ctx<DialogDividerOrientationsInput>().control->selectedItem()->index();
-    if (orientations == 1) return;
-
-    auto const divider_width    = registry.ctx<DialogWidthInput>().control->value();
-    auto const divider_inverted = registry.ctx<DialogDividerJointInput>().control->selectedItem()->index() == 1;
-
-    auto old_view = registry.view<WidthDivider>();
-    registry.destroy(old_view.begin(), old_view.end());
-
-    auto static_view = registry.view<WidthDividerJoint>();
-    registry.destroy(static_view.begin(), static_view.end());
-
-    auto dividers = Dividers<WidthDivider, DialogWidthDividerCountInput>(registry, m_app);
-    dividers.setAxis(0, 1, 0);
-    dividers.setMaxOffset(divider_width);
-    dividers.setNamePrefix("Width");
-    dividers.setOrientation(AxisFlag::Width);
-    dividers.addOrientation<WidthOrientation>();
-    dividers.setPriority(1);
-//    dividers.addMaxLength("length"); // TODO: Convert to user definable length
-//    dividers.addMaxHeight("height"); // TODO: Convert to user definable height
-    dividers.addMaxWidth("width"); // TODO: Convert to user definable width & thickness
-    dividers.create();
-
-    auto is_inverted = (orientations == 0 && !divider_inverted) || (orientations == 2 && divider_inverted);
-    auto inside_direction = static_cast<JointDirectionType>(is_inverted);
-    m_systems->updateCollisions();
-    m_systems->findJoints<WidthDivider, WidthDividerJoint>();
-    m_systems->updateJointPatternInputs<WidthDividerJoint, DialogWidthDividerLeftRightJointInput>(AxisFlag::Length);
-    m_systems->updateJointPatternInputs<WidthDividerJoint, DialogWidthDividerTopBottomJointInput>(AxisFlag::Height);
-    m_systems->updateJointDirection<WidthDividerJoint>(Position::Outside, Position::Inside, JointDirectionType::Normal);
-    m_systems->updateJointDirection<WidthDividerJoint>(Position::Inside, Position::Inside, inside_direction);
-    m_systems->postUpdate();    
-}
-
 void GenerateBoxDialog::createLengthDividerInputs(const Ptr<CommandInputs> &inputs) {
     auto length_group    = inputs->addGroupCommandInput("lengthDividerGroupInput", "Length Dividers");
     auto length_children = length_group->children();
@@ -579,7 +490,7 @@ void GenerateBoxDialog::createLengthDividerInputs(const Ptr<CommandInputs> &inpu
     addJointTypes(length_divider_fb_outside_joint);
     addInputControl(
         DialogInputs::LengthDividerFBJointInput, length_divider_fb_outside_joint, [this](entt::registry& registry) {
-            updateDividers(registry);
+            updateDividers(registry, *m_systems);
         }
     );
 
@@ -590,7 +501,7 @@ void GenerateBoxDialog::createLengthDividerInputs(const Ptr<CommandInputs> &inpu
     addJointTypes(length_divider_tb_outside_joint);
     addInputControl(
         DialogInputs::LengthDividerTBJointInput, length_divider_tb_outside_joint, [this](entt::registry& registry) {
-            updateDividers(registry);
+            updateDividers(registry, *m_systems);
         }
     );
 
@@ -603,56 +514,11 @@ void GenerateBoxDialog::createLengthDividerInputs(const Ptr<CommandInputs> &inpu
 
     addInputControl(
         DialogInputs::LengthDividerCount, length, [this](entt::registry& registry) {
-            updateDividers(registry);
+            updateDividers(registry, *m_systems);
         }
     );
 }
 
-void GenerateBoxDialog::updateDividers(entt::registry& registry) {
-    updateLengthDividers(registry);
-    updateWidthDividers(registry);
-    updateHeightDividers(registry);
-}
-
-void GenerateBoxDialog::updateLengthDividers(entt::registry& registry) {
-    auto orientations = registry.ctx<DialogDividerOrientationsInput>().control->selectedItem()->index();
-    if (orientations == 2) return;
-
-    auto const divider_length   = registry.ctx<DialogLengthInput>().control->value();
-    auto const divider_inverted = registry.ctx<DialogDividerJointInput>().control->selectedItem()->index() == 1;
-
-    auto old_view = registry.view<LengthDivider>();
-    registry.destroy(old_view.begin(), old_view.end());
-
-    auto static_view = registry.view<LengthDividerJoint>();
-    registry.destroy(static_view.begin(), static_view.end());
-
-    PLOG_DEBUG << "Updating Length Divider information";
-
-    auto dividers = Dividers<LengthDivider, DialogLengthDividerCountInput>(registry, m_app);
-    dividers.setAxis(1, 0, 0);
-    dividers.setMaxOffset(divider_length);
-    dividers.setNamePrefix("Length");
-    dividers.setOrientation(AxisFlag::Length);
-    dividers.addOrientation<LengthOrientation>();
-    dividers.setPriority(2);
-//    dividers.addMaxWidth("width"); // TODO: Convert to user definable width
-//    dividers.addMaxHeight("height"); // TODO: Convert to user definable height
-    dividers.addMaxLength("length"); // TODO: Convert to user definable length & thickness
-    dividers.create();
-//    pocket_offset * divider_num + divider_thickness * (divider_num + 1);
-//                    ((((length - thickness * ({0} + 2)) / ({0} + 1)) * {1}) + (thickness * ({1} + 1)))
-
-    auto is_inverted = (orientations == 0 && divider_inverted) || (orientations == 1 && !divider_inverted);
-    auto inside_direction = static_cast<JointDirectionType>(is_inverted);
-    m_systems->updateCollisions();
-    m_systems->findJoints<LengthDivider, LengthDividerJoint>();
-    m_systems->updateJointPatternInputs<LengthDividerJoint, DialogLengthDividerFrontBackJointInput>(AxisFlag::Width);
-    m_systems->updateJointPatternInputs<LengthDividerJoint, DialogLengthDividerTopBottomJointInput>(AxisFlag::Height);
-    m_systems->updateJointDirection<LengthDividerJoint>(Position::Outside, Position::Inside, JointDirectionType::Normal);
-    m_systems->updateJointDirection<LengthDividerJoint>(Position::Inside, Position::Inside, inside_direction);    
-}
-
 void GenerateBoxDialog::createDividerJointDirectionInput(const Ptr<CommandInputs> &inputs) {
     auto divider_joint = inputs->addDropDownCommandInput("dividerLapCommandInput", "Divider Joint", TextListDropDownStyle);
     m_configuration.set<DialogDividerJointInput>(divider_joint);
@@ -970,13 +836,21 @@ bool GenerateBoxDialog::update(const adsk::core::Ptr<CommandInput> &cmd_input) {
     auto exists = std::find(m_ignore_updates.begin(), m_ignore_updates.end(), cmd_input->id()) != m_ignore_updates.end();
     if (exists) { return false; }
 
+    auto const started = std::chrono::steady_clock::now();
     auto handlers = m_handlers[cmd_input->id()];
 
+    // Handlers can update other inputs; only the change the user made is recorded.
+    ++m_update_depth;
     for (auto &handler: handlers) {
         handler(m_configuration);
     }
 
     m_systems->postUpdate();
+    --m_update_depth;
+
+    if (m_recorder.active() && m_update_depth == 0) {
+        m_recorder.record(cmd_input->id(), dialogInputValue(cmd_input), std::chrono::steady_clock::now() - started);
+    }
 
     return true;
 }
@@ -986,3 +860,16 @@ void GenerateBoxDialog::initializePanels() {
     m_systems->initializePanels(m_panel_registry);
 }
 
+void GenerateBoxDialog::showEstimate(const estimate::BoxMetrics& metrics) {
+    if (!m_estimate) return;
+
+    auto const is_metric = m_configuration.ctx<DialogModelingUnits>().value;
+    auto const minutes   = static_cast<int>(metrics.laser_time) / 60;
+    auto const seconds   = static_cast<int>(metrics.laser_time) % 60;
+
+    auto const cut   = is_metric ? fmt::format("{:.0f} mm", metrics.cut_length * 10) : fmt::format("{:.1f} in", metrics.cut_length / 2.54);
+    auto const sheet = is_metric ? fmt::format("{:.0f} cm&sup2;", metrics.sheet_area) : fmt::format("{:.1f} in&sup2;", metrics.sheet_area / (2.54 * 2.54));
+
+    m_estimate->formattedText(fmt::format("Cut {}, sheet {}, laser {}:{:02d}", cut, sheet, minutes, seconds));
+}
+
@@ -24,6 +24,9 @@
 #include "entities/EntitiesAll.hpp"
 
 #include "lib/generatebox/dialog/systems/DialogSystemManager.hpp"
+#include "lib/generatebox/render/estimate/estimateBoxMetrics.hpp"
+#include "DialogDefaults.hpp"
+#include "DialogInputLog.hpp"
 #include "PanelConfigurationManager.hpp"
 
 namespace silvanus::generatebox::dialog {
@@ -32,47 +35,10 @@ namespace silvanus::generatebox::dialog {
 
     class GenerateBoxDialog {
 
-            InputConfig const length_metric_defaults = {
-                entities::DialogInputs::Length, "length", "lengthSpinnerInput", "Length", "mm", 0.01, 2540, .1, 285
-            };
-            InputConfig const width_metric_defaults = {
-                entities::DialogInputs::Width, "width", "widthSpinnerInput", "Width", "mm", 0.01, 2540, .1, 142.5
-            };
-            InputConfig const height_metric_defaults = {
-                entities::DialogInputs::Height, "height", "heightSpinnerInput", "Height", "mm", 0.01, 2540, .1, 40
-            };
-            InputConfig const thickness_metric_defaults = {
-                entities::DialogInputs::Thickness, "thickness", "thicknessSpinnerInput", "Thickness", "mm", 0.01, 2540, .1, 3.2
-            };
-            InputConfig const finger_metric_defaults = {
-                entities::DialogInputs::FingerWidth, "finger_width", "fingerWidthSpinnerInput", "Finger Width", "mm", 0.01, 50.4,.1, 9.6
-            };
-            InputConfig const kerf_metric_defaults = {
-                entities::DialogInputs::Kerf, "kerf", "kerfSpinnerInput", "Kerf", "mm", 0, 25.4, .05, 0
-            };
-
-            InputConfig const length_imperial_defaults = {
-                entities::DialogInputs::Length, "length", "lengthSpinnerInput", "Length", "in", 0.005, 48, 0.0625, 12
-            };
-            InputConfig const width_imperial_defaults = {
-                entities::DialogInputs::Width, "width", "widthSpinnerInput", "Width", "in", 0.005, 48, 0.0625, 6
-            };
-            InputConfig const height_imperial_defaults = {
-                entities::DialogInputs::Height, "height", "heightSpinnerInput", "Height", "in", 0.005, 48, 0.0625, 3.5
-            };
-            InputConfig const thickness_imperial_defaults = {
-                entities::DialogInputs::Thickness, "thickness", "thicknessSpinnerInput", "Thickness", "in", 0.005, 48, 0.0625, .125
-            };
-            InputConfig const finger_imperial_defaults = {
-                entities::DialogInputs::FingerWidth, "finger_width", "fingerWidthSpinnerInput", "Finger Width", "in", 0.005, 48, 0.0625, .375
-            };
-            InputConfig const kerf_imperial_defaults = {
-                entities::DialogInputs::Kerf, "kerf", "kerfSpinnerInput", "Kerf", "in", 0, 1, .05, 0
-            };
-
             adsk::core::Ptr<adsk::core::Application> m_app;
 
             adsk::core::Ptr<adsk::core::TextBoxCommandInput> m_error;
+            adsk::core::Ptr<adsk::core::TextBoxCommandInput> m_estimate;
 
             std::unordered_map<std::string, std::vector<std::function<void(entt::registry&)>> >           m_handlers;
             std::unordered_map<entities::DialogInputs, std::string>                                       m_inputs;
@@ -80,129 +46,25 @@ namespace silvanus::generatebox::dialog {
             std::vector<std::string>                                                                      m_ignore_updates;
             std::vector<bool>                                                                             m_results;
             std::unique_ptr<DialogSystemManager>                                                          m_systems;
+            DialogInputRecorder                                                                           m_recorder;
+            int                                                                                           m_update_depth = 0;
 
             entt::registry m_configuration = entt::registry{};
             entt::registry &m_panel_registry;
 
-            using dimensionConfig = std::unordered_map<bool, dialog::InputConfig>;
-
-            dimensionConfig length_defaults = {
-                {true, length_metric_defaults},
-                {false, length_imperial_defaults}
-            };
+            dimensionConfig length_defaults    = length_input_defaults;
+            dimensionConfig width_defaults     = width_input_defaults;
+            dimensionConfig height_defaults    = height_input_defaults;
+            dimensionConfig thickness_defaults = thickness_input_defaults;
+            dimensionConfig finger_defaults    = finger_input_defaults;
+            dimensionConfig kerf_defaults      = kerf_input_defaults;
 
-            dimensionConfig width_defaults = {
-                {true, width_metric_defaults},
-                {false, width_imperial_defaults}
-            };
-
-            dimensionConfig height_defaults = {
-                {true, height_metric_defaults},
-                {false, height_imperial_defaults}
-            };
-
-            dimensionConfig thickness_defaults = {
-                {true, thickness_metric_defaults},
-                {false, thickness_imperial_defaults}
-            };
-
-            dimensionConfig finger_defaults = {
-                {true, finger_metric_defaults},
-                {false, finger_imperial_defaults}
-            };
-
-            dimensionConfig kerf_defaults = {
-                {true, kerf_metric_defaults},
-                {false, kerf_imperial_defaults}
-            };
-
-            PanelDefaultConfiguration m_top_row =                 {
-                entities::Panels::Top,
-                3,
-                {"topPanelLabel", "Top", "<b>Top</b>", "top"},
-                {entities::DialogInputs::TopEnable, "topEnableInput", "Top", false},
-                {entities::DialogInputs::TopOverride, "topOverrideInput", "Top"},
-                {
-                    entities::DialogInputs::TopThickness, "top_thickness", "topThicknessInput", "Top",
-                    std::unordered_map<bool, InputDefaults>{
-                        {true,  {"mm", 0.01, 2540, .1, 3.2}},
-                        {false, {"in", 0.005, 48, 0.0625, .125}}
-                    }
-                },
-                entities::AxisFlag::Height
-            };
-
-            PanelDefaultConfiguration m_bottom_row =                 {
-                entities::Panels::Bottom,
-                3,
-                {"bottomPanelLabel", "Bottom", "<b>Bottom</b>", "bottom"},
-                {entities::DialogInputs::BottomEnable, "bottomEnableInput", "Bottom", true},
-                {entities::DialogInputs::BottomOverride, "bottomOverrideInput", "Bottom"},
-                {
-                    entities::DialogInputs::BottomThickness, "bottom_thickness", "bottomThicknessInput", "Bottom",
-                    std::unordered_map<bool, InputDefaults>{
-                        {true,  {"mm", 0.01, 2540, .1, 3.2}},
-                        {false, {"in", 0.005, 48, 0.0625, .125}}
-                    }
-                },
-                entities::AxisFlag::Height
-            };
-
-            PanelDefaultConfiguration m_left_row =                 {
-                entities::Panels::Left,
-                5,
-                {"leftPanelLabel", "Left", "<b>Left</b>", "left"},
-                {entities::DialogInputs::LeftEnable, "leftEnableInput", "Left", true},
-                {entities::DialogInputs::LeftOverride, "leftOverrideInput", "Left"},
-                {
-                    entities::DialogInputs::LeftThickness, "left_thickness", "leftThicknessInput", "Left",
-                    std::unordered_map<bool, InputDefaults>{{true,  {"mm", 0.01, 2540, .1, 3.2}},
-                                                            {false, {"in", 0.005, 48, 0.0625, .125}}}
-                },
-                entities::AxisFlag::Length
-            };
-
-            PanelDefaultConfiguration m_right_row = {
-                entities::Panels::Right,
-                5,
-                {"rightPanelLabel", "Right", "<b>Right</b>", "right"},
-                {entities::DialogInputs::RightEnable, "rightEnableInput", "Right", true},
-                {entities::DialogInputs::RightOverride, "rightOverrideInput", "Right"},
-                {
-                    entities::DialogInputs::RightThickness, "right_thickness", "rightThicknessInput", "Right",
-                    std::unordered_map<bool, InputDefaults>{{true,  {"mm", 0.01, 2540, .1, 3.2}},
-                                                            {false, {"in", 0.005, 48, 0.0625, .125}}}
-                },
-                entities::AxisFlag::Length
-            };
-
-            PanelDefaultConfiguration m_front_row = {
-                entities::Panels::Front,
-                4,
-                {"frontPanelLabel", "Front", "<b>Front</b>", "front"},
-                {entities::DialogInputs::FrontEnable, "frontEnableInput", "Front", true},
-                {entities::DialogInputs::FrontOverride, "frontOverrideInput", "Front"},
-                {
-                    entities::DialogInputs::FrontThickness, "front_thickness", "frontThicknessInput", "Front",
-                    std::unordered_map<bool, InputDefaults>{{true,  {"mm", 0.01, 2540, .1, 3.2}},
-                                                            {false, {"in", 0.005, 48, 0.0625, .125}}}
-                },
-                entities::AxisFlag::Width
-            };
-
-            PanelDefaultConfiguration m_back_row = {
-                entities::Panels::Back,
-                4,
-                {"backPanelLabel", "Back", "<b>Back</b>", "back"},
-                {entities::DialogInputs::BackEnable, "backEnableInput", "Back", true},
-                {entities::DialogInputs::BackOverride, "backOverrideInput", "Back"},
-                {
-                    entities::DialogInputs::BackThickness, "back_thickness", "backThicknessInput", "Back",
-                    std::unordered_map<bool, InputDefaults>{{true,  {"mm", 0.01, 2540, .1, 3.2}},
-                                                            {false, {"in", 0.005, 48, 0.0625, .125}}}
-                },
-                entities::AxisFlag::Width
-            };
+            PanelDefaultConfiguration m_top_row    = top_panel_defaults;
+            PanelDefaultConfiguration m_bottom_row = bottom_panel_defaults;
+            PanelDefaultConfiguration m_left_row   = left_panel_defaults;
+            PanelDefaultConfiguration m_right_row  = right_panel_defaults;
+            PanelDefaultConfiguration m_front_row  = front_panel_defaults;
+            PanelDefaultConfiguration m_back_row   = back_panel_defaults;
 
             DimensionTable m_dimensions_table = {
                 "dimensionsTableInput", "Dimensions", "4:1:2:1:1:2:1:5",
@@ -231,17 +93,8 @@ namespace silvanus::generatebox::dialog {
             void addMinimumFingerWidthCheck();
             void addMinimumPanelCountCheck();
 
-            void updateDividers(entt::registry& registry);
-            void updateLengthDividers(entt::registry& registry);
-            void updateWidthDividers(entt::registry& registry);
-            void updateHeightDividers(entt::registry& registry);
-
             static void updateModelSelection(const entt::registry& registry, const adsk::core::Ptr<adsk::core::DropDownCommandInput>& creation_mode);
 
-            void createOverrideEnableHandlers(PanelConfigurationManager& mgr);
-            void createThicknessEnableHandlers(PanelConfigurationManager& mgr);
-            void createFollowThicknessValueHandlers(PanelConfigurationManager& mgr);
-
             void createDimensionParameters();
             void createFloatParameter(std::string name, adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control);
 
@@ -294,17 +147,23 @@ namespace silvanus::generatebox::dialog {
                 const adsk::core::Ptr<adsk::core::Application> &app,
                 const adsk::core::Ptr<adsk::core::CommandInputs> &inputs,
                 const adsk::core::Ptr<adsk::fusion::Component> &root,
-                adsk::core::DefaultModelingOrientations orientation,
+                entities::ModelOrientation orientation,
                 bool is_metric
             );
 
             void initializePanels();
+            void showEstimate(const estimate::BoxMetrics& metrics);
 
             bool update(const adsk::core::Ptr<adsk::core::CommandInput> &cmd_input);
             bool validate(const adsk::core::Ptr<adsk::core::CommandInputs> &inputs);
             bool full_preview() { return m_configuration.ctx<entities::DialogFullPreviewMode>().control->value(); };
             bool fast_preview() { return m_configuration.ctx<entities::DialogFastPreviewMode>().control->value(); };
             bool is_parametric() { return m_configuration.ctx<entities::DialogCreationMode>().control->selectedItem()->index() == 0; };
+            bool update_existing() { return m_configuration.ctx<entities::DialogUpdateExisting>().control->value(); };
+            auto box_name() -> std::string;
+            bool instanced_panels() { return m_configuration.ctx<entities::DialogInstancedPanels>().control->value(); };
+            bool is_outline() { return m_configuration.ctx<entities::DialogCreationMode>().control->selectedItem()->index() == 1; };
+            bool is_flat_pack() { return m_configuration.ctx<entities::DialogCreationMode>().control->selectedItem()->index() == 3; };
 
             void addInputControl(entities::DialogInputs reference, const adsk::core::Ptr<adsk::core::CommandInput>& input);
             void addInputControl(
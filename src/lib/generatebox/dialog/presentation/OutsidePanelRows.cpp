@@ -0,0 +1,82 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "OutsidePanelRows.hpp"
+#include "DialogDefaults.hpp"
+#include "entity_helpers.hpp"
+
+#include <plog/Log.h>
+
+using namespace silvanus::generatebox;
+using namespace silvanus::generatebox::dialog;
+using namespace silvanus::generatebox::entities;
+
+namespace {
+
+    auto initializeRow(PanelConfigurationManager& manager, const PanelDefaultConfiguration& defaults) -> PanelDialogControls {
+        auto row = defaults;
+        return manager.initializePanel(row);
+    }
+
+}
+
+// The panel table lists the rows in the order they are created.
+OutsidePanelRows::OutsidePanelRows(PanelConfigurationManager& manager) :
+    m_manager{manager},
+    m_back{initializeRow(manager, back_panel_defaults)},
+    m_front{initializeRow(manager, front_panel_defaults)},
+    m_right{initializeRow(manager, right_panel_defaults)},
+    m_left{initializeRow(manager, left_panel_defaults)},
+    m_bottom{initializeRow(manager, bottom_panel_defaults)},
+    m_top{initializeRow(manager, top_panel_defaults)} {}
+
+void OutsidePanelRows::configure(ModelOrientation orientation) {
+    m_top.configure(maxHeightPanel);
+    m_bottom.configure(minHeightPanel);
+    m_left.configure(minLengthPanel);
+    m_right.configure(maxLengthPanel);
+
+    if (orientation == ModelOrientation::YUp) {
+        m_front.configure(maxWidthPanel);
+        m_back.configure(minWidthPanel);
+    } else {
+        m_front.configure(minWidthPanel);
+        m_back.configure(maxWidthPanel);
+    }
+}
+
+void OutsidePanelRows::addHandlers(
+    const std::function<void(const std::string&, const inputHandler&)>& add_handler,
+    const std::function<void(const std::string&)>& add_collision_handler
+) {
+    for (auto &&[entity, override, thickness]: m_manager.overrideThicknessInputs()) {
+        PLOG_DEBUG << "Creating follow thickness handler";
+
+        auto const& default_thickness = m_manager.registry().ctx<DialogThicknessInput>().control;
+        add_handler(default_thickness->id(), [override = override.control, thickness = thickness.control](entt::registry& registry) {
+            if (override->value()) return;
+
+            thickness->value(registry.ctx<DialogThicknessInput>().control->value());
+        });
+    }
+
+    for (auto &&[entity, enable, override]: m_manager.enableOverrideInputs()) {
+        add_handler(enable.control->id(), [override = override.control, enable = enable.control](entt::registry&) {
+            override->isEnabled(enable->value());
+        });
+        add_collision_handler(enable.control->id());
+    }
+
+    for (auto &&[entity, enable, override, thickness]: m_manager.allThicknessInputs()) {
+        auto const thickness_enable = [override = override.control, thickness = thickness.control](entt::registry&) {
+            thickness->isEnabled(override->value() && override->isEnabled());
+        };
+
+        add_handler(override.control->id(), thickness_enable);
+        add_handler(enable.control->id(), thickness_enable);
+        add_collision_handler(override.control->id());
+        add_collision_handler(thickness.control->id());
+    }
+}
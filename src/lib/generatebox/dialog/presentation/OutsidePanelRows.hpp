@@ -0,0 +1,57 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_OUTSIDEPANELROWS_HPP
+#define SILVANUSPRO_OUTSIDEPANELROWS_HPP
+
+#include "PanelConfigurationManager.hpp"
+#include "PanelDialogControls.hpp"
+
+#include "entities/ModelOrientation.hpp"
+
+#include <entt/entt.hpp>
+
+#include <functional>
+#include <string>
+
+namespace silvanus::generatebox::dialog {
+
+    // The six outside panel rows of the box dialog. GenerateBoxDialog and the
+    // batch replay both set their panels up through this class, so the rows
+    // are created in the same order, get the same extents for the model
+    // orientation and have the same handlers on their inputs.
+    class OutsidePanelRows {
+            using inputHandler = std::function<void(entt::registry&)>;
+
+            PanelConfigurationManager& m_manager;
+
+            PanelDialogControls m_back;
+            PanelDialogControls m_front;
+            PanelDialogControls m_right;
+            PanelDialogControls m_left;
+            PanelDialogControls m_bottom;
+            PanelDialogControls m_top;
+
+        public:
+            explicit OutsidePanelRows(PanelConfigurationManager& manager);
+
+            // Places each panel at the minimum or maximum of its axis. Reads
+            // the dimension inputs, so they have to exist by then.
+            void configure(entities::ModelOrientation orientation);
+
+            // Registers the handlers of the enable, override and thickness
+            // inputs, once the rows have their controls: a thickness follows
+            // the default thickness until it is overridden, an override is only
+            // enabled with its panel and a thickness only with its override.
+            // add_collision_handler registers the collision update for an input.
+            void addHandlers(
+                const std::function<void(const std::string&, const inputHandler&)>& add_handler,
+                const std::function<void(const std::string&)>& add_collision_handler
+            );
+    };
+
+}
+
+#endif //SILVANUSPRO_OUTSIDEPANELROWS_HPP
@@ -32,6 +32,8 @@ namespace silvanus::generatebox::dialog {
 
             PanelConfigurationManager(entt::registry& registry, bool is_metric) : m_registry{registry}, m_is_metric{is_metric} {};
 
+            auto registry() -> entt::registry& { return m_registry; }
+
             auto initializePanel(silvanus::generatebox::dialog::PanelDefaultConfiguration& config) { return PanelDialogControls(m_registry, config, m_is_metric); }
 
             auto panels() {
@@ -30,30 +30,30 @@ PanelDialogControls::PanelDialogControls(entt::registry &registry, PanelDefaultC
     m_entity = entity;
 }
 
-auto PanelDialogControls::addLabel(const adsk::core::Ptr<adsk::core::TextBoxCommandInput>& control) -> PanelDialogControls& {
+auto PanelDialogControls::addLabel(const TextInputControl& control) -> PanelDialogControls& {
     m_registry.emplace<PanelLabelInput>(m_entity, control);
     return *this;
 }
 
-auto PanelDialogControls::addEnable(const adsk::core::Ptr<adsk::core::BoolValueCommandInput>& control) -> PanelDialogControls& {
+auto PanelDialogControls::addEnable(const BoolInputControl& control) -> PanelDialogControls& {
     m_registry.emplace<PanelEnableInput>(m_entity, control);
     m_enable = control;
     return *this;
 }
 
-auto PanelDialogControls::addOverride(const adsk::core::Ptr<adsk::core::BoolValueCommandInput>& control) -> PanelDialogControls& {
+auto PanelDialogControls::addOverride(const BoolInputControl& control) -> PanelDialogControls& {
     m_registry.emplace<PanelOverrideInput>(m_entity, control);
     m_override = control;
     return *this;
 }
 
-auto PanelDialogControls::addThickness(const adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput>& control) -> PanelDialogControls& {
+auto PanelDialogControls::addThickness(const FloatInputControl& control) -> PanelDialogControls& {
     m_registry.emplace<PanelThicknessInput>(m_entity, control);
     m_thickness = control;
     return *this;
 }
 
-auto PanelDialogControls::addActiveThickness(const adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput>& control, std::string parameter) -> PanelDialogControls& {
+auto PanelDialogControls::addActiveThickness(const FloatInputControl& control, std::string parameter) -> PanelDialogControls& {
     m_registry.emplace<PanelThicknessActive>(m_entity, control);
     m_registry.emplace<ThicknessParameter>(m_entity, boost::algorithm::to_lower_copy(parameter), 0.0, "cm");
     m_thickness_default = control;
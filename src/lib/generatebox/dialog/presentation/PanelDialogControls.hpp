@@ -9,6 +9,7 @@
 #include "entities/DialogInputs.hpp"
 #include "entities/EntitiesAll.hpp"
 #include "entities/InputConfig.hpp"
+#include "entities/InputControls.hpp"
 
 #include <entt/entt.hpp>
 
@@ -19,10 +20,10 @@ namespace silvanus::generatebox::dialog {
             entt::registry&   m_registry;
             entt::entity      m_entity;
 
-            adsk::core::Ptr<adsk::core::BoolValueCommandInput>    m_enable;
-            adsk::core::Ptr<adsk::core::BoolValueCommandInput>    m_override;
-            adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> m_thickness;
-            adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> m_thickness_default;
+            entities::BoolInputControl  m_enable;
+            entities::BoolInputControl  m_override;
+            entities::FloatInputControl m_thickness;
+            entities::FloatInputControl m_thickness_default;
 
         public:
             PanelDialogControls(entt::registry& registry, PanelDefaultConfiguration& row, bool is_metric);
@@ -32,11 +33,11 @@ namespace silvanus::generatebox::dialog {
                 f(m_registry, m_entity);
             };
 
-            auto addLabel(const adsk::core::Ptr<adsk::core::TextBoxCommandInput>& control) -> PanelDialogControls&;
-            auto addEnable(const adsk::core::Ptr<adsk::core::BoolValueCommandInput>& control) -> PanelDialogControls&;
-            auto addOverride(const adsk::core::Ptr<adsk::core::BoolValueCommandInput>& control) -> PanelDialogControls&;
-            auto addThickness(const adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput>& control) -> PanelDialogControls&;
-            auto addActiveThickness(const adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput>& control,
+            auto addLabel(const entities::TextInputControl& control) -> PanelDialogControls&;
+            auto addEnable(const entities::BoolInputControl& control) -> PanelDialogControls&;
+            auto addOverride(const entities::BoolInputControl& control) -> PanelDialogControls&;
+            auto addThickness(const entities::FloatInputControl& control) -> PanelDialogControls&;
+            auto addActiveThickness(const entities::FloatInputControl& control,
                                     std::string parameter) -> PanelDialogControls&;
 
     };
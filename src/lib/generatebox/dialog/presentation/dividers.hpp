@@ -42,8 +42,6 @@
 #include "entities/PanelPosition.hpp"
 #include "entities/Position.hpp"
 
-#include <Core/CoreAll.h>
-#include <Fusion/FusionAll.h>
 #include <entt/entt.hpp>
 #include <plog/Log.h>
 #include <fmt/core.h>
@@ -54,7 +52,6 @@
 
 namespace silvanus::generatebox::dialog {
 
-    using applicationPtr = adsk::core::Ptr<adsk::core::Application>;
     using floatSpinnerValueVec = std::vector<double>;
 
     using entities::AxisFlag;
@@ -73,13 +70,11 @@ namespace silvanus::generatebox::dialog {
     using entities::Position;
     using entities::PanelDimensions;
     using entities::PanelDimensionInputs;
-    using entities::MaxOffsetInput;
     using entities::PanelOrientation;
 
     template <class T, class U>
     class Dividers {
 
-            applicationPtr            m_app;
             entt::registry            &m_configuration;
             std::vector<entt::entity> m_dividers;
 
@@ -98,8 +93,7 @@ namespace silvanus::generatebox::dialog {
             std::string m_name_prefix = "Length";
 
         public:
-            Dividers(entt::registry& configuration, applicationPtr& app):
-                m_configuration{configuration}, m_app{app} {};
+            explicit Dividers(entt::registry& configuration): m_configuration{configuration} {};
 
             void create() {
                 m_dividers.clear();
@@ -6,12 +6,9 @@
 #include "entity_helpers.hpp"
 #include "entities/EntitiesAll.hpp"
 
-#include <Core/UserInterface/CommandInput.h>
-
 #include <entt/entt.hpp>
 #include <plog/Log.h>
 
-using namespace adsk::core;
 using namespace silvanus::generatebox::entities;
 using namespace silvanus::generatebox;
 
@@ -0,0 +1,135 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "updateDividers.hpp"
+#include "dividers.hpp"
+
+#include "entities/EntitiesAll.hpp"
+
+#include <plog/Log.h>
+
+using namespace silvanus::generatebox::dialog;
+using namespace silvanus::generatebox::entities;
+
+namespace {
+
+    void updateLengthDividers(entt::registry& registry, DialogSystemManager& systems) {
+        auto orientations = selectedIndex(registry.ctx<DialogDividerOrientationsInput>().control);
+        if (orientations == 2) return;
+
+        auto const divider_length   = registry.ctx<DialogLengthInput>().control->value();
+        auto const divider_inverted = selectedIndex(registry.ctx<DialogDividerJointInput>().control) == 1;
+
+        auto old_view = registry.view<LengthDivider>();
+        registry.destroy(old_view.begin(), old_view.end());
+
+        auto static_view = registry.view<LengthDividerJoint>();
+        registry.destroy(static_view.begin(), static_view.end());
+
+        PLOG_DEBUG << "Updating Length Divider information";
+
+        auto dividers = Dividers<LengthDivider, DialogLengthDividerCountInput>(registry);
+        dividers.setAxis(1, 0, 0);
+        dividers.setMaxOffset(divider_length);
+        dividers.setNamePrefix("Length");
+        dividers.setOrientation(AxisFlag::Length);
+        dividers.addOrientation<LengthOrientation>();
+        dividers.setPriority(2);
+//        dividers.addMaxWidth("width"); // TODO: Convert to user definable width
+//        dividers.addMaxHeight("height"); // TODO: Convert to user definable height
+        dividers.addMaxLength("length"); // TODO: Convert to user definable length & thickness
+        dividers.create();
+
+        auto is_inverted = (orientations == 0 && divider_inverted) || (orientations == 1 && !divider_inverted);
+        auto inside_direction = static_cast<JointDirectionType>(is_inverted);
+        systems.updateCollisions();
+        systems.findJoints<LengthDivider, LengthDividerJoint>();
+        systems.updateJointPatternInputs<LengthDividerJoint, DialogLengthDividerFrontBackJointInput>(AxisFlag::Width);
+        systems.updateJointPatternInputs<LengthDividerJoint, DialogLengthDividerTopBottomJointInput>(AxisFlag::Height);
+        systems.updateJointDirection<LengthDividerJoint>(Position::Outside, Position::Inside, JointDirectionType::Normal);
+        systems.updateJointDirection<LengthDividerJoint>(Position::Inside, Position::Inside, inside_direction);
+    }
+
+    void updateWidthDividers(entt::registry& registry, DialogSystemManager& systems) {
+        auto orientations = selectedIndex(registry.ctx<DialogDividerOrientationsInput>().control);
+        if (orientations == 1) return;
+
+        auto const divider_width    = registry.ctx<DialogWidthInput>().control->value();
+        auto const divider_inverted = selectedIndex(registry.ctx<DialogDividerJointInput>().control) == 1;
+
+        auto old_view = registry.view<WidthDivider>();
+        registry.destroy(old_view.begin(), old_view.end());
+
+        auto static_view = registry.view<WidthDividerJoint>();
+        registry.destroy(static_view.begin(), static_view.end());
+
+        auto dividers = Dividers<WidthDivider, DialogWidthDividerCountInput>(registry);
+        dividers.setAxis(0, 1, 0);
+        dividers.setMaxOffset(divider_width);
+        dividers.setNamePrefix("Width");
+        dividers.setOrientation(AxisFlag::Width);
+        dividers.addOrientation<WidthOrientation>();
+        dividers.setPriority(1);
+//        dividers.addMaxLength("length"); // TODO: Convert to user definable length
+//        dividers.addMaxHeight("height"); // TODO: Convert to user definable height
+        dividers.addMaxWidth("width"); // TODO: Convert to user definable width & thickness
+        dividers.create();
+
+        auto is_inverted = (orientations == 0 && !divider_inverted) || (orientations == 2 && divider_inverted);
+        auto inside_direction = static_cast<JointDirectionType>(is_inverted);
+        systems.updateCollisions();
+        systems.findJoints<WidthDivider, WidthDividerJoint>();
+        systems.updateJointPatternInputs<WidthDividerJoint, DialogWidthDividerLeftRightJointInput>(AxisFlag::Length);
+        systems.updateJointPatternInputs<WidthDividerJoint, DialogWidthDividerTopBottomJointInput>(AxisFlag::Height);
+        systems.updateJointDirection<WidthDividerJoint>(Position::Outside, Position::Inside, JointDirectionType::Normal);
+        systems.updateJointDirection<WidthDividerJoint>(Position::Inside, Position::Inside, inside_direction);
+        systems.postUpdate();
+    }
+
+    void updateHeightDividers(entt::registry& registry, DialogSystemManager& systems) {
+        auto orientations = selectedIndex(registry.ctx<DialogDividerOrientationsInput>().control);
+        if (orientations == 0) return;
+
+        auto const divider_height   = registry.ctx<DialogHeightInput>().control->value();
+        auto const divider_inverted = selectedIndex(registry.ctx<DialogDividerJointInput>().control) == 0;
+
+        auto old_view = registry.view<HeightDivider>();
+        registry.destroy(old_view.begin(), old_view.end());
+
+        auto static_view = registry.view<HeightDividerJoint>();
+        registry.destroy(static_view.begin(), static_view.end());
+
+        PLOG_DEBUG << "Updating Height Divider information";
+
+        auto dividers = Dividers<HeightDivider, DialogHeightDividerCountInput>(registry);
+        dividers.setAxis(0, 0, 1);
+        dividers.setMaxOffset(divider_height);
+        dividers.setNamePrefix("Height");
+        dividers.setOrientation(AxisFlag::Height);
+        dividers.addOrientation<HeightOrientation>();
+        dividers.setPriority(0);
+//        dividers.addMaxLength("length"); // TODO: Convert to user definable length
+//        dividers.addMaxWidth("width"); // TODO: Convert to user definable width
+        dividers.addMaxHeight("height"); // TODO: Convert to user definable height & thickness
+        dividers.create();
+
+        auto is_inverted = (orientations == 1 && divider_inverted) || (orientations == 2 && !divider_inverted);
+        auto inside_direction = static_cast<JointDirectionType>(is_inverted);
+        systems.updateCollisions();
+        systems.findJoints<HeightDivider, HeightDividerJoint>();
+        systems.updateJointPatternInputs<HeightDividerJoint, DialogHeightDividerFrontBackJointInput>(AxisFlag::Width);
+        systems.updateJointPatternInputs<HeightDividerJoint, DialogHeightDividerLeftRightJointInput>(AxisFlag::Length);
+        systems.updateJointDirection<HeightDividerJoint>(Position::Outside, Position::Inside, JointDirectionType::Normal);
+        systems.updateJointDirection<HeightDividerJoint>(Position::Inside, Position::Inside, inside_direction);
+        systems.postUpdate();
+    }
+
+}
+
+void silvanus::generatebox::dialog::updateDividers(entt::registry& configuration, DialogSystemManager& systems) {
+    updateLengthDividers(configuration, systems);
+    updateWidthDividers(configuration, systems);
+    updateHeightDividers(configuration, systems);
+}
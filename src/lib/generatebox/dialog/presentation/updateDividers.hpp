@@ -0,0 +1,22 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_UPDATEDIVIDERS_HPP
+#define SILVANUSPRO_UPDATEDIVIDERS_HPP
+
+#include "dialog/systems/DialogSystemManager.hpp"
+
+#include <entt/entt.hpp>
+
+namespace silvanus::generatebox::dialog {
+
+    // Recreates the divider panels of the configuration from the divider
+    // count, joint and orientation inputs and finds their joints, which is what
+    // the dialog does when any of those inputs change.
+    void updateDividers(entt::registry& configuration, DialogSystemManager& systems);
+
+}
+
+#endif //SILVANUSPRO_UPDATEDIVIDERS_HPP
@@ -163,15 +163,15 @@ auto detectPanelCollisionsImpl(const JointPanelPlanes &first, const JointPanelPl
     auto collision_detected = length_overlaps && width_overlaps && height_overlaps;
 
     PLOG_DEBUG << "Updating panel collision data for " << first.panel.name << " and " << second.panel.name;
-    PLOG_DEBUG << second.panel.name << " length plane:  (" << second_length.min_x << ", " << second_length.min_y << ") to (" << second_length.max_x << ", "
+    PLOG_DEBUG << second.panel.name << " length plane (nm):  (" << second_length.min_x << ", " << second_length.min_y << ") to (" << second_length.max_x << ", "
                << second_length.max_y << ")";
-    PLOG_DEBUG << second.panel.name << " width plane :  (" << second_width.min_x << ", " << second_width.min_y << ") to (" << second_width.max_x << ", "
+    PLOG_DEBUG << second.panel.name << " width plane (nm) :  (" << second_width.min_x << ", " << second_width.min_y << ") to (" << second_width.max_x << ", "
                << second_width.max_y << ")";
-    PLOG_DEBUG << second.panel.name << " height plane:  (" << second_height.min_x << ", " << second_height.min_y << ") to (" << second_height.max_x << ", "
+    PLOG_DEBUG << second.panel.name << " height plane (nm):  (" << second_height.min_x << ", " << second_height.min_y << ") to (" << second_height.max_x << ", "
                << second_height.max_y << ")";
     PLOG_DEBUG << first.panel.name << "(" << first_length.min_x << "," << first_length.min_y << ") panel overlaps with " << second.panel.name << "("
                << second_length.min_x << ","
-               << second_length.min_y << ") panel.";
+               << second_length.min_y << ") panel, in nm.";
 
     auto const length_width_joint = first_orientation == AxisFlag::Length && orientation == AxisFlag::Width;
     auto const length_width_pos   = length_width_joint * (second_length.min_x - first_length.min_x);
@@ -239,15 +239,15 @@ auto detectPanelCollisionsImpl(const JointPanelPlanes &first, const JointPanelPl
 
     PLOG_DEBUG << first.panel.name << (first_is_primary ? " is primary." : " is secondary.");
     PLOG_DEBUG << first.panel.name << " is outside " << second.panel.name << " == " << is_outside;
-    PLOG_DEBUG << "Plane parameters offsets are " << panel_offset << ", " << joint_offset << ", " << joint_distance;
+    PLOG_DEBUG << "Plane parameters offsets are " << toCentimeters(panel_offset) << ", " << toCentimeters(joint_offset) << ", " << toCentimeters(joint_distance);
 
     return {
         collision_detected,
         first_is_primary,
         static_cast<Position>((int)is_outside),
         joint_type,
-        panel_offset,
-        joint_offset,
-        joint_distance
+        toCentimeters(panel_offset),
+        toCentimeters(joint_offset),
+        toCentimeters(joint_distance)
     };
 }
@@ -3,6 +3,8 @@
 // Copyright (c) 2020 Hobbyist Maker. All rights reserved.
 //
 
+#include "initializePanelsFromUserOptions.hpp"
+
 #include "entities/EntitiesAll.hpp"
 
 #include <plog/Log.h>
@@ -17,11 +19,6 @@ using namespace silvanus::generatebox;
 using namespace silvanus::generatebox::entities;
 
 void initializePanelsFromUserOptionsImpl(entt::registry& configuration, entt::registry& panel_registry) {
-    std::map<entt::entity, std::set<entt::entity>> first_index  = {};
-    std::map<entt::entity, std::set<entt::entity>> second_index = {};
-    std::map<entt::entity, entt::entity> primary_joint_index = {};
-    std::map<entt::entity, entt::entity> secondary_joint_index = {};
-
     auto kerf = configuration.ctx<DialogKerfInput>().control->value();
 
     auto thickness_params_view = configuration.view<ThicknessParameter, const PanelThicknessActive>();
@@ -38,6 +35,13 @@ void initializePanelsFromUserOptionsImpl(entt::registry& configuration, entt::re
         panel_registry.emplace<FloatParameter>(param_entity, parameter.name, parameter.control->value(), parameter.control->expression(), parameter.control->unitType());
     }
 
+    initializePanelsFromConfigurationImpl(configuration, panel_registry, kerf);
+}
+
+void initializePanelsFromConfigurationImpl(entt::registry& configuration, entt::registry& panel_registry, double kerf) {
+    std::map<entt::entity, std::set<entt::entity>> first_index  = {};
+    std::map<entt::entity, std::set<entt::entity>> second_index = {};
+
     auto master_view = configuration
         .view<Enabled, FingerPattern, FingerWidth, JointPanels, DialogPanelCollisionData, DialogPanelCollisionDataParams, DialogPanels, JointPattern, PanelPositions, JointDirections>()
         .proxy();
@@ -88,6 +92,8 @@ void initializePanelsFromUserOptionsImpl(entt::registry& configuration, entt::re
         create_panel(joints.second, collision_data.second, collision_param.second, joints.first.entity, {pp.second, pp.first}, jd.second);
     }
 
+    auto& names = nameTable(panel_registry);
+
     auto process_view = configuration.view<
         const PanelEnabled, const Panel, const PanelMaxPoint, const PanelMinPoint, const PanelAxis, const PanelThickness, const ThicknessParameter
     >();
@@ -116,7 +122,7 @@ void initializePanelsFromUserOptionsImpl(entt::registry& configuration, entt::re
         for (auto const &panel: second_panels) {
             PLOG_DEBUG << (int)entity << " to " << (int)panel << ": Adding joint name for " << panel_data.name << " with thickness of " << thickness.value;
             panel_registry.emplace<JointEnabled>(panel, enable.is_true);
-            panel_registry.emplace<JointName>(panel, panel_data.name);
+            panel_registry.emplace<JointName>(panel, names.intern(panel_data.name));
             panel_registry.emplace<JointOrientation>(panel, panel_data.orientation);
             panel_registry.emplace<JointThickness>(panel, thickness.value, thickness_param.name);
             panel_registry.emplace<JointThicknessParameter>(panel, thickness_param.name, thickness_param.unit_type);
@@ -10,4 +10,9 @@
 
 void initializePanelsFromUserOptionsImpl(entt::registry& configuration, entt::registry& registry);
 
+// Builds the panel registry from a configuration registry that already has its panels,
+// planes and joints resolved. Reads no dialog controls, so it also serves configurations
+// that were assembled without a dialog.
+void initializePanelsFromConfigurationImpl(entt::registry& configuration, entt::registry& registry, double kerf);
+
 #endif //SILVANUSPRO_INITIALIZEPANELSFROMUSEROPTIONS_HPP
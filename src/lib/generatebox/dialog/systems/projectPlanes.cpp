@@ -10,6 +10,7 @@
 #include "entities/PanelAxis.hpp"
 #include "entities/PanelMaxPoint.hpp"
 #include "entities/PanelThickness.hpp"
+#include "entities/Quantize.hpp"
 #include "entities/Thickness.hpp"
 
 #include <plog/Log.h>
@@ -32,15 +33,15 @@ void projectPlaneParamsImpl(entt::registry& registry) {
 void projectLengthPlanesImpl(entt::registry& registry) {
     PLOG_DEBUG << "CreateDialog::projectLengthPlane";
 
-    auto length_view = registry.view<PanelPlanes, PanelAxis, PanelThicknessActive, PanelMaxPoint, Panel>();
+    auto length_view = registry.view<PanelPlanes, PanelAxis, PanelThickness, PanelMaxPoint, Panel>();
     for (auto &&[entity, planes, orientation, thickness, dimensions, panel]: length_view.proxy()) {
 
-        planes.length.max_x = round(dimensions.width * 100000) / 100000;
-        planes.length.max_y = round(dimensions.height * 100000) / 100000;
-        planes.length.min_x = (round((planes.length.max_x - thickness.control->value()) * 100000) / 100000) * orientation.width;
-        planes.length.min_y = (round((planes.length.max_y - thickness.control->value()) * 100000) / 100000) * orientation.height;
+        planes.length.max_x = quantize(dimensions.width);
+        planes.length.max_y = quantize(dimensions.height);
+        planes.length.min_x = (planes.length.max_x - quantize(thickness.value)) * orientation.width;
+        planes.length.min_y = (planes.length.max_y - quantize(thickness.value)) * orientation.height;
 
-        PLOG_DEBUG << panel.name << " length plane: (" << planes.length.min_x << ", " << planes.length.min_y << ") to (" << planes.length.max_x << ", "
+        PLOG_DEBUG << panel.name << " length plane (nm): (" << planes.length.min_x << ", " << planes.length.min_y << ") to (" << planes.length.max_x << ", "
                    << planes.length.max_y << ")";
     }
 }
@@ -48,15 +49,15 @@ void projectLengthPlanesImpl(entt::registry& registry) {
 void projectWidthPlanesImpl(entt::registry& registry) {
     PLOG_DEBUG << "CreateDialog::projectWidthPlane";
 
-    auto length_view = registry.view<PanelPlanes, PanelAxis, PanelThicknessActive, PanelMaxPoint, Panel>();
+    auto length_view = registry.view<PanelPlanes, PanelAxis, PanelThickness, PanelMaxPoint, Panel>();
     for (auto &&[entity, planes, orientation, thickness, dimensions, panel]: length_view.proxy()) {
 
-        planes.width.max_x = round(dimensions.length * 100000) / 100000;
-        planes.width.max_y = round(dimensions.height * 100000) / 100000;
-        planes.width.min_x = (round((planes.width.max_x - thickness.control->value()) * 100000) / 100000) * orientation.length;
-        planes.width.min_y = (round((planes.width.max_y - thickness.control->value()) * 100000) / 100000) * orientation.height;
+        planes.width.max_x = quantize(dimensions.length);
+        planes.width.max_y = quantize(dimensions.height);
+        planes.width.min_x = (planes.width.max_x - quantize(thickness.value)) * orientation.length;
+        planes.width.min_y = (planes.width.max_y - quantize(thickness.value)) * orientation.height;
 
-        PLOG_DEBUG << panel.name << " width plane: (" << planes.width.min_x << ", " << planes.width.min_y << ") to (" << planes.width.max_x << ", "
+        PLOG_DEBUG << panel.name << " width plane (nm): (" << planes.width.min_x << ", " << planes.width.min_y << ") to (" << planes.width.max_x << ", "
                    << planes.width.max_y << ")";
     }
 }
@@ -64,15 +65,15 @@ void projectWidthPlanesImpl(entt::registry& registry) {
 void projectHeightPlanesImpl(entt::registry& registry) {
     PLOG_DEBUG << "CreateDialog::projectHeightPlane";
 
-    auto length_view = registry.view<PanelPlanes, PanelAxis, PanelThicknessActive, PanelMaxPoint, Panel>();
+    auto length_view = registry.view<PanelPlanes, PanelAxis, PanelThickness, PanelMaxPoint, Panel>();
     for (auto &&[entity, planes, orientation, thickness, dimensions, panel]: length_view.proxy()) {
 
-        planes.height.max_x = round(dimensions.length * 100000) / 100000;
-        planes.height.max_y = round(dimensions.width * 100000) / 100000;
-        planes.height.min_x = (round((planes.height.max_x - thickness.control->value()) * 100000) / 100000) * orientation.length;
-        planes.height.min_y = (round((planes.height.max_y - thickness.control->value()) * 100000) / 100000) * orientation.width;
+        planes.height.max_x = quantize(dimensions.length);
+        planes.height.max_y = quantize(dimensions.width);
+        planes.height.min_x = (planes.height.max_x - quantize(thickness.value)) * orientation.length;
+        planes.height.min_y = (planes.height.max_y - quantize(thickness.value)) * orientation.width;
 
-        PLOG_DEBUG << panel.name << " height plane: (" << planes.height.min_x << ", " << planes.height.min_y << ") to (" << planes.height.max_x << ", "
+        PLOG_DEBUG << panel.name << " height plane (nm): (" << planes.height.min_x << ", " << planes.height.min_y << ") to (" << planes.height.max_x << ", "
                    << planes.height.max_y << ")";
     }
 }
@@ -16,7 +16,7 @@ using namespace silvanus::generatebox::dialog;
 void updateFingerPatternTypeImpl(entt::registry& registry) {
     auto finger_pattern_view = registry.view<FingerPattern, const DialogFingerMode>().proxy();
     for (auto &&[entity, pattern, finger_mode]: finger_pattern_view) {
-        pattern.value = static_cast<FingerPatternType>(finger_mode.control->selectedItem()->index());
+        pattern.value = static_cast<FingerPatternType>(selectedIndex(finger_mode.control));
         PLOG_DEBUG << "Updating FingerPattern Type for entity " << (int)entity << " == " << (int)pattern.value;
     }
 }
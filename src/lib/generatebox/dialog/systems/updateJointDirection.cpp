@@ -17,7 +17,7 @@ using namespace silvanus::generatebox::dialog;
 void updateJointDirectionImpl(entt::registry& registry) {
     auto direction_view = registry.view<JointDirections, const DialogJointDirectionInputs, const StandardJoint>().proxy();
     for (auto &&[entity, directions, input, standard]: direction_view) {
-        auto result = (bool)input.first.control->selectedItem()->index();
+        auto result = (bool)selectedIndex(input.first.control);
         directions.first = static_cast<JointDirectionType>(result);
         directions.second = static_cast<JointDirectionType>(!result);
         PLOG_DEBUG << "Updating Joint Directions for entity " << (int)entity << ": first(" << (int)directions.first << "), second(" << (int)directions.second << ")";
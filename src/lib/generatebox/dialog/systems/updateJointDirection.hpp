@@ -28,7 +28,7 @@ void updateInsideJointDirectionInputsImpl(entt::registry& registry, bool reverse
         if (positions.first == Position::Outside || positions.second == Position::Outside) continue;
 
         auto control = registry.ctx<P>().control;
-        PLOG_DEBUG << "Adding Joint Direction Input to entity " << (int)entity << " with value: " << control->selectedItem()->index();
+        PLOG_DEBUG << "Adding Joint Direction Input to entity " << (int)entity << " with value: " << selectedIndex(control);
         registry.emplace<DialogJointDirectionInputs>(entity, DialogJointDirectionInput{control, reverse}, DialogJointDirectionInput{control, !reverse});
     }
 }
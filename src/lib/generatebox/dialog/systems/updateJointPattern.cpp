@@ -17,7 +17,7 @@ void updateJointPatternImpl(entt::registry& registry)
 {
     auto joint_pattern_view = registry.view<JointPattern, DialogJointPatternInput>().proxy();
     for (auto &&[entity, pattern, input]: joint_pattern_view) {
-        pattern.value = static_cast<JointPatternType>((int)input.control->selectedItem()->index());
+        pattern.value = static_cast<JointPatternType>(selectedIndex(input.control));
         PLOG_DEBUG << "Updating JointPattern for entity " << (int)entity << " == " << (int)pattern.value;
     }
 
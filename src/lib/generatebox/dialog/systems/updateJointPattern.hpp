@@ -15,20 +15,39 @@ using namespace silvanus::generatebox::entities;
 
 void updateJointPatternImpl(entt::registry& registry);
 
+inline auto isJointPatternInputJoint(
+    const PanelOrientation& panel_orientation, const JointOrientation& joint_orientation, const PanelPositions& panel_positions, AxisFlag orientation
+) -> bool {
+    if (panel_positions.first == Position::Inside && panel_positions.second == Position::Inside) return false;
+    if (panel_positions.first == Position::Outside && panel_orientation.axis != orientation) return false;
+    if (panel_positions.second == Position::Outside && joint_orientation.axis != orientation) return false;
+    return panel_orientation.axis == orientation || joint_orientation.axis == orientation;
+}
+
 template <class T, class P>
 void updateJointPatternInputsImpl(entt::registry& registry, AxisFlag orientation) {
     auto joint_pattern_view = registry.view<PanelOrientation, JointOrientation, PanelPositions, T>().proxy();
     for (auto &&[entity, panel_orientation, joint_orientation, panel_positions, dest]: joint_pattern_view) {
         PLOG_DEBUG << "Checking Joint Pattern Inputs";
-        if (panel_positions.first == Position::Inside && panel_positions.second == Position::Inside) continue;
-        if (panel_positions.first == Position::Outside && panel_orientation.axis != orientation) continue;
-        if (panel_positions.second == Position::Outside && joint_orientation.axis != orientation) continue;
-        if (panel_orientation.axis != orientation && joint_orientation.axis != orientation) continue;
+        if (!isJointPatternInputJoint(panel_orientation, joint_orientation, panel_positions, orientation)) continue;
 
         auto control = registry.ctx<P>().control;
-        PLOG_DEBUG << "Adding Joint Pattern Input to entity " << (int)entity << " with value: " << control->selectedItem()->index();
+        PLOG_DEBUG << "Adding Joint Pattern Input to entity " << (int)entity << " with value: " << selectedIndex(control);
         registry.emplace<DialogJointPatternInput>(entity, control);
     }
 }
 
+// Same selection as updateJointPatternInputsImpl, but writes the pattern straight to the
+// joints for configurations that have no dialog controls behind them.
+template <class T>
+void updateJointPatternValuesImpl(entt::registry& registry, AxisFlag orientation, JointPatternType pattern) {
+    auto joint_pattern_view = registry.view<JointPattern, PanelOrientation, JointOrientation, PanelPositions, T>().proxy();
+    for (auto &&[entity, joint_pattern, panel_orientation, joint_orientation, panel_positions, dest]: joint_pattern_view) {
+        if (!isJointPatternInputJoint(panel_orientation, joint_orientation, panel_positions, orientation)) continue;
+
+        PLOG_DEBUG << "Setting Joint Pattern of entity " << (int)entity << " to " << (int)pattern;
+        joint_pattern.value = pattern;
+    }
+}
+
 #endif //SILVANUSPRO_UPDATEJOINTPATTERN_HPP
@@ -9,13 +9,9 @@
 #include "entities/PanelMax.hpp"
 
 #include <entt/entt.hpp>
-#include <Core/UserInterface/CommandInput.h>
 
-using namespace adsk::core;
 using namespace silvanus::generatebox::entities;
 
-using adsk::core::DefaultModelingOrientations::YUpModelingOrientation;
-
 void updatePanelMinPointFromThickness(entt::registry &registry) {
     registry.view<PanelMinPoint, const PanelMaxPoint, const PanelThickness, const PanelAxis>().each([](
         auto &dimensions, auto const& max_point, auto const& thickness, auto const& normal
@@ -0,0 +1,67 @@
+//
+// Created by Hobbyist Maker on 10/6/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_AXISALGEBRA_HPP
+#define SILVANUSPRO_AXISALGEBRA_HPP
+
+#include "entities/AxisFlag.hpp"
+#include "entities/PanelAxis.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace silvanus::generatebox::entities {
+
+    constexpr auto axisIndex(AxisFlag axis) -> std::size_t {
+        return static_cast<std::size_t>(axis);
+    }
+
+    // The axis perpendicular to both first and second. Two equal axes have
+    // no single complement, and give back the axis itself.
+    constexpr std::array<std::array<AxisFlag, 3>, 3> axis_complements = {{
+        {AxisFlag::Length, AxisFlag::Height, AxisFlag::Width},
+        {AxisFlag::Height, AxisFlag::Width, AxisFlag::Length},
+        {AxisFlag::Width, AxisFlag::Length, AxisFlag::Height}
+    }};
+
+    constexpr auto complementAxis(AxisFlag first, AxisFlag second) -> AxisFlag {
+        return axis_complements[axisIndex(first)][axisIndex(second)];
+    }
+
+    // The box axes a panel's profile length and width run along, for a panel
+    // lying on the given axis.
+    struct ProfileAxes {
+        AxisFlag length;
+        AxisFlag width;
+    };
+
+    constexpr std::array<ProfileAxes, 3> profile_axes = {{
+        {AxisFlag::Width, AxisFlag::Height},
+        {AxisFlag::Length, AxisFlag::Height},
+        {AxisFlag::Length, AxisFlag::Width}
+    }};
+
+    constexpr auto profileAxes(AxisFlag orientation) -> ProfileAxes {
+        return profile_axes[axisIndex(orientation)];
+    }
+
+    // The axis of a PanelAxis, which has exactly one of its flags set.
+    constexpr auto normalAxis(const PanelAxis& normal) -> AxisFlag {
+        return static_cast<AxisFlag>(normal.width + 2 * normal.height);
+    }
+
+    // The length, width or height member of a point, or of its expressions.
+    template <typename T>
+    constexpr auto axisComponent(T& point, AxisFlag axis) -> decltype((point.length)) {
+        using U = std::remove_const_t<T>;
+        constexpr decltype(&U::length) members[] = {&U::length, &U::width, &U::height};
+
+        return point.*members[axisIndex(axis)];
+    }
+
+}
+
+#endif //SILVANUSPRO_AXISALGEBRA_HPP
@@ -9,11 +9,12 @@
 #define SILVANUSPRO_DIALOGINPUTS_HPP
 
 #include "entities/AxisFlag.hpp"
+#include "entities/InputControls.hpp"
+#include "entities/ModelOrientation.hpp"
 #include "entities/Panel.hpp"
 #include "entities/Position.hpp"
+#include "entities/Quantize.hpp"
 
-#include <Core/CoreAll.h>
-#include <Fusion/FusionAll.h>
 #include <entt/entt.hpp>
 #include <map>
 #include <set>
@@ -32,116 +33,116 @@ namespace silvanus::generatebox::entities
     };
 
     struct DialogLengthInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
+        FloatInputControl control;
     };
 
     struct DialogWidthInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
+        FloatInputControl control;
     };
 
     struct DialogHeightInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
+        FloatInputControl control;
     };
 
     struct DialogFingerWidthInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
+        FloatInputControl control;
     };
 
     struct DialogKerfInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
+        FloatInputControl control;
     };
 
     struct DialogModelType {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogFingerMode {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogFastPreviewMode {
-        adsk::core::Ptr<adsk::core::BoolValueCommandInput> control;
+        BoolInputControl control;
     };
 
     struct DialogPanelOverride {
-        adsk::core::Ptr<adsk::core::BoolValueCommandInput> override;
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> thickness;
+        BoolInputControl override;
+        FloatInputControl thickness;
     };
 
     struct DialogFastPreviewLabel {
-        adsk::core::Ptr<adsk::core::TextBoxCommandInput> control;
+        TextInputControl control;
     };
 
     struct DialogFullPreviewMode {
-        adsk::core::Ptr<adsk::core::BoolValueCommandInput> control;
+        BoolInputControl control;
     };
 
     struct DialogFullPreviewLabel {
-        adsk::core::Ptr<adsk::core::TextBoxCommandInput> control;
+        TextInputControl control;
     };
 
     struct DialogLengthDividerGroupInput {
-        adsk::core::Ptr<adsk::core::GroupCommandInput> control;
+        GroupInputControl control;
     };
 
     struct DialogWidthDividerGroupInput {
-        adsk::core::Ptr<adsk::core::GroupCommandInput> control;
+        GroupInputControl control;
     };
 
     struct DialogHeightDividerGroupInput {
-        adsk::core::Ptr<adsk::core::GroupCommandInput> control;
+        GroupInputControl control;
     };
 
     struct DialogStandardJointGroupInput {
-        adsk::core::Ptr<adsk::core::GroupCommandInput> control;
+        GroupInputControl control;
     };
 
     struct DialogDividerOrientationsInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogDividerJointInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogLengthDividerFrontBackJointInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogLengthDividerTopBottomJointInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogWidthDividerLeftRightJointInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogWidthDividerTopBottomJointInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogHeightDividerFrontBackJointInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogHeightDividerLeftRightJointInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogInsetPanelsInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogLengthDividerCountInput {
-        adsk::core::Ptr<adsk::core::IntegerSpinnerCommandInput> control;
+        IntegerInputControl control;
     };
 
     struct DialogWidthDividerCountInput {
-        adsk::core::Ptr<adsk::core::IntegerSpinnerCommandInput> control;
+        IntegerInputControl control;
     };
 
     struct DialogHeightDividerCountInput {
-        adsk::core::Ptr<adsk::core::IntegerSpinnerCommandInput> control;
+        IntegerInputControl control;
     };
 
     struct DialogModelingUnits {
@@ -149,27 +150,27 @@ namespace silvanus::generatebox::entities
     };
 
     struct DialogModelingOrientation {
-        adsk::core::DefaultModelingOrientations value;
+        ModelOrientation value;
     };
 
-    struct DialogCommandInputs {
-        adsk::core::Ptr<adsk::core::CommandInputs> controls;
+    struct DialogCreationMode {
+        ChoiceInputControl control;
     };
 
-    struct DialogApplication {
-        adsk::core::Ptr<adsk::core::Application> value;
+    struct DialogInstancedPanels {
+        BoolInputControl control;
     };
 
-    struct DialogRootComponent {
-        adsk::core::Ptr<adsk::fusion::Component> value;
+    struct DialogUpdateExisting {
+        BoolInputControl control;
     };
 
-    struct DialogCreationMode {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+    struct DialogBoxName {
+        StringInputControl control;
     };
 
     struct DialogJointDirectionInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
         bool reverse = false;
     };
 
@@ -179,23 +180,23 @@ namespace silvanus::generatebox::entities
     };
 
     struct PanelLabelInput {
-        adsk::core::Ptr<adsk::core::TextBoxCommandInput> control;
+        TextInputControl control;
     };
 
     struct PanelEnableInput {
-        adsk::core::Ptr<adsk::core::BoolValueCommandInput> control;
+        BoolInputControl control;
     };
 
     struct PanelOverrideInput {
-        adsk::core::Ptr<adsk::core::BoolValueCommandInput> control;
+        BoolInputControl control;
     };
 
     struct DialogJointPatternInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
+        ChoiceInputControl control;
     };
 
     struct DialogThicknessInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
+        FloatInputControl control;
     };
 
     struct DialogTopThickness : public DialogThicknessInput {};
@@ -226,10 +227,10 @@ namespace silvanus::generatebox::entities
     struct DialogBackPanel : public DialogPanelId {};
 
     struct PanelPlane {
-        double min_x = 0.0;
-        double min_y = 0.0;
-        double max_x = 0.0;
-        double max_y = 0.0;
+        FixedLength min_x = 0;
+        FixedLength min_y = 0;
+        FixedLength max_x = 0;
+        FixedLength max_y = 0;
     };
 
     struct PanelPlaneParams {
@@ -342,13 +343,13 @@ namespace silvanus::generatebox::entities
     };
 
     struct DialogJointPanelOffsetInput {
-        adsk::core::Ptr<adsk::core::TextBoxCommandInput> control;
+        TextInputControl control;
     };
     struct DialogJointJointOffsetInput {
-        adsk::core::Ptr<adsk::core::TextBoxCommandInput> control;
+        TextInputControl control;
     };
     struct DialogJointDistanceOffsetInput {
-        adsk::core::Ptr<adsk::core::TextBoxCommandInput> control;
+        TextInputControl control;
     };
     struct DialogJointIndex {
         std::map<entt::entity, std::set<entt::entity>> first_panels;
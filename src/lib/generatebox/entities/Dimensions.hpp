@@ -5,17 +5,10 @@
 #ifndef SILVANUSPRO_DIMENSIONS_HPP
 #define SILVANUSPRO_DIMENSIONS_HPP
 
-#include "DialogInputs.hpp"
-#include <Core/CoreAll.h>
+#include "entities/Quantize.hpp"
 
 namespace silvanus::generatebox::entities {
 
-    struct DimensionsInputs {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> length;
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> width;
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> height;
-    };
-
     struct Dimensions {
         double length = 0;
         double width = 0;
@@ -29,7 +22,7 @@ namespace silvanus::generatebox::entities {
 
     struct CompareDimension {
         bool operator()(const entities::Dimension &a, const entities::Dimension &b) const {
-            return (a.value < b.value);
+            return quantize(a.value) < quantize(b.value);
         };
     };
 }
@@ -6,6 +6,7 @@
 #ifndef SILVANUSPRO_ENTITIESALL_HPP
 #define SILVANUSPRO_ENTITIESALL_HPP
 
+#include "AxisAlgebra.hpp"
 #include "AxisFlag.hpp"
 #include "BackPanel.hpp"
 #include "BoxParameters.hpp"
@@ -15,7 +16,6 @@
 #include "Enabled.hpp"
 #include "PanelMaxPoint.hpp"
 #include "ExpressionParameterMap.hpp"
-#include "ExtrudeFeature.hpp"
 #include "ExtrusionDistance.hpp"
 #include "FingerPattern.hpp"
 #include "FingerWidth.hpp"
@@ -43,6 +43,7 @@
 #include "Kerf.hpp"
 #include "Length.hpp"
 #include "MaxOffset.hpp"
+#include "NameTable.hpp"
 #include "OrientationGroup.hpp"
 #include "OrientationTags.hpp"
 #include "OutsidePanel.hpp"
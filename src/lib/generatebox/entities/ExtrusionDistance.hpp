@@ -7,6 +7,7 @@
 #define SILVANUSPRO_EXTRUSIONDISTANCE_HPP
 
 #include "entities/Dimensions.hpp"
+#include "entities/Quantize.hpp"
 
 namespace silvanus::generatebox::entities {
 
@@ -21,7 +22,7 @@ namespace silvanus::generatebox::entities {
 
     struct CompareExtrusionDistance {
         bool operator()(const entities::ExtrusionDistance &a, const entities::ExtrusionDistance &b) const {
-            return (a.value < b.value);
+            return quantize(a.value) < quantize(b.value);
         };
     };
 
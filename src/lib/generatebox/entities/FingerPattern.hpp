@@ -5,7 +5,8 @@
 #ifndef SILVANUSPRO_FINGERPATTERN_HPP
 #define SILVANUSPRO_FINGERPATTERN_HPP
 
-#include <Core/UserInterface/DropDownCommandInput.h>
+#include <cstddef>
+#include <functional>
 
 namespace silvanus::generatebox::entities {
 
@@ -17,10 +18,6 @@ namespace silvanus::generatebox::entities {
         FingerPatternType value = FingerPatternType::AutomaticWidth;
     };
 
-    struct FingerPatternInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
-    };
-
     struct FingerPatternTag { bool value = true; };
     struct AutomaticFingerPatternType : public FingerPatternTag {};
     struct ConstantFingerPatternType : public FingerPatternTag {};
@@ -5,8 +5,9 @@
 #ifndef SILVANUSPRO_FINGERWIDTH_HPP
 #define SILVANUSPRO_FINGERWIDTH_HPP
 
-#include <Core/UserInterface/FloatSpinnerCommandInput.h>
-#include <Fusion/FusionAll.h>
+#include "entities/InputControls.hpp"
+
+#include <string>
 
 namespace silvanus::generatebox::entities {
     struct FingerWidth {
@@ -19,35 +20,7 @@ namespace silvanus::generatebox::entities {
 
     struct FingerWidthInput
     {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
-    };
-
-    struct FingerWidthDimension {
-        adsk::core::Ptr<adsk::fusion::ModelParameter> dimension;
-    };
-
-    struct FingerOffsetDimension {
-        adsk::core::Ptr<adsk::fusion::ModelParameter> dimension;
-    };
-
-    struct FingerCutDimension {
-        adsk::core::Ptr<adsk::fusion::ExtrudeFeature> dimension;
-    };
-
-    struct FingerCopyFeature {
-        adsk::core::Ptr<adsk::fusion::RectangularPatternFeature> feature;
-    };
-
-    struct CornerWidthDimension {
-        adsk::core::Ptr<adsk::fusion::ModelParameter> dimension;
-    };
-
-    struct CornerCutDimension {
-        adsk::core::Ptr<adsk::fusion::ExtrudeFeature> dimension;
-    };
-
-    struct CornerCopyFeature {
-        adsk::core::Ptr<adsk::fusion::RectangularPatternFeature> feature;
+        FloatInputControl control;
     };
 
 }
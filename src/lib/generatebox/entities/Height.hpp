@@ -6,8 +6,6 @@
 #ifndef SILVANUSPRO_HEIGHT_HPP
 #define SILVANUSPRO_HEIGHT_HPP
 
-#include <Core/UserInterface/FloatSpinnerCommandInput.h>
-
 #include <string>
 
 namespace silvanus::generatebox::entities {
@@ -27,14 +25,6 @@ namespace silvanus::generatebox::entities {
     struct MaxHeightParam {
         std::string expression;
     };
-
-    struct MinHeightInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
-    };
-
-    struct MaxHeightInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
-    };
 }
 
 #endif //SILVANUSPRO_HEIGHT_HPP
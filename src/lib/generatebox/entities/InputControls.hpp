@@ -0,0 +1,117 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_INPUTCONTROLS_HPP
+#define SILVANUSPRO_INPUTCONTROLS_HPP
+
+// The dialog controls the entities hold. In the add-in they are Fusion's
+// command inputs. SILVANUS_HEADLESS builds, which have no Fusion SDK, get
+// stand-ins with the part of the command input API the dialog and render
+// systems read, so those systems build unchanged and the batch replay can
+// drive them from a recorded dialog log.
+#ifdef SILVANUS_HEADLESS
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace silvanus::generatebox::entities {
+
+    class InputStandIn {
+            std::string m_id;
+            bool        m_enabled = true;
+
+        public:
+            explicit InputStandIn(std::string id) : m_id{std::move(id)} {};
+
+            [[nodiscard]] auto id() const -> std::string { return m_id; }
+            [[nodiscard]] auto isEnabled() const -> bool { return m_enabled; }
+            void isEnabled(bool enabled) { m_enabled = enabled; }
+    };
+
+    template <typename T>
+    class ValueInputStandIn : public InputStandIn {
+            T m_value{};
+
+        public:
+            ValueInputStandIn(std::string id, T value) : InputStandIn{std::move(id)}, m_value{value} {};
+
+            [[nodiscard]] auto value() const -> T { return m_value; }
+            void value(T value) { m_value = value; }
+    };
+
+    class FloatInputStandIn : public ValueInputStandIn<double> {
+            std::string m_expression;
+            std::string m_unit_type;
+
+        public:
+            FloatInputStandIn(std::string id, double value, std::string expression, std::string unit_type = "cm")
+                : ValueInputStandIn{std::move(id), value}, m_expression{std::move(expression)},
+                  m_unit_type{std::move(unit_type)} {};
+
+            [[nodiscard]] auto expression() const -> std::string { return m_expression; }
+            void expression(std::string expression) { m_expression = std::move(expression); }
+            [[nodiscard]] auto unitType() const -> std::string { return m_unit_type; }
+    };
+
+    class ChoiceInputStandIn : public InputStandIn {
+            int m_index = 0;
+
+        public:
+            ChoiceInputStandIn(std::string id, int index) : InputStandIn{std::move(id)}, m_index{index} {};
+
+            [[nodiscard]] auto selectedIndex() const -> int { return m_index; }
+            void selectedIndex(int index) { m_index = index; }
+    };
+
+    // Nothing is shown without Fusion, so progress is dropped.
+    class ProgressStandIn {
+        public:
+            void reset() {}
+            void message(const std::string&) {}
+            void maximumValue(std::size_t) {}
+            void progressValue(std::size_t) {}
+    };
+
+    using FloatInputControl   = std::shared_ptr<FloatInputStandIn>;
+    using BoolInputControl    = std::shared_ptr<ValueInputStandIn<bool>>;
+    using IntegerInputControl = std::shared_ptr<ValueInputStandIn<int>>;
+    using ChoiceInputControl  = std::shared_ptr<ChoiceInputStandIn>;
+    using StringInputControl  = std::shared_ptr<ValueInputStandIn<std::string>>;
+    using TextInputControl    = std::shared_ptr<InputStandIn>;
+    using GroupInputControl   = std::shared_ptr<InputStandIn>;
+    using ProgressControl     = std::shared_ptr<ProgressStandIn>;
+
+    inline auto selectedIndex(const ChoiceInputControl& control) -> int {
+        return control->selectedIndex();
+    }
+
+}
+
+#else
+
+#include <Core/CoreAll.h>
+
+namespace silvanus::generatebox::entities {
+
+    using FloatInputControl   = adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput>;
+    using BoolInputControl    = adsk::core::Ptr<adsk::core::BoolValueCommandInput>;
+    using IntegerInputControl = adsk::core::Ptr<adsk::core::IntegerSpinnerCommandInput>;
+    using ChoiceInputControl  = adsk::core::Ptr<adsk::core::DropDownCommandInput>;
+    using StringInputControl  = adsk::core::Ptr<adsk::core::StringValueCommandInput>;
+    using TextInputControl    = adsk::core::Ptr<adsk::core::TextBoxCommandInput>;
+    using GroupInputControl   = adsk::core::Ptr<adsk::core::GroupCommandInput>;
+    using ProgressControl     = adsk::core::Ptr<adsk::core::ProgressDialog>;
+
+    inline auto selectedIndex(const ChoiceInputControl& control) -> int {
+        return control->selectedItem()->index();
+    }
+
+}
+
+#endif
+
+#endif //SILVANUSPRO_INPUTCONTROLS_HPP
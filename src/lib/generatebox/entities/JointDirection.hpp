@@ -7,6 +7,9 @@
 
 #include "JointPattern.hpp"
 
+#include <cstddef>
+#include <functional>
+
 namespace silvanus::generatebox::entities {
 
     enum class JointDirectionType {
@@ -22,11 +25,6 @@ namespace silvanus::generatebox::entities {
         JointDirectionType second;
     };
 
-    struct JointDirectionInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
-        bool reverse = false;
-    };
-
     struct InverseJointDirection : JointDirection {};
     struct NormalJointDirection : JointDirection {};
 
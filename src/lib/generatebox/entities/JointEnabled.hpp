@@ -6,12 +6,12 @@
 #ifndef SILVANUSPRO_JOINTENABLED_HPP
 #define SILVANUSPRO_JOINTENABLED_HPP
 
-#include <Core/CoreAll.h>
+#include "entities/InputControls.hpp"
 
 namespace silvanus::generatebox::entities {
 
     struct JointEnabledInput {
-        adsk::core::Ptr<adsk::core::BoolValueCommandInput> control;
+        BoolInputControl control;
     };
 
     struct JointEnabled {
@@ -8,6 +8,7 @@
 #include "entities/Dimensions.hpp"
 #include "entities/JointThickness.hpp"
 #include "entities/JointPanelOffset.hpp"
+#include "entities/NameTable.hpp"
 #include <string>
 
 namespace silvanus::generatebox::entities {
@@ -15,7 +16,7 @@ namespace silvanus::generatebox::entities {
         entt::entity       joint_id;
         JointThickness     distance;
         JointPanelOffset   offset;
-        std::string        name;
+        NameId             name;
     };
 
     struct JointExtrusionParams {
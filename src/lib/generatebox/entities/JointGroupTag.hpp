@@ -8,12 +8,14 @@
 
 #include "entities/JointProfile.hpp"
 
-#include <set>
+#include <cstdint>
 
 namespace silvanus::generatebox::entities {
 
+    // Identifies the set of joint profiles on a panel; panels with the same
+    // set share a tag whatever order their joints were configured in.
     struct JointGroupTag {
-        std::set<size_t> value;
+        std::uint64_t value = 0;
     };
 
 }
@@ -5,11 +5,11 @@
 #ifndef SILVANUSPRO_JOINTNAME_HPP
 #define SILVANUSPRO_JOINTNAME_HPP
 
-#include <string>
+#include "entities/NameTable.hpp"
 
 namespace silvanus::generatebox::entities {
     struct JointName {
-        std::string value;
+        NameId value;
     };
 }
 
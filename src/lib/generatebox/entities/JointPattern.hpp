@@ -5,8 +5,6 @@
 #ifndef SILVANUSPRO_JOINTPATTERN_HPP
 #define SILVANUSPRO_JOINTPATTERN_HPP
 
-#include <Core/CoreAll.h>
-
 namespace silvanus::generatebox::entities {
 
     enum class JointPatternType {
@@ -16,10 +14,6 @@ namespace silvanus::generatebox::entities {
     struct JointPattern {
         JointPatternType value;
     };
-
-    struct JointPatternInput {
-        adsk::core::Ptr<adsk::core::DropDownCommandInput> control;
-    };
 }
 
 #endif //SILVANUSPRO_JOINTPATTERN_HPP
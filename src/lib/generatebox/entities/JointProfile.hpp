@@ -11,12 +11,21 @@
 #include "entities/JointPattern.hpp"
 #include "entities/PanelType.hpp"
 #include "entities/Position.hpp"
+#include "entities/Quantize.hpp"
 
 #include "boost/functional/hash.hpp"
 
-#include <set>
+#include <entt/entt.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
 
 namespace silvanus::generatebox::entities {
+    // The expressions behind a JointProfile's values. They stay on the joint's
+    // entity as their own component so the profile itself is cheap to copy,
+    // compare and hash.
     struct JointProfileParams {
         std::string finger_count;
         std::string finger_width;
@@ -42,29 +51,45 @@ namespace silvanus::generatebox::entities {
         AxisFlag           joint_orientation = AxisFlag::Height;
         double             corner_width      = 0;
         double             corner_distance   = 0;
-        JointProfileParams parameters;
-        std::set<size_t>   hashes;
+        entt::entity       parameters        = entt::null; // Entity holding the JointProfileParams, if any.
+
+        // Every field that changes the geometry, with lengths quantized, in a
+        // fixed order. Profiles with the same fingerprint render the same joint.
+        [[nodiscard]] auto fingerprint() const -> std::array<std::int64_t, 14> {
+            return {
+                static_cast<std::int64_t>(panel_position),
+                static_cast<std::int64_t>(joint_position),
+                static_cast<std::int64_t>(joint_direction),
+                static_cast<std::int64_t>(joint_type),
+                static_cast<std::int64_t>(finger_type),
+                static_cast<std::int64_t>(joint_orientation),
+                static_cast<std::int64_t>(panel_orientation),
+                quantize(pattern_distance),
+                quantize(pattern_offset),
+                finger_count,
+                quantize(finger_width),
+                quantize(finger_offset),
+                quantize(corner_width),
+                quantize(corner_distance)
+            };
+        }
 
         bool operator<(const JointProfile &rhs) const {
-            auto lhs_is_less =
-                     (panel_position < rhs.panel_position) &&
-                     (joint_position < rhs.joint_position) &&
-                     (joint_direction < rhs.joint_direction) &&
-                     (joint_type < rhs.joint_type) &&
-                     (finger_type < rhs.finger_type) &&
-                     (joint_orientation < rhs.joint_orientation) &&
-                     (panel_orientation < rhs.panel_orientation) &&
-                     (pattern_distance < rhs.pattern_distance) &&
-                     (pattern_offset < rhs.pattern_offset) &&
-                     (finger_count < rhs.finger_count) &&
-                     (finger_width < rhs.finger_width) &&
-                     (finger_offset < rhs.finger_offset) &&
-                     (corner_width < rhs.corner_width) &&
-                     (corner_distance < rhs.corner_distance);
-            return lhs_is_less;
+            return fingerprint() < rhs.fingerprint();
         }
     };
 
+    static_assert(std::is_trivially_copyable_v<JointProfile>);
+
+    // The expressions behind profile, or empty ones when it has none.
+    inline auto jointProfileParams(entt::registry& registry, const JointProfile& profile) -> const JointProfileParams& {
+        static auto const none = JointProfileParams{};
+        if (profile.parameters == entt::null) return none;
+
+        auto const params = registry.try_get<JointProfileParams>(profile.parameters);
+        return params ? *params : none;
+    }
+
     struct OutsideJointProfile : public JointProfile {
     };
     struct InsideJointProfile : public JointProfile {
@@ -72,22 +97,7 @@ namespace silvanus::generatebox::entities {
 
     struct CompareJointProfile {
         bool operator()(const JointProfile &lhs, const JointProfile &rhs) const {
-            auto lhs_is_less =
-                     (lhs.panel_position < rhs.panel_position) &&
-                     (lhs.joint_position < rhs.joint_position) &&
-                     (lhs.joint_direction < rhs.joint_direction) &&
-                     (lhs.joint_type < rhs.joint_type) &&
-                     (lhs.finger_type < rhs.finger_type) &&
-                     (lhs.joint_orientation < rhs.joint_orientation) &&
-                     (lhs.panel_orientation < rhs.panel_orientation) &&
-                     (lhs.pattern_distance < rhs.pattern_distance) &&
-                     (lhs.pattern_offset < rhs.pattern_offset) &&
-                     (lhs.finger_count < rhs.finger_count) &&
-                     (lhs.finger_width < rhs.finger_width) &&
-                     (lhs.finger_offset < rhs.finger_offset) &&
-                     (lhs.corner_width < rhs.corner_width) &&
-                     (lhs.corner_distance < rhs.corner_distance);
-            return lhs_is_less;
+            return lhs.fingerprint() < rhs.fingerprint();
         }
     };
 
@@ -98,35 +108,8 @@ namespace std {
     class hash<silvanus::generatebox::entities::JointProfile> {
         public:
             std::size_t operator()(silvanus::generatebox::entities::JointProfile const& k) const noexcept {
-                using std::size_t;
-                using std::hash;
-                using std::string;
-                using silvanus::generatebox::entities::AxisFlag;
-                using silvanus::generatebox::entities::FingerPatternType;
-                using silvanus::generatebox::entities::Position;
-                using silvanus::generatebox::entities::JointDirectionType;
-                using silvanus::generatebox::entities::JointPatternType;
-
-                using boost::hash_value;
-                using boost::hash_combine;
-
-                auto seed = std::size_t{0};
-
-                hash_combine(seed, hash_value(k.panel_position));
-                hash_combine(seed, hash_value(k.joint_position));
-                hash_combine(seed, hash_value(k.joint_direction));
-                hash_combine(seed, hash_value(k.joint_type));
-                hash_combine(seed, hash_value(k.finger_type));
-                hash_combine(seed, hash_value(k.finger_count));
-                hash_combine(seed, hash_value(k.finger_width));
-                hash_combine(seed, hash_value(k.pattern_distance));
-                hash_combine(seed, hash_value(k.pattern_offset));
-                hash_combine(seed, hash_value(k.finger_offset));
-                hash_combine(seed, hash_value(k.panel_orientation));
-                hash_combine(seed, hash_value(k.joint_orientation));
-                hash_combine(seed, hash_value(k.corner_width));
-                hash_combine(seed, hash_value(k.corner_distance));
-                return seed;
+                auto const fingerprint = k.fingerprint();
+                return boost::hash_range(fingerprint.begin(), fingerprint.end());
             }
     };
 }
@@ -5,7 +5,9 @@
 #ifndef SILVANUSPRO_JOINTTHICKNESS_HPP
 #define SILVANUSPRO_JOINTTHICKNESS_HPP
 
-#include <Core/UserInterface/BoolValueCommandInput.h>
+#include "entities/Quantize.hpp"
+
+#include <string>
 
 namespace silvanus::generatebox::entities {
     struct JointThickness {
@@ -19,7 +21,7 @@ namespace silvanus::generatebox::entities {
 
     struct CompareJointThickness {
         bool operator()(const entities::JointThickness& lhs, const entities::JointThickness& rhs) const {
-            return (lhs.value < rhs.value);
+            return quantize(lhs.value) < quantize(rhs.value);
         }
     };
 }
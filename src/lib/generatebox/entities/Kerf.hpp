@@ -5,7 +5,7 @@
 #ifndef SILVANUSPRO_KERF_HPP
 #define SILVANUSPRO_KERF_HPP
 
-#include "FloatSpinnerCommandInput.h"
+#include <string>
 
 namespace silvanus::generatebox::entities {
     struct Kerf {
@@ -15,11 +15,6 @@ namespace silvanus::generatebox::entities {
     struct KerfParam {
         std::string expression;
     };
-
-    struct KerfInput
-    {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
-    };
 }
 
 #endif //SILVANUSPRO_KERF_HPP
@@ -6,8 +6,6 @@
 #ifndef SILVANUSPRO_LENGTH_HPP
 #define SILVANUSPRO_LENGTH_HPP
 
-#include <Core/UserInterface/FloatSpinnerCommandInput.h>
-
 #include <string>
 
 namespace silvanus::generatebox::entities {
@@ -27,15 +25,6 @@ namespace silvanus::generatebox::entities {
     struct MaxLengthParam {
         std::string expression;
     };
-
-    struct MinLengthInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
-    };
-
-    struct MaxLengthInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
-    };
-
 }
 
 #endif //SILVANUSPRO_LENGTH_HPP
@@ -0,0 +1,21 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_MODELORIENTATION_HPP
+#define SILVANUSPRO_MODELORIENTATION_HPP
+
+namespace silvanus::generatebox::entities {
+
+    // Which model axis points up, from Fusion's default modeling orientation
+    // preference. The renderers only see this, so they can be built and run
+    // without the Fusion SDK. The values match Fusion's, so the panel group
+    // keys hashed from them are unchanged.
+    enum class ModelOrientation {
+        YUp, ZUp
+    };
+
+}
+
+#endif //SILVANUSPRO_MODELORIENTATION_HPP
@@ -0,0 +1,76 @@
+//
+// Created by Hobbyist Maker on 10/5/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_NAMETABLE_HPP
+#define SILVANUSPRO_NAMETABLE_HPP
+
+#include <entt/entt.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace silvanus::generatebox::entities {
+
+    // A name interned in the registry's NameTable. Id 0 is the empty name.
+    struct NameId {
+        std::uint32_t value = 0;
+
+        bool operator<(const NameId& rhs) const { return value < rhs.value; }
+        bool operator==(const NameId& rhs) const { return value == rhs.value; }
+        bool operator!=(const NameId& rhs) const { return value != rhs.value; }
+    };
+
+    // Every panel and joint name used while configuring and rendering a box is
+    // stored here once, and components carry its NameId. The strings are only
+    // looked up, or joined, when something is logged or a Fusion object named.
+    class NameTable {
+            std::unordered_map<std::string, std::uint32_t> m_index;
+            std::vector<std::string> m_names;
+
+        public:
+            NameTable() {
+                intern("");
+            };
+
+            auto intern(const std::string& name) -> NameId {
+                auto const [found, inserted] = m_index.emplace(name, static_cast<std::uint32_t>(m_names.size()));
+                if (inserted) m_names.push_back(name);
+
+                return {found->second};
+            };
+
+            [[nodiscard]] auto name(NameId id) const -> const std::string& {
+                return m_names[id.value];
+            };
+
+            // Joins the names in alphabetical order, the order a std::set of
+            // the strings themselves would have.
+            [[nodiscard]] auto join(const std::vector<NameId>& ids, const std::string& separator = "-") const -> std::string {
+                auto sorted = std::vector<const std::string*>{};
+                sorted.reserve(ids.size());
+                for (auto const id: ids) sorted.push_back(&m_names[id.value]);
+                std::sort(sorted.begin(), sorted.end(), [](const std::string* lhs, const std::string* rhs) { return *lhs < *rhs; });
+
+                auto joined = std::string{};
+                for (size_t i = 0; i < sorted.size(); ++i) {
+                    if (i > 0) joined += separator;
+                    joined += *sorted[i];
+                }
+
+                return joined;
+            };
+    };
+
+    // The registry's name table, created the first time it is needed.
+    inline auto nameTable(entt::registry& registry) -> NameTable& {
+        return registry.ctx_or_set<NameTable>();
+    }
+
+}
+
+#endif //SILVANUSPRO_NAMETABLE_HPP
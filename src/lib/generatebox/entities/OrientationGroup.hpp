@@ -12,6 +12,7 @@ namespace silvanus::generatebox::entities {
     {
         AxisFlag panel;
         AxisFlag finger;
+        AxisFlag reference; // Perpendicular to both; the pattern distance runs along it.
     };
 }
 
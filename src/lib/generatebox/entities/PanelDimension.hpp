@@ -6,7 +6,7 @@
 #ifndef SILVANUSPRO_PANELDIMENSION_HPP
 #define SILVANUSPRO_PANELDIMENSION_HPP
 
-#include <Core/CoreAll.h>
+#include "entities/InputControls.hpp"
 
 namespace silvanus::generatebox::entities {
 
@@ -17,9 +17,9 @@ namespace silvanus::generatebox::entities {
     };
 
     struct PanelDimensionInputs {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> length;
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> width;
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> height;
+        FloatInputControl length;
+        FloatInputControl width;
+        FloatInputControl height;
     };
 
 }
@@ -7,6 +7,7 @@
 
 #include "entities/Dimensions.hpp"
 #include "entities/ExtrusionDistance.hpp"
+#include "entities/NameTable.hpp"
 #include "entities/PanelOffset.hpp"
 
 #include <string>
@@ -16,7 +17,7 @@ namespace silvanus::generatebox::entities {
         entt::entity       panel_id;
         ExtrusionDistance  distance;
         PanelOffset        offset;
-        std::string        name;
+        NameId             name;
     };
 
     struct PanelExtrusionParams {
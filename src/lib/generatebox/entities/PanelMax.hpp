@@ -6,20 +6,20 @@
 #ifndef SILVANUSPRO_PANELMAX_HPP
 #define SILVANUSPRO_PANELMAX_HPP
 
-#include <Core/UserInterface/FloatSpinnerCommandInput.h>
+#include "entities/InputControls.hpp"
+
+#include <string>
 
 namespace silvanus::generatebox::entities {
 
     struct PanelMaxInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
+        FloatInputControl control;
     };
 
     struct PanelMaxHeightInput : public PanelMaxInput {};
     struct PanelMaxLengthInput : public PanelMaxInput {};
     struct PanelMaxWidthInput : public PanelMaxInput {};
 
-    struct PanelMaxInsetInput : public PanelMaxInput {};
-
     struct PanelMaximums {
         double length;
         double width;
@@ -7,6 +7,8 @@
 
 #include "Dimensions.hpp"
 
+#include <string>
+
 namespace silvanus::generatebox::entities {
     struct PanelMaxPoint {
         double length;
@@ -6,22 +6,10 @@
 #ifndef SILVANUSPRO_PANELMIN_HPP
 #define SILVANUSPRO_PANELMIN_HPP
 
-#include <Core/UserInterface/FloatSpinnerCommandInput.h>
-
 #include <string>
 
 namespace silvanus::generatebox::entities {
 
-    struct PanelMinInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
-    };
-
-    struct PanelMinHeightInput : public PanelMinInput {};
-    struct PanelMinLengthInput : public PanelMinInput {};
-    struct PanelMinWidthInput : public PanelMinInput {};
-
-    struct PanelMinInsetInput : public PanelMinInput {};
-
     struct PanelMinimums {
         double length;
         double width;
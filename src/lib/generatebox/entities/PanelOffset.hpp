@@ -6,10 +6,10 @@
 #ifndef SILVANUSPRO_PANELOFFSET_HPP
 #define SILVANUSPRO_PANELOFFSET_HPP
 
-#include <Core/UserInterface/FloatSpinnerCommandInput.h>
-#include <Fusion/Features/DistanceExtentDefinition.h>
 #include "entities/Dimensions.hpp"
 
+#include <string>
+
 namespace silvanus::generatebox::entities {
 
     struct PanelOffset {
@@ -21,14 +21,6 @@ namespace silvanus::generatebox::entities {
         std::string expression;
     };
 
-    struct PanelOffsetInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
-    };
-
-    struct PanelOffsetDimension {
-        adsk::core::Ptr<adsk::fusion::ModelParameter> dimension;
-    };
-
 }
 
 #endif //SILVANUSPRO_PANELOFFSET_HPP
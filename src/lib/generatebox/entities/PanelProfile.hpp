@@ -6,8 +6,11 @@
 #define SILVANUSPRO_PANELPROFILE_HPP
 
 #include "Dimensions.hpp"
+#include "Quantize.hpp"
 
-#include <Fusion/Sketch/SketchLinearDimension.h>
+#include <array>
+#include <cstdint>
+#include <string>
 
 namespace silvanus::generatebox::entities {
 
@@ -19,6 +22,10 @@ namespace silvanus::generatebox::entities {
     struct PanelProfile {
         PanelProfileDimension length;
         PanelProfileDimension width;
+
+        [[nodiscard]] auto fingerprint() const -> std::array<std::int64_t, 2> {
+            return {quantize(length.value), quantize(width.value)};
+        }
     };
 
     struct PanelProfileParams {
@@ -26,14 +33,9 @@ namespace silvanus::generatebox::entities {
         std::string width;
     };
 
-    struct PanelProfileDimensions {
-        adsk::core::Ptr<adsk::fusion::SketchLinearDimension> length;
-        adsk::core::Ptr<adsk::fusion::SketchLinearDimension> width;
-    };
-
     struct ComparePanelProfile {
         bool operator()(const entities::PanelProfile& a, const entities::PanelProfile& b) const {
-            return (a.length.value < b.length.value) & (a.width.value < b.width.value);
+            return a.fingerprint() < b.fingerprint();
         };
     };
 
@@ -6,6 +6,8 @@
 #ifndef SILVANUSPRO_PANELTHICKNESS_HPP
 #define SILVANUSPRO_PANELTHICKNESS_HPP
 
+#include "entities/InputControls.hpp"
+
 namespace silvanus::generatebox::entities {
 
     struct PanelThickness {
@@ -13,11 +15,11 @@ namespace silvanus::generatebox::entities {
     };
 
     struct PanelThicknessInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
+        FloatInputControl control;
     };
 
     struct PanelThicknessActive {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
+        FloatInputControl control;
     };
 
 }
@@ -6,17 +6,15 @@
 #ifndef SILVANUSPRO_PARAMETER_HPP
 #define SILVANUSPRO_PARAMETER_HPP
 
-#include <Core/UserInterface/FloatSpinnerCommandInput.h>
+#include "entities/InputControls.hpp"
 
 #include <string>
 
-using floatSpinnerPtr = adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput>;
-
 namespace silvanus::generatebox::entities {
 
     struct FloatParameterInput {
-        std::string     name = "parameter";
-        floatSpinnerPtr control;
+        std::string       name = "parameter";
+        FloatInputControl control;
     };
 
     struct FloatParameter {
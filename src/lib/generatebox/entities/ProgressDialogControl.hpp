@@ -6,12 +6,12 @@
 #ifndef SILVANUSPRO_PROGRESSDIALOGCONTROL_HPP
 #define SILVANUSPRO_PROGRESSDIALOGCONTROL_HPP
 
-#include <Core/UserInterface/ProgressDialog.h>
+#include "entities/InputControls.hpp"
 
 namespace silvanus::generatebox::entities {
 
     struct ProgressDialogControl {
-        adsk::core::Ptr<adsk::core::ProgressDialog> control;
+        ProgressControl control;
     };
 
 }
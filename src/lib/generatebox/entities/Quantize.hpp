@@ -0,0 +1,41 @@
+//
+// Created by Hobbyist Maker on 10/4/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_QUANTIZE_HPP
+#define SILVANUSPRO_QUANTIZE_HPP
+
+#include <cmath>
+#include <cstdint>
+
+namespace silvanus::generatebox::entities {
+
+    // Lengths are in centimeters, so this is one nanometer. Profiles whose
+    // lengths only differ by floating point noise quantize to the same value
+    // and are grouped, hashed and rendered as one.
+    constexpr double length_quantum = 1e-7;
+    constexpr double quanta_per_centimeter = 1e7;
+
+    // A length as a whole number of nanometers. Plane bounds and the offsets
+    // derived from them are added, subtracted and compared exactly, and only
+    // turned back into centimeters where they are handed on to Fusion.
+    //
+    // Only the planes are held fixed point. Dimensions, offsets and pattern
+    // values stay doubles in their components, next to the expressions they
+    // are handed to Fusion with, and every comparator, fingerprint and hash
+    // over them quantizes each length first, so ordering and grouping never
+    // see the doubles themselves.
+    using FixedLength = std::int64_t;
+
+    inline auto quantize(double value) -> FixedLength {
+        return std::llround(value * quanta_per_centimeter);
+    }
+
+    constexpr auto toCentimeters(FixedLength value) -> double {
+        return static_cast<double>(value) / quanta_per_centimeter;
+    }
+
+}
+
+#endif //SILVANUSPRO_QUANTIZE_HPP
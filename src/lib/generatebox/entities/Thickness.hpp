@@ -5,7 +5,7 @@
 #ifndef SILVANUSPRO_THICKNESS_HPP
 #define SILVANUSPRO_THICKNESS_HPP
 
-#include "FloatSpinnerCommandInput.h"
+#include <string>
 
 namespace silvanus::generatebox::entities {
 
@@ -13,15 +13,6 @@ namespace silvanus::generatebox::entities {
         double value;
     };
 
-    struct ThicknessInput
-    {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
-    };
-
-    struct HeightThicknessInput : public ThicknessInput {};
-    struct WidthThicknessInput : public ThicknessInput {};
-    struct LengthThicknessInput : public ThicknessInput {};
-
     struct ThicknessParameter {
         std::string name;
         double value;
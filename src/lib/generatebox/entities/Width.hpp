@@ -6,8 +6,6 @@
 #ifndef SILVANUSPRO_WIDTH_HPP
 #define SILVANUSPRO_WIDTH_HPP
 
-#include <Core/UserInterface/FloatSpinnerCommandInput.h>
-
 #include <string>
 
 namespace silvanus::generatebox::entities {
@@ -27,15 +25,6 @@ namespace silvanus::generatebox::entities {
     struct MaxWidthParam {
         std::string expression;
     };
-
-    struct MinWidthInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
-    };
-
-    struct MaxWidthInput {
-        adsk::core::Ptr<adsk::core::FloatSpinnerCommandInput> control;
-    };
-
 }
 
 #endif //SILVANUSPRO_WIDTH_HPP
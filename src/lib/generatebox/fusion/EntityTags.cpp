@@ -0,0 +1,72 @@
+//
+// Created by Hobbyist Maker on 10/2/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "EntityTags.hpp"
+
+#include <plog/Log.h>
+
+#include <algorithm>
+#include <utility>
+
+using namespace adsk::core;
+using namespace adsk::fusion;
+
+using namespace silvanus::generatebox::fusion;
+
+namespace {
+
+    auto timelineObject(const Ptr<Base>& entity) -> Ptr<TimelineObject> {
+        if (auto const feature = Ptr<Feature>{entity}) return feature->timelineObject();
+        if (auto const sketch = Ptr<Sketch>{entity}) return sketch->timelineObject();
+        if (auto const occurrence = Ptr<Occurrence>{entity}) return occurrence->timelineObject();
+        return nullptr;
+    }
+
+    auto deleteEntity(const Ptr<Base>& entity) -> bool {
+        SILVANUS_FUSION_CALL(DeleteEntity);
+        if (auto const feature = Ptr<Feature>{entity}) return feature->deleteMe();
+        if (auto const sketch = Ptr<Sketch>{entity}) return sketch->deleteMe();
+        if (auto const occurrence = Ptr<Occurrence>{entity}) return occurrence->deleteMe();
+        return false;
+    }
+
+}
+
+auto silvanus::generatebox::fusion::findTaggedEntities(
+    const Ptr<Design>& design, const std::string& box
+) -> std::map<std::string, std::vector<Ptr<Base>>> {
+    auto groups = std::map<std::string, std::vector<Ptr<Base>>>{};
+
+    for (auto const& attribute: design->findAttributes(tag_attribute_group, box)) {
+        auto const entity = attribute->parent();
+        if (!entity) continue;
+
+        groups[attribute->value()].emplace_back(entity);
+    }
+
+    PLOG_DEBUG << "Found " << groups.size() << " tagged panel groups of " << box << " in the design";
+    return groups;
+}
+
+void silvanus::generatebox::fusion::deleteTaggedEntities(const std::vector<Ptr<Base>>& entities) {
+    auto ordered = std::vector<std::pair<int, Ptr<Base>>>{};
+
+    for (auto const& entity: entities) {
+        auto const timeline = timelineObject(entity);
+        if (!timeline) continue;
+
+        ordered.emplace_back(timeline->index(), entity);
+    }
+
+    std::sort(ordered.begin(), ordered.end(), [](auto const& lhs, auto const& rhs) {
+        return lhs.first > rhs.first;
+    });
+
+    for (auto const& [index, entity]: ordered) {
+        if (!deleteEntity(entity)) {
+            PLOG_DEBUG << "Unable to delete the tagged entity at timeline position " << index;
+        }
+    }
+}
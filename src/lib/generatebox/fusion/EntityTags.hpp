@@ -0,0 +1,46 @@
+//
+// Created by Hobbyist Maker on 10/2/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_ENTITYTAGS_HPP
+#define SILVANUSPRO_ENTITYTAGS_HPP
+
+#include <Core/CoreAll.h>
+#include <Fusion/FusionAll.h>
+
+#include "FusionCallProfiler.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace silvanus::generatebox::fusion {
+
+    constexpr auto tag_attribute_group = "Silvanus";
+
+    // Tags a generated entity with the key of the panel group it belongs to,
+    // which changes whenever anything the entity was built from changes other
+    // than the user parameter values. The attribute is named after the box, so
+    // boxes of different names in one design never see each other's entities,
+    // and each entity costs a single attribute write.
+    template <class T>
+    void tagEntity(const adsk::core::Ptr<T>& entity, const std::string& box, const std::string& group) {
+        if (!entity) return;
+
+        SILVANUS_FUSION_CALL(AddAttribute);
+        entity->attributes()->add(tag_attribute_group, box, group);
+    }
+
+    // Every entity of one box in the design by the group it belongs to.
+    auto findTaggedEntities(
+        const adsk::core::Ptr<adsk::fusion::Design>& design, const std::string& box
+    ) -> std::map<std::string, std::vector<adsk::core::Ptr<adsk::core::Base>>>;
+
+    // Deletes the features, sketches and occurrences of one group, latest in
+    // the timeline first so nothing is left depending on a deleted entity.
+    void deleteTaggedEntities(const std::vector<adsk::core::Ptr<adsk::core::Base>>& entities);
+
+}
+
+#endif //SILVANUSPRO_ENTITYTAGS_HPP
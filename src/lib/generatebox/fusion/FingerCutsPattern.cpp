@@ -4,6 +4,8 @@
 
 #include "FingerCutsPattern.hpp"
 
+#include "FusionCallProfiler.hpp"
+
 #include "entities/JointProfile.hpp"
 
 #include <Core/CoreAll.h>
@@ -21,7 +23,7 @@ using namespace silvanus::generatebox::fusion;
 
 
 auto FingerCutsPattern::copy(
-    const DefaultModelingOrientations model_orientation,
+    const ModelOrientation model_orientation,
     const std::vector<adsk::core::Ptr<adsk::fusion::ExtrudeFeature>>& features,
     const JointProfile& profile,
     const bool corner
@@ -45,6 +47,7 @@ auto FingerCutsPattern::copy(
         Ptr<ValueInput> count = ValueInput::createByReal(finger_count);
         Ptr<ValueInput> distance = ValueInput::createByReal(pattern_distance);
 
+        SILVANUS_FUSION_CALL(AddPattern);
         Ptr<RectangularPatternFeatures> patterns = m_component->features()->rectangularPatternFeatures();
 
         Ptr<RectangularPatternFeatureInput> pattern_input = patterns->createInput(
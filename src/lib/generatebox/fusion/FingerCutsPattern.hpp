@@ -7,6 +7,7 @@
 
 #include "entities/AxisFlag.hpp"
 #include "entities/JointProfile.hpp"
+#include "entities/ModelOrientation.hpp"
 
 #include <Core/CoreAll.h>
 #include <Fusion/FusionAll.h>
@@ -20,7 +21,7 @@ namespace silvanus::generatebox::fusion {
     using axesList = std::function<adsk::core::Ptr<adsk::fusion::ConstructionAxis>()>;
     using fingerOrientationMap = std::map<entities::AxisFlag, axesList>;
     using panelOrientationMap = std::map<entities::AxisFlag, fingerOrientationMap>;
-    using orientationMap = std::map<adsk::core::DefaultModelingOrientations, panelOrientationMap>;
+    using orientationMap = std::map<entities::ModelOrientation, panelOrientationMap>;
 
     class FingerCutsPattern {
 
@@ -57,15 +58,15 @@ namespace silvanus::generatebox::fusion {
         };
 
         orientationMap m_axes_selector = {
-            {adsk::core::YUpModelingOrientation, m_yup_axes_selector},
-            {adsk::core::ZUpModelingOrientation, m_zup_axes_selector}
+            {entities::ModelOrientation::YUp, m_yup_axes_selector},
+            {entities::ModelOrientation::ZUp, m_zup_axes_selector}
         };
 
     public:
         FingerCutsPattern(const adsk::core::Ptr<adsk::core::Application>& app, const adsk::core::Ptr<adsk::fusion::Component>& component)
             : m_component{component}, m_app{app} {};
         [[nodiscard]] adsk::core::Ptr<adsk::fusion::RectangularPatternFeature> copy(
-            const adsk::core::DefaultModelingOrientations model_orientation,
+            const entities::ModelOrientation model_orientation,
             const std::vector<adsk::core::Ptr<adsk::fusion::ExtrudeFeature>>& features,
             const entities::JointProfile& profile,
             const bool corner
@@ -0,0 +1,123 @@
+//
+// Created by Hobbyist Maker on 9/29/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "FusionApiBackend.hpp"
+
+#include "FusionCallProfiler.hpp"
+
+#include <plog/Log.h>
+
+using namespace adsk::core;
+using namespace adsk::fusion;
+
+using namespace silvanus::generatebox::fusion;
+
+namespace {
+
+    auto toVector(const Vector3& vector) -> Ptr<Vector3D> {
+        return Vector3D::create(vector.x, vector.y, vector.z);
+    }
+
+    auto toPoint(const Vector3& point) -> Ptr<Point3D> {
+        return Point3D::create(point.x, point.y, point.z);
+    }
+
+}
+
+FusionApiBackend::FusionApiBackend(const Ptr<Application>& app)
+    : m_design{app->activeProduct()}, m_temp_mgr{TemporaryBRepManager::get()} {
+    m_bodies = m_design->rootComponent()->bRepBodies();
+}
+
+auto FusionApiBackend::body(BodyHandle handle) const -> const Ptr<BRepBody>& {
+    static auto const invalid = Ptr<BRepBody>{};
+    return handle && handle.index < m_temporary.size() ? m_temporary[handle.index] : invalid;
+}
+
+auto FusionApiBackend::track(const Ptr<BRepBody>& body) -> BodyHandle {
+    if (!body) return BodyHandle{};
+
+    m_temporary.emplace_back(body);
+    return BodyHandle{static_cast<std::uint32_t>(m_temporary.size() - 1)};
+}
+
+auto FusionApiBackend::createBox(const OrientedBox& box) -> BodyHandle {
+    auto const bounding_box = OrientedBoundingBox3D::create(
+        toPoint(box.center), toVector(box.length_direction), toVector(box.width_direction), box.length, box.width, box.height
+    );
+
+    SILVANUS_FUSION_CALL(CreateTemporaryBody);
+    return track(m_temp_mgr->createBox(bounding_box));
+}
+
+auto FusionApiBackend::copyBody(BodyHandle handle) -> BodyHandle {
+    SILVANUS_FUSION_CALL(CopyTemporaryBody);
+    return track(m_temp_mgr->copy(body(handle)));
+}
+
+void FusionApiBackend::translateBody(BodyHandle handle, const Vector3& offset) {
+    SILVANUS_FUSION_CALL(TransformTemporaryBody);
+    auto transform = Matrix3D::create();
+    transform->translation(toVector(offset));
+    m_temp_mgr->transform(body(handle), transform);
+}
+
+void FusionApiBackend::subtractBody(BodyHandle target, BodyHandle tool) {
+    SILVANUS_FUSION_CALL(BooleanOperation);
+    m_temp_mgr->booleanOperation(body(target), body(tool), DifferenceBooleanType);
+}
+
+void FusionApiBackend::addBody(BodyHandle handle, const std::string& name) {
+    auto added = Ptr<BRepBody>{};
+    {
+        SILVANUS_FUSION_CALL(AddBody);
+        added = m_bodies->add(body(handle));
+    }
+    if (!added) {
+        PLOG_DEBUG << "Unable to add " << name;
+        return;
+    }
+
+    SILVANUS_FUSION_CALL(NameEntity);
+    added->name(name);
+}
+
+void FusionApiBackend::indexParameters() {
+    m_parameters_indexed = true;
+
+    auto const parameters = m_design->allParameters();
+    for (size_t i = 0; i < parameters->count(); ++i) {
+        auto const parameter = parameters->item(i);
+        m_parameters.emplace(parameter->name(), parameter);
+    }
+}
+
+auto FusionApiBackend::setUserParameter(const std::string& name, const std::string& expression, const std::string& units) -> bool {
+    if (!m_parameters_indexed) indexParameters();
+
+    auto const existing = m_parameters.find(name);
+    if (existing != m_parameters.end()) {
+        auto const& parameter = existing->second;
+        auto const  same_expression = parameter->expression() == expression;
+        auto const  same_units      = parameter->unit() == units;
+
+        if (same_expression && same_units) return false;
+
+        PLOG_DEBUG << "Updating parameter for " << name;
+        SILVANUS_FUSION_CALL(WriteExpression);
+        if (!same_units) parameter->unit(units);
+        if (!same_expression) parameter->expression(expression);
+        return true;
+    }
+
+    PLOG_DEBUG << "Creating new parameter for " << name;
+    auto parameter = Ptr<UserParameter>{};
+    {
+        SILVANUS_FUSION_CALL(AddUserParameter);
+        parameter = m_design->userParameters()->add(name, ValueInput::createByString(expression), units, "");
+    }
+    if (parameter) m_parameters.emplace(name, parameter);
+    return true;
+}
@@ -0,0 +1,53 @@
+//
+// Created by Hobbyist Maker on 9/29/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_FUSIONAPIBACKEND_HPP
+#define SILVANUSPRO_FUSIONAPIBACKEND_HPP
+
+#include "FusionBackend.hpp"
+
+#include <Core/CoreAll.h>
+#include <Fusion/FusionAll.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace silvanus::generatebox::fusion {
+
+    // Builds bodies with the TemporaryBRepManager and adds them to the root
+    // component of the active design.
+    class FusionApiBackend : public FusionBackend {
+
+            adsk::core::Ptr<adsk::fusion::Design>               m_design;
+            adsk::core::Ptr<adsk::fusion::TemporaryBRepManager> m_temp_mgr;
+            adsk::core::Ptr<adsk::fusion::BRepBodies>           m_bodies;
+
+            std::vector<adsk::core::Ptr<adsk::fusion::BRepBody>> m_temporary;
+
+            // Every design parameter by name, read the first time one is set.
+            std::map<std::string, adsk::core::Ptr<adsk::fusion::Parameter>> m_parameters;
+            bool                                                           m_parameters_indexed = false;
+
+            void indexParameters();
+
+            auto body(BodyHandle handle) const -> const adsk::core::Ptr<adsk::fusion::BRepBody>&;
+            auto track(const adsk::core::Ptr<adsk::fusion::BRepBody>& body) -> BodyHandle;
+
+        public:
+            explicit FusionApiBackend(const adsk::core::Ptr<adsk::core::Application>& app);
+
+            auto createBox(const OrientedBox& box) -> BodyHandle override;
+            auto copyBody(BodyHandle body) -> BodyHandle override;
+            void translateBody(BodyHandle body, const Vector3& offset) override;
+            void subtractBody(BodyHandle target, BodyHandle tool) override;
+            void addBody(BodyHandle body, const std::string& name) override;
+
+            auto setUserParameter(const std::string& name, const std::string& expression, const std::string& units) -> bool override;
+    };
+
+}
+
+#endif //SILVANUSPRO_FUSIONAPIBACKEND_HPP
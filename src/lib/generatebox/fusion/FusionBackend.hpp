@@ -0,0 +1,72 @@
+//
+// Created by Hobbyist Maker on 9/29/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_FUSIONBACKEND_HPP
+#define SILVANUSPRO_FUSIONBACKEND_HPP
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace silvanus::generatebox::fusion {
+
+    struct Vector3 {
+        double x = 0;
+        double y = 0;
+        double z = 0;
+    };
+
+    // A box around center, length along length_direction, width along
+    // width_direction and height along their cross product, like Fusion's
+    // OrientedBoundingBox3D.
+    struct OrientedBox {
+        Vector3 center;
+        Vector3 length_direction;
+        Vector3 width_direction;
+        double  length = 0;
+        double  width  = 0;
+        double  height = 0;
+    };
+
+    // Refers to a body owned by a backend. A default constructed handle is
+    // invalid, which is what createBox returns when the box cannot be built.
+    struct BodyHandle {
+        std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+
+        explicit operator bool() const { return index != std::numeric_limits<std::uint32_t>::max(); };
+    };
+
+    // The Fusion operations of the direct renderer, plus the user parameters
+    // every renderer writes. Bodies are temporary until addBody puts them in
+    // the design, so they can be combined freely without touching the
+    // timeline. FusionApiBackend forwards every call to Fusion and
+    // RecordingBackend keeps everything in memory, which lets the direct
+    // renderer run and be measured without a Fusion session.
+    //
+    // Sketches, extrudes and patterns are not part of it. The parametric and
+    // outline renderers drive their features through the dimensions and
+    // parameters Fusion hands back, which an in-memory stand-in cannot solve,
+    // so they still call Fusion directly and are measured by
+    // FusionCallProfiler inside a Fusion session instead.
+    class FusionBackend {
+        public:
+            virtual ~FusionBackend() = default;
+
+            virtual auto createBox(const OrientedBox& box) -> BodyHandle = 0;
+            virtual auto copyBody(BodyHandle body) -> BodyHandle = 0;
+            virtual void translateBody(BodyHandle body, const Vector3& offset) = 0;
+            virtual void subtractBody(BodyHandle target, BodyHandle tool) = 0;
+            virtual void addBody(BodyHandle body, const std::string& name) = 0;
+
+            // Updates the expression of an existing design parameter or adds a
+            // user parameter with it. A parameter that already has the same
+            // expression and units is left alone, so nothing depending on it is
+            // recomputed; returns whether the design was written to.
+            virtual auto setUserParameter(const std::string& name, const std::string& expression, const std::string& units) -> bool = 0;
+    };
+
+}
+
+#endif //SILVANUSPRO_FUSIONBACKEND_HPP
@@ -0,0 +1,120 @@
+//
+// Created by Hobbyist Maker on 9/30/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "FusionCallProfiler.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <numeric>
+
+using namespace silvanus::generatebox::fusion;
+
+namespace {
+
+    auto profile() -> std::array<FusionCallStats, fusion_call_count>& {
+        static auto stats = std::array<FusionCallStats, fusion_call_count>{};
+        return stats;
+    }
+
+    auto milliseconds(std::chrono::nanoseconds duration) -> double {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+}
+
+auto silvanus::generatebox::fusion::fusionCallName(FusionCall call) -> const char* {
+    switch (call) {
+        case FusionCall::CreateSketch:
+            return "create sketch";
+        case FusionCall::ComputeSketch:
+            return "compute sketch";
+        case FusionCall::DrawSketchLines:
+            return "draw sketch lines";
+        case FusionCall::AddConstraint:
+            return "add constraint";
+        case FusionCall::AddDimension:
+            return "add dimension";
+        case FusionCall::CreateExtrudeInput:
+            return "create extrude input";
+        case FusionCall::AddExtrude:
+            return "add extrude";
+        case FusionCall::AddPattern:
+            return "add pattern";
+        case FusionCall::WriteExpression:
+            return "write expression";
+        case FusionCall::NameEntity:
+            return "name entity";
+        case FusionCall::AddTimelineGroup:
+            return "add timeline group";
+        case FusionCall::CreateTemporaryBody:
+            return "create temporary body";
+        case FusionCall::CopyTemporaryBody:
+            return "copy temporary body";
+        case FusionCall::TransformTemporaryBody:
+            return "transform temporary body";
+        case FusionCall::BooleanOperation:
+            return "boolean operation";
+        case FusionCall::AddBody:
+            return "add body";
+        case FusionCall::AddUserParameter:
+            return "add user parameter";
+        case FusionCall::AddOccurrence:
+            return "add occurrence";
+        case FusionCall::ComputeDesign:
+            return "compute design";
+        case FusionCall::AddAttribute:
+            return "add attribute";
+        case FusionCall::DeleteEntity:
+            return "delete entity";
+        default:
+            return "add custom graphics";
+    }
+}
+
+void FusionCallProfiler::record(FusionCall call, std::chrono::nanoseconds duration) {
+    auto& stats = profile()[static_cast<size_t>(call)];
+
+    ++stats.count;
+    stats.total += duration;
+    stats.max = std::max(stats.max, duration);
+}
+
+void FusionCallProfiler::reset() {
+    profile().fill({});
+}
+
+auto FusionCallProfiler::stats() -> const std::array<FusionCallStats, fusion_call_count>& {
+    return profile();
+}
+
+void FusionCallProfiler::writeSummary(std::ostream& stream) {
+    auto const& stats = profile();
+
+    auto order = std::array<size_t, fusion_call_count>{};
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&stats](size_t lhs, size_t rhs) {
+        return stats[lhs].total > stats[rhs].total;
+    });
+
+    auto calls = size_t{0};
+    auto total = std::chrono::nanoseconds{0};
+
+    stream << fmt::format("{:<26}{:>8}{:>12}{:>10}{:>10}\n", "fusion call", "count", "total ms", "mean ms", "max ms");
+    for (auto const index: order) {
+        auto const& call = stats[index];
+        if (call.count == 0) continue;
+
+        stream << fmt::format(
+            "{:<26}{:>8}{:>12.2f}{:>10.3f}{:>10.3f}\n",
+            fusionCallName(static_cast<FusionCall>(index)), call.count, milliseconds(call.total),
+            milliseconds(call.total) / call.count, milliseconds(call.max)
+        );
+
+        calls += call.count;
+        total += call.total;
+    }
+    stream << fmt::format("{:<26}{:>8}{:>12.2f}\n", "total", calls, milliseconds(total));
+}
@@ -0,0 +1,76 @@
+//
+// Created by Hobbyist Maker on 9/30/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_FUSIONCALLPROFILER_HPP
+#define SILVANUSPRO_FUSIONCALLPROFILER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace silvanus::generatebox::fusion {
+
+    enum class FusionCall : std::uint8_t {
+        CreateSketch, ComputeSketch, DrawSketchLines, AddConstraint, AddDimension,
+        CreateExtrudeInput, AddExtrude, AddPattern, WriteExpression, NameEntity, AddTimelineGroup,
+        CreateTemporaryBody, CopyTemporaryBody, TransformTemporaryBody, BooleanOperation, AddBody,
+        AddUserParameter, AddOccurrence, ComputeDesign, AddAttribute, DeleteEntity, AddCustomGraphics
+    };
+
+    constexpr size_t fusion_call_count = 22;
+
+    auto fusionCallName(FusionCall call) -> const char*;
+
+    struct FusionCallStats {
+        size_t                   count = 0;
+        std::chrono::nanoseconds total{0};
+        std::chrono::nanoseconds max{0};
+    };
+
+    // Totals of every timed Fusion call since the last reset. Fusion only
+    // calls the add-in from its main thread, so nothing here is synchronized.
+    class FusionCallProfiler {
+        public:
+            static void record(FusionCall call, std::chrono::nanoseconds duration);
+            static void reset();
+
+            [[nodiscard]] static auto stats() -> const std::array<FusionCallStats, fusion_call_count>&;
+
+            // One row per call type that was made, slowest total first.
+            static void writeSummary(std::ostream& stream);
+    };
+
+    class FusionCallScope {
+            using clock = std::chrono::steady_clock;
+
+            FusionCall        m_call;
+            clock::time_point m_start;
+
+        public:
+            explicit FusionCallScope(FusionCall call) : m_call{call}, m_start{clock::now()} {};
+            ~FusionCallScope() { FusionCallProfiler::record(m_call, clock::now() - m_start); };
+
+            FusionCallScope(const FusionCallScope&) = delete;
+            auto operator=(const FusionCallScope&) -> FusionCallScope& = delete;
+    };
+
+}
+
+// Times the rest of the enclosing scope as one call of the given FusionCall.
+// Unless the add-in is built with SILVANUS_PROFILE_FUSION these expand to
+// nothing, so the call sites cost nothing in a normal build.
+#ifdef SILVANUS_PROFILE_FUSION
+#define SILVANUS_FUSION_CALL_SCOPE_NAME(line) silvanus_fusion_call_scope_##line
+#define SILVANUS_FUSION_CALL_SCOPE(line, call) \
+    ::silvanus::generatebox::fusion::FusionCallScope SILVANUS_FUSION_CALL_SCOPE_NAME(line){::silvanus::generatebox::fusion::FusionCall::call}
+#define SILVANUS_FUSION_CALL(call) SILVANUS_FUSION_CALL_SCOPE(__LINE__, call)
+#define SILVANUS_FUSION_PROFILE_RESET() ::silvanus::generatebox::fusion::FusionCallProfiler::reset()
+#else
+#define SILVANUS_FUSION_CALL(call) static_cast<void>(0)
+#define SILVANUS_FUSION_PROFILE_RESET() static_cast<void>(0)
+#endif
+
+#endif //SILVANUSPRO_FUSIONCALLPROFILER_HPP
@@ -7,7 +7,9 @@
 
 #include "FusionSketch.hpp"
 
+#include "FusionCallProfiler.hpp"
 #include "FusionSupport.hpp"
+#include "RenderSession.hpp"
 
 #include <algorithm>
 #include <unordered_map>
@@ -21,31 +23,52 @@ using namespace silvanus::generatebox::entities;
 using namespace silvanus::generatebox::fusion;
 
 FusionSketch::FusionSketch(const string& name, const Ptr<BRepFace>& source, bool construction) : m_name{name} {
-    m_sketch = source->body()->parentComponent()->sketches()->add(source);
+    {
+        SILVANUS_FUSION_CALL(CreateSketch);
+        m_sketch = source->body()->parentComponent()->sketches()->add(source);
+    }
     initialize_sketch(name, construction);
 }
 
 FusionSketch::FusionSketch(const string& name, const Ptr<ConstructionPlane>& source, bool construction) : m_name{name} {
-    m_sketch = source->component()->sketches()->add(source);
+    {
+        SILVANUS_FUSION_CALL(CreateSketch);
+        m_sketch = source->component()->sketches()->add(source);
+    }
     initialize_sketch(name, construction);
 }
 
 FusionSketch::FusionSketch(const string& name, const faceSelector& selector, const Ptr<ExtrudeFeature>& feature, bool construction) : m_name{name} {
     auto source = selector(feature->bodies()->item(0));
-    m_sketch = source->body()->parentComponent()->sketches()->add(source);
+    {
+        SILVANUS_FUSION_CALL(CreateSketch);
+        m_sketch = source->body()->parentComponent()->sketches()->add(source);
+    }
     initialize_sketch(name, construction);
 }
 
 FusionSketch::~FusionSketch() {
+    if (auto const session = RenderSession::active()) {
+        session->computeSketch(m_sketch);
+        return;
+    }
+
+    SILVANUS_FUSION_CALL(ComputeSketch);
     m_sketch->isComputeDeferred(false);
 }
 
 void FusionSketch::initialize_sketch(const string& name, bool construction) {
-    m_sketch->name(name);
+    {
+        SILVANUS_FUSION_CALL(NameEntity);
+        m_sketch->name(name);
+    }
     m_sketch->isComputeDeferred(true);
 
     for (auto const& line: m_sketch->sketchCurves()->sketchLines()) {
-        line->isConstruction(construction);
+        {
+            SILVANUS_FUSION_CALL(DrawSketchLines);
+            line->isConstruction(construction);
+        }
 
         for (auto const& point: {line->startSketchPoint(), line->endSketchPoint()}) {
             m_default_sketch_points.emplace_back(point);
@@ -61,17 +84,21 @@ void FusionSketch::initialize_sketch(const string& name, bool construction) {
 }
 
 void FusionSketch::addExtrusionSideConstraints(const Ptr<SketchLineList> &lines) {
+    auto addCollinear = [this](const Ptr<SketchLine>& lhs, const Ptr<SketchLine>& rhs) {
+        SILVANUS_FUSION_CALL(AddConstraint);
+        m_sketch->geometricConstraints()->addCollinear(lhs, rhs);
+    };
 
     if (isVerticalSketch()) {
         auto first_sketch_line = m_sketch->sketchCurves()->sketchLines()->item(1);
         auto second_sketch_line = m_sketch->sketchCurves()->sketchLines()->item(3);
-        m_sketch->geometricConstraints()->addCollinear(first_sketch_line, lines->item(1));
-        m_sketch->geometricConstraints()->addCollinear(second_sketch_line, lines->item(3));
+        addCollinear(first_sketch_line, lines->item(1));
+        addCollinear(second_sketch_line, lines->item(3));
     } else {
         auto first_sketch_line = m_sketch->sketchCurves()->sketchLines()->item(0);
         auto second_sketch_line = m_sketch->sketchCurves()->sketchLines()->item(2);
-        m_sketch->geometricConstraints()->addCollinear(first_sketch_line, lines->item(0));
-        m_sketch->geometricConstraints()->addCollinear(second_sketch_line, lines->item(2));
+        addCollinear(first_sketch_line, lines->item(0));
+        addCollinear(second_sketch_line, lines->item(2));
     }
 }
 
@@ -79,8 +106,8 @@ void FusionSketch::addGeometricConstraints(const Ptr<SketchLineList>& lines) {
     auto constraints = m_sketch->geometricConstraints();
 
     auto selector = std::unordered_map<bool, std::function<Ptr<HorizontalConstraint>(Ptr<SketchLine>)>>{
-            {true, [&](const Ptr<SketchLine>& line){ return constraints->addVertical(line); } },
-            {false, [&](const Ptr<SketchLine>& line){ return constraints->addHorizontal(line); } }
+            {true, [&](const Ptr<SketchLine>& line){ SILVANUS_FUSION_CALL(AddConstraint); return constraints->addVertical(line); } },
+            {false, [&](const Ptr<SketchLine>& line){ SILVANUS_FUSION_CALL(AddConstraint); return constraints->addHorizontal(line); } }
     };
 
     for (auto& line: lines) {
@@ -105,6 +132,7 @@ void FusionSketch::addFaceOriginConstraint(const Ptr<SketchLineList>& lines, con
 
     for (auto& line: lines) {
         if (pointsAreEqual(origin, line->startSketchPoint()->geometry())) {
+            SILVANUS_FUSION_CALL(AddConstraint);
             m_sketch->geometricConstraints()->addCoincident(
                     point, line->startSketchPoint()
             );
@@ -137,6 +165,7 @@ auto FusionSketch::addDistanceDimension(const Ptr<SketchLine>& line) -> Ptr<Sket
     text_point->x(text_point->x() - 1);
     text_point->y(text_point->y() - 1);
 
+    SILVANUS_FUSION_CALL(AddDimension);
     return m_sketch->sketchDimensions()->addDistanceDimension(
             line->startSketchPoint(), line->endSketchPoint(), AlignedDimensionOrientation, text_point
     );
@@ -152,6 +181,7 @@ auto FusionSketch::addDistanceDimension(const Ptr<SketchLine>& line, const Ptr<S
 
     auto text_point = Point3D::create(lhs_x + text_x, lhs_y + text_y, lhs->geometry()->z());
 
+    SILVANUS_FUSION_CALL(AddDimension);
     return m_sketch->sketchDimensions()->addDistanceDimension(
         line->startSketchPoint(), line->endSketchPoint(), AlignedDimensionOrientation, text_point
     );
@@ -162,6 +192,7 @@ auto FusionSketch::addDistanceDimension(const Ptr<SketchPoint>& lhs, const Ptr<S
     text_point->x(text_point->x() - 1);
     text_point->y(text_point->y() - 1);
 
+    SILVANUS_FUSION_CALL(AddDimension);
     return m_sketch->sketchDimensions()->addDistanceDimension(
         lhs, rhs, AlignedDimensionOrientation, text_point
     );
@@ -176,6 +207,7 @@ auto FusionSketch::addDistanceDimension(const Ptr<SketchPoint>& lhs, const Ptr<S
 
     auto text_point = Point3D::create(lhs_x + text_x, lhs_y + text_y, lhs->geometry()->z());
 
+    SILVANUS_FUSION_CALL(AddDimension);
     return m_sketch->sketchDimensions()->addDistanceDimension(
         lhs, rhs, AlignedDimensionOrientation, text_point
     );
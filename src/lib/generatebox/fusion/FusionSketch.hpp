@@ -102,6 +102,7 @@ namespace silvanus::generatebox::fusion {
             FusionSketch(const std::string& name, const faceSelector& selector, const adsk::core::Ptr<adsk::fusion::ExtrudeFeature>& body, bool construction);
             ~FusionSketch();
 
+            [[nodiscard]] adsk::core::Ptr<adsk::fusion::Sketch> sketch() const { return m_sketch; };
             [[nodiscard]] adsk::core::Ptr<adsk::fusion::Profiles> profiles() const { return m_sketch->profiles(); };
             [[nodiscard]] adsk::core::Ptr<adsk::fusion::ExtrudeFeature> cutJoint(
                 const entities::JointPanelOffset& offset,
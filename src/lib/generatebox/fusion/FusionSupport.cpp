@@ -6,6 +6,7 @@
 //
 
 #include "FusionSupport.hpp"
+#include "FusionCallProfiler.hpp"
 #include "entities/Dimensions.hpp"
 #include "entities/JointThickness.hpp"
 #include "entities/PanelOffset.hpp"
@@ -21,7 +22,7 @@ using namespace silvanus::generatebox::fusion;
 
 auto silvanus::generatebox::fusion::createSimpleExtrusion(
         const adsk::core::Ptr<adsk::fusion::Sketch>& sketch,
-        const adsk::core::Ptr<adsk::fusion::Profile>& profile,
+        const adsk::core::Ptr<adsk::core::Base>& profile,
         const ExtrusionDistance& extrusion_distance,
         const PanelOffset& panel_offset
 ) -> adsk::core::Ptr<ExtrudeFeatureInput> {
@@ -34,6 +35,7 @@ auto silvanus::generatebox::fusion::createSimpleExtrusion(
     auto extent = DistanceExtentDefinition::create(distance);
     auto start = FromEntityStartDefinition::create(sketch->referencePlane(), offset);
 
+    SILVANUS_FUSION_CALL(CreateExtrudeInput);
     auto input = sketch->parentComponent()->features()->extrudeFeatures()->createInput(profile, NewBodyFeatureOperation);
     input->setOneSideExtent(extent, PositiveExtentDirection);
     input->startExtent(start);
@@ -57,6 +59,7 @@ auto silvanus::generatebox::fusion::createSimpleExtrusion(
     auto extent = DistanceExtentDefinition::create(distance);
     auto start = FromEntityStartDefinition::create(face, offset);
 
+    SILVANUS_FUSION_CALL(CreateExtrudeInput);
     auto input = face->body()->parentComponent()->features()->extrudeFeatures()->createInput(face, NewBodyFeatureOperation);
     input->setOneSideExtent(extent, PositiveExtentDirection);
     input->startExtent(start);
@@ -85,6 +88,7 @@ auto silvanus::generatebox::fusion::createSimpleExtrusion(
     auto extent = DistanceExtentDefinition::create(distance);
     auto start = FromEntityStartDefinition::create(face, offset);
 
+    SILVANUS_FUSION_CALL(CreateExtrudeInput);
     auto input = face->body()->parentComponent()->features()->extrudeFeatures()->createInput(face, NewBodyFeatureOperation);
     input->setOneSideExtent(extent, PositiveExtentDirection);
     input->startExtent(start);
@@ -93,7 +97,7 @@ auto silvanus::generatebox::fusion::createSimpleExtrusion(
 
 auto silvanus::generatebox::fusion::cutSimpleExtrusion(
     const adsk::core::Ptr<Sketch>& sketch,
-    const adsk::core::Ptr<Profile>& profile,
+    const adsk::core::Ptr<Base>& profile,
     const double extrusion_distance,
     const double panel_offset,
     const adsk::core::Ptr<BRepBody>& body
@@ -104,11 +108,16 @@ auto silvanus::generatebox::fusion::cutSimpleExtrusion(
     auto extent = DistanceExtentDefinition::create(distance);
     auto start = FromEntityStartDefinition::create(sketch->referencePlane(), offset);
 
-    auto input = sketch->parentComponent()->features()->extrudeFeatures()->createInput(profile, CutFeatureOperation);
-    input->setOneSideExtent(extent, NegativeExtentDirection);
-    input->startExtent(start);
-    input->participantBodies({body});
+    auto input = Ptr<ExtrudeFeatureInput>{};
+    {
+        SILVANUS_FUSION_CALL(CreateExtrudeInput);
+        input = sketch->parentComponent()->features()->extrudeFeatures()->createInput(profile, CutFeatureOperation);
+        input->setOneSideExtent(extent, NegativeExtentDirection);
+        input->startExtent(start);
+        input->participantBodies({body});
+    }
 
+    SILVANUS_FUSION_CALL(AddExtrude);
     return sketch->parentComponent()->features()->extrudeFeatures()->add(input);
 }
 
@@ -124,10 +133,15 @@ auto silvanus::generatebox::fusion::cutSimpleExtrusion(
     auto extent = DistanceExtentDefinition::create(distance_input);
     auto start = FromEntityStartDefinition::create(sketch->referencePlane(), offset_input);
 
-    auto input = sketch->parentComponent()->features()->extrudeFeatures()->createInput(profile, CutFeatureOperation);
-    input->setOneSideExtent(extent, NegativeExtentDirection);
-    input->startExtent(start);
-    input->participantBodies({body});
+    auto input = Ptr<ExtrudeFeatureInput>{};
+    {
+        SILVANUS_FUSION_CALL(CreateExtrudeInput);
+        input = sketch->parentComponent()->features()->extrudeFeatures()->createInput(profile, CutFeatureOperation);
+        input->setOneSideExtent(extent, NegativeExtentDirection);
+        input->startExtent(start);
+        input->participantBodies({body});
+    }
 
+    SILVANUS_FUSION_CALL(AddExtrude);
     return sketch->parentComponent()->features()->extrudeFeatures()->add(input);
 }
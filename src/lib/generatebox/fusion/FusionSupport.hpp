@@ -18,6 +18,7 @@
 #include "entities/JointThickness.hpp"
 #include "entities/JointPanel.hpp"
 #include "entities/JointPanelOffset.hpp"
+#include "entities/ModelOrientation.hpp"
 
 #include <functional>
 #include <map>
@@ -26,15 +27,21 @@
 namespace silvanus::generatebox::fusion {
 
     using axis_plane_map = std::map<entities::AxisFlag, adsk::core::Ptr<adsk::fusion::ConstructionPlane>>;
-    using orientation_plane_map = std::unordered_map<adsk::core::DefaultModelingOrientations, axis_plane_map>;
+    using orientation_plane_map = std::unordered_map<entities::ModelOrientation, axis_plane_map>;
     using axis_transform_map = std::map<entities::AxisFlag, std::function<std::tuple<double, double, double>(double, double, double)>>;
-    using orientation_transform_map = std::unordered_map<adsk::core::DefaultModelingOrientations, axis_transform_map>;
+    using orientation_transform_map = std::unordered_map<entities::ModelOrientation, axis_transform_map>;
     using axisFaceSelector = std::map<entities::AxisFlag, std::function<adsk::core::Ptr<adsk::fusion::BRepFace>(adsk::core::Ptr<adsk::fusion::BRepBody>)>>;
-    using orientationAxisSelector = std::map<adsk::core::DefaultModelingOrientations, axisFaceSelector>;
+    using orientationAxisSelector = std::map<entities::ModelOrientation, axisFaceSelector>;
 
+    // The renderers' orientation for Fusion's default modeling orientation.
+    inline auto toModelOrientation(adsk::core::DefaultModelingOrientations orientation) -> entities::ModelOrientation {
+        return orientation == adsk::core::ZUpModelingOrientation ? entities::ModelOrientation::ZUp : entities::ModelOrientation::YUp;
+    }
+
+    // profile is either a single Profile or an ObjectCollection of them.
     auto createSimpleExtrusion(
         const adsk::core::Ptr<adsk::fusion::Sketch>& sketch,
-        const adsk::core::Ptr<adsk::fusion::Profile>& profile,
+        const adsk::core::Ptr<adsk::core::Base>& profile,
         const entities::ExtrusionDistance& distance,
         const entities::PanelOffset& offset
     ) -> adsk::core::Ptr<adsk::fusion::ExtrudeFeatureInput>;
@@ -52,9 +59,11 @@ namespace silvanus::generatebox::fusion {
         const entities::PanelOffset& start
     ) -> adsk::core::Ptr<adsk::fusion::ExtrudeFeatureInput>;
 
+    // The profile may also be an ObjectCollection of profiles of the sketch,
+    // which are then cut by the one feature.
     auto cutSimpleExtrusion(
         const adsk::core::Ptr<adsk::fusion::Sketch>& sketch,
-        const adsk::core::Ptr<adsk::fusion::Profile>& profile,
+        const adsk::core::Ptr<adsk::core::Base>& profile,
         double distance,
         double offset,
         const adsk::core::Ptr<adsk::fusion::BRepBody>& body
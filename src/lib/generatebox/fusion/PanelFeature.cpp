@@ -7,6 +7,7 @@
 
 #include "PanelFeature.hpp"
 
+#include "FusionCallProfiler.hpp"
 #include "FusionSupport.hpp"
 #include "entities/Dimensions.hpp"
 
@@ -21,12 +22,17 @@ auto PanelFeature::extrudeCopy(const ExtrusionDistance& distance, const PanelOff
     auto face = m_panel->startFaces()->item(0);
     auto const& input = silvanus::generatebox::fusion::createSimpleExtrusion(face, distance, offset);
 
-    auto feature = face->body()->parentComponent()->features()->extrudeFeatures()->add(input);
+    auto feature = Ptr<ExtrudeFeature>{};
+    {
+        SILVANUS_FUSION_CALL(AddExtrude);
+        feature = face->body()->parentComponent()->features()->extrudeFeatures()->add(input);
+    }
 
     auto has_distance_expression = distance.expression.length() > 0;
     if (has_distance_expression) {
         auto distance_param = Ptr<DistanceExtentDefinition>{feature->extentOne()}->distance();
         auto distance_expression = std::string{"-("}.append(distance.expression).append(")");
+        SILVANUS_FUSION_CALL(WriteExpression);
         distance_param->expression(distance_expression); // Reassign since Fusion appears to throw away the string expression on creation
     }
 
@@ -38,7 +44,11 @@ auto PanelFeature::extrudeCopy(const ExtrusionDistance& distance, const PanelOff
     auto face = m_panel->startFaces()->item(0);
     auto const& input = silvanus::generatebox::fusion::createSimpleExtrusion(face, distance, offset, start);
 
-    auto feature =  face->body()->parentComponent()->features()->extrudeFeatures()->add(input);
+    auto feature = Ptr<ExtrudeFeature>{};
+    {
+        SILVANUS_FUSION_CALL(AddExtrude);
+        feature = face->body()->parentComponent()->features()->extrudeFeatures()->add(input);
+    }
 
     auto has_distance_expression = distance.expression.length() > 0;
     if (has_distance_expression) {
@@ -46,6 +56,7 @@ auto PanelFeature::extrudeCopy(const ExtrusionDistance& distance, const PanelOff
         auto distance_param = Ptr<DistanceExtentDefinition>{feature->extentOne()}->distance();
         auto distance_expression = std::string{"-("}.append(distance.expression).append(")");
         PLOG_DEBUG << "Using distance expression for copy: " << distance_expression;
+        SILVANUS_FUSION_CALL(WriteExpression);
         distance_param->expression(distance_expression); // Reassign since Fusion appears to throw away the string expression on creation
     }
 
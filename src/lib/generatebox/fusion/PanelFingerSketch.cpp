@@ -4,34 +4,117 @@
 
 #include "PanelFingerSketch.hpp"
 
+#include "FusionCallProfiler.hpp"
+#include "FusionSupport.hpp"
+
 #include "Core/Memory.h"
 
+#include <plog/Log.h>
+
+#include <algorithm>
+
 using namespace adsk::core;
 using namespace adsk::fusion;
 
+using namespace silvanus::generatebox::entities;
 using namespace silvanus::generatebox::fusion;
 
+namespace {
+
+    constexpr double tolerance = 1e-7;
+
+}
+
 PanelFingerSketch::PanelFingerSketch(
     const Ptr<ExtrudeFeature>& extrusion,
     const faceSelector& selector,
     const Ptr<Point3D>& start,
     const Ptr<Point3D>& end,
     const std::string& name
-) : FusionSketch(name, selector, extrusion, true), m_start{start}, m_end{end}, m_selector{selector}
+) : FusionSketch(name, selector, extrusion, true), m_selector{selector}
 {
-    auto lines = drawFinger(start, end);
+    addFinger(start, end);
+}
+
+auto PanelFingerSketch::overlaps(const Ptr<Point3D>& start, const Ptr<Point3D>& end) const -> bool {
+    auto const first = start->x();
+    auto const last  = start->x() + end->x();
+
+    return std::any_of(m_fingers.begin(), m_fingers.end(), [&](const FingerRectangle& finger) {
+        return (first <= finger.end + tolerance) && (finger.start <= last + tolerance);
+    });
+}
+
+auto PanelFingerSketch::addFinger(const Ptr<Point3D>& start, const Ptr<Point3D>& end) -> size_t {
+    auto& finger = m_fingers.emplace_back();
+    finger.start = start->x();
+    finger.end   = start->x() + end->x();
+    drawFinger(finger, start, end);
+
+    return m_fingers.size() - 1;
 }
 
-adsk::core::Ptr<SketchLineList> PanelFingerSketch::drawFinger(const Ptr<Point3D>& start, const Ptr<Point3D>& end) {
+void PanelFingerSketch::drawFinger(FingerRectangle& finger, const Ptr<Point3D>& start, const Ptr<Point3D>& end) {
     auto start_point = offsetMinPoint(start);
     auto end_point = offsetPoint3D(start_point, end);
-    auto lines = m_sketch->sketchCurves()->sketchLines()->addTwoPointRectangle(start_point, end_point);
+    auto lines = Ptr<SketchLineList>{};
+    {
+        SILVANUS_FUSION_CALL(DrawSketchLines);
+        lines = m_sketch->sketchCurves()->sketchLines()->addTwoPointRectangle(start_point, end_point);
+    }
 
     addGeometricConstraints(lines);
     addFaceOriginConstraint(lines, minPoint());
-    m_finger_length = addDistanceDimension(lines->item(0), lines->item(1));
-    m_origin_offset = addDistanceDimension(minPoint(), lines->item(0)->startSketchPoint(), lines->item(1));
+    finger.finger_length = addDistanceDimension(lines->item(0), lines->item(1));
+    finger.origin_offset = addDistanceDimension(minPoint(), lines->item(0)->startSketchPoint(), lines->item(1));
     addExtrusionSideConstraints(lines);
 
-    return lines;
+    finger.lines = lines;
+}
+
+void PanelFingerSketch::addFingerProfiles(size_t finger, const Ptr<ObjectCollection>& profiles) const {
+    auto const sketch_profiles = m_sketch->profiles();
+
+    // Opposite corners of the rectangle, read back after the sketch has been
+    // solved against the parameter expressions.
+    auto const& lines  = m_fingers[finger].lines;
+    auto const  first  = lines->item(0)->startSketchPoint()->geometry();
+    auto const  second = lines->item(2)->startSketchPoint()->geometry();
+
+    auto const min_x = std::min(first->x(), second->x()) - tolerance;
+    auto const max_x = std::max(first->x(), second->x()) + tolerance;
+    auto const min_y = std::min(first->y(), second->y()) - tolerance;
+    auto const max_y = std::max(first->y(), second->y()) + tolerance;
+
+    auto found = false;
+    for (size_t i = 0; i < sketch_profiles->count(); ++i) {
+        auto const profile = sketch_profiles->item(i);
+        auto const bounds  = profile->boundingBox();
+        auto const low     = bounds->minPoint();
+        auto const high    = bounds->maxPoint();
+
+        if ((low->x() < min_x) || (high->x() > max_x) || (low->y() < min_y) || (high->y() > max_y)) continue;
+
+        found = true;
+        if (profiles->find(profile) < 0) profiles->add(profile);
+    }
+
+    if (!found) {
+        PLOG_DEBUG << "No profile found for finger " << finger << " of " << m_name;
+    }
+}
+
+auto PanelFingerSketch::cutFingers(
+    const std::vector<size_t>& fingers, const JointPanelOffset& offset, const JointThickness& depth, const Ptr<BRepBody>& body
+) const -> Ptr<ExtrudeFeature> {
+    if (m_sketch->isComputeDeferred()) {
+        SILVANUS_FUSION_CALL(ComputeSketch);
+        m_sketch->isComputeDeferred(false);
+    }
+
+    auto const profiles = ObjectCollection::create();
+    for (auto const finger: fingers) addFingerProfiles(finger, profiles);
+    if (profiles->count() == 0) return nullptr;
+
+    return cutSimpleExtrusion(m_sketch, profiles, depth.value, offset.value, body);
 }
@@ -6,31 +6,50 @@
 #define SILVANUSPRO_PANELFINGERSKETCH_HPP
 
 #include "FusionSketch.hpp"
+#include <Core/CoreAll.h>
 #include <Core/Geometry/Point3D.h>
 #include <Fusion/Features/ExtrudeFeature.h>
 #include <Fusion/BRep/BRepBody.h>
 #include <Fusion/BRep/BRepFace.h>
+#include <Fusion/Sketch/Profile.h>
 #include <Fusion/Sketch/SketchLineList.h>
 
+#include "entities/JointPanelOffset.hpp"
+#include "entities/JointThickness.hpp"
+
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace silvanus::generatebox::fusion {
 
+    // Holds the finger and corner rectangles drawn on one panel face, of every
+    // joint profile that lands there. Rectangles share the sketch while they do
+    // not touch when drawn. A later parameter edit can still make them overlap,
+    // which splits their regions into several profiles, so a rectangle is cut
+    // from every profile that lies inside it rather than from one.
     class PanelFingerSketch : public FusionSketch {
 
+        struct FingerRectangle {
+            adsk::core::Ptr<adsk::fusion::SketchLineList>        lines;
+            adsk::core::Ptr<adsk::fusion::SketchLinearDimension> finger_length;
+            adsk::core::Ptr<adsk::fusion::SketchLinearDimension> origin_offset;
+            double                                               start;
+            double                                               end;
+        };
+
         faceSelector m_selector;
-        adsk::core::Ptr<adsk::core::Point3D> m_start;
-        adsk::core::Ptr<adsk::core::Point3D> m_end;
 
-        adsk::core::Ptr<adsk::fusion::SketchLinearDimension> m_finger_length;
-        adsk::core::Ptr<adsk::fusion::SketchLinearDimension> m_origin_offset;
+        std::vector<FingerRectangle> m_fingers;
 
-        adsk::core::Ptr<adsk::fusion::SketchLineList> drawFinger(
+        void drawFinger(
+            FingerRectangle& finger,
             const adsk::core::Ptr<adsk::core::Point3D>& offset,
             const adsk::core::Ptr<adsk::core::Point3D>& end
         );
 
+        void addFingerProfiles(size_t finger, const adsk::core::Ptr<adsk::core::ObjectCollection>& profiles) const;
+
     public:
         PanelFingerSketch(
             const adsk::core::Ptr<adsk::fusion::ExtrudeFeature>& extrusion,
@@ -40,12 +59,34 @@ namespace silvanus::generatebox::fusion {
             const std::string& name
         );
 
-        auto fingerLength() const -> adsk::core::Ptr<adsk::fusion::ModelParameter> {
-            return m_finger_length->parameter();
+        // True when a finger from start spanning end would touch one that is
+        // already drawn, which would merge or split their profiles.
+        [[nodiscard]] auto overlaps(
+            const adsk::core::Ptr<adsk::core::Point3D>& start,
+            const adsk::core::Ptr<adsk::core::Point3D>& end
+        ) const -> bool;
+
+        // Draws another finger and returns its index.
+        auto addFinger(
+            const adsk::core::Ptr<adsk::core::Point3D>& start,
+            const adsk::core::Ptr<adsk::core::Point3D>& end
+        ) -> size_t;
+
+        // Cuts the given fingers with one extrude feature, since they share
+        // its offset and depth.
+        [[nodiscard]] auto cutFingers(
+            const std::vector<size_t>& fingers,
+            const entities::JointPanelOffset& offset,
+            const entities::JointThickness& depth,
+            const adsk::core::Ptr<adsk::fusion::BRepBody>& body
+        ) const -> adsk::core::Ptr<adsk::fusion::ExtrudeFeature>;
+
+        auto fingerLength(size_t finger = 0) const -> adsk::core::Ptr<adsk::fusion::ModelParameter> {
+            return m_fingers[finger].finger_length->parameter();
         }
 
-        auto originOffset() const -> adsk::core::Ptr<adsk::fusion::ModelParameter> {
-            return m_origin_offset->parameter();
+        auto originOffset(size_t finger = 0) const -> adsk::core::Ptr<adsk::fusion::ModelParameter> {
+            return m_fingers[finger].origin_offset->parameter();
         }
     };
 
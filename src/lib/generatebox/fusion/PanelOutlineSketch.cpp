@@ -0,0 +1,159 @@
+//
+// Created by Hobbyist Maker on 9/30/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "PanelOutlineSketch.hpp"
+
+#include "FusionCallProfiler.hpp"
+#include "FusionSupport.hpp"
+#include "render/geometry/PanelGrid.hpp"
+
+#include <plog/Log.h>
+
+#include <cmath>
+#include <utility>
+
+using std::string;
+
+using namespace adsk::core;
+using namespace adsk::fusion;
+
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::fusion;
+using namespace silvanus::generatebox::geometry;
+
+PanelOutlineSketch::PanelOutlineSketch(
+    const string& name,
+    const Ptr<ConstructionPlane>& source,
+    std::function<std::tuple<double, double, double>(double, double, double)> transform,
+    const PanelOutline& outline,
+    const CoordinateExpressions& expressions
+) : FusionSketch{name, source, false}, m_transform{std::move(transform)} {
+    m_length_along_x = std::get<0>(m_transform(1, 0, 0)) != 0;
+
+    for (auto const& loop: outline.loops) {
+        drawLoop(outline, loop, expressions);
+    }
+}
+
+auto PanelOutlineSketch::sketchPoint(const OutlinePoint& point) const -> Ptr<Point3D> {
+    double x, y, z;
+    std::tie(x, y, z) = m_transform(point.u, point.v, 0);
+
+    return Point3D::create(x, y, z);
+}
+
+void PanelOutlineSketch::drawLoop(const PanelOutline& outline, const OutlineLoop& loop, const CoordinateExpressions& expressions) {
+    auto const lines = m_sketch->sketchCurves()->sketchLines();
+
+    auto first    = Ptr<SketchLine>{};
+    auto previous = Ptr<SketchLine>{};
+
+    // Each line starts on the end of the one before it and the last one closes
+    // on the first, so the loop is connected without coincident constraints.
+    for (size_t i = 0; i < loop.count; ++i) {
+        auto const& start = outline.points[loop.first + i];
+        auto const& end   = outline.points[loop.first + (i + 1) % loop.count];
+
+        auto line = Ptr<SketchLine>{};
+        {
+            SILVANUS_FUSION_CALL(DrawSketchLines);
+            if (!previous) {
+                line = lines->addByTwoPoints(sketchPoint(start), sketchPoint(end));
+            } else if (i + 1 == loop.count) {
+                line = lines->addByTwoPoints(previous->endSketchPoint(), first->startSketchPoint());
+            } else {
+                line = lines->addByTwoPoints(previous->endSketchPoint(), sketchPoint(end));
+            }
+        }
+
+        if (!line) {
+            PLOG_DEBUG << "Unable to draw outline line " << i << " of " << m_name;
+            return;
+        }
+
+        if (!first) first = line;
+        previous = line;
+
+        constrainLine(line, start, end, expressions);
+    }
+}
+
+void PanelOutlineSketch::constrainLine(
+    const Ptr<SketchLine>& line, const OutlinePoint& start, const OutlinePoint& end, const CoordinateExpressions& expressions
+) {
+    auto const constraints = m_sketch->geometricConstraints();
+    auto const along_u     = start.v == end.v;
+    auto const horizontal  = along_u == m_length_along_x;
+
+    {
+        SILVANUS_FUSION_CALL(AddConstraint);
+        if (horizontal) {
+            constraints->addHorizontal(line);
+        } else {
+            constraints->addVertical(line);
+        }
+    }
+
+    // A line running along the panel length sits at a width coordinate, and the
+    // other way around.
+    auto const position = along_u ? start.v : start.u;
+
+    if (std::abs(position) < PanelGrid::tolerance) {
+        SILVANUS_FUSION_CALL(AddConstraint);
+        if (horizontal) {
+            constraints->addHorizontalPoints(m_sketch->originPoint(), line->startSketchPoint());
+        } else {
+            constraints->addVerticalPoints(m_sketch->originPoint(), line->startSketchPoint());
+        }
+        return;
+    }
+
+    double x, y, z;
+    std::tie(x, y, z) = m_transform((start.u + end.u) / 2, (start.v + end.v) / 2, 0);
+    auto const text_point  = horizontal ? Point3D::create(x, y / 2, z) : Point3D::create(x / 2, y, z);
+    auto const orientation = horizontal ? VerticalDimensionOrientation : HorizontalDimensionOrientation;
+
+    auto dimension = Ptr<SketchLinearDimension>{};
+    {
+        SILVANUS_FUSION_CALL(AddDimension);
+        dimension = m_sketch->sketchDimensions()->addDistanceDimension(
+            m_sketch->originPoint(), line->startSketchPoint(), orientation, text_point
+        );
+    }
+
+    auto const& expression = along_u ? expressions.v(position) : expressions.u(position);
+    if (!dimension || expression.empty()) return;
+
+    SILVANUS_FUSION_CALL(WriteExpression);
+    dimension->parameter()->expression(expression);
+}
+
+auto PanelOutlineSketch::extrudeOutline(const ExtrusionDistance& distance, const PanelOffset& offset) const -> Ptr<ExtrudeFeature> {
+    {
+        SILVANUS_FUSION_CALL(ComputeSketch);
+        m_sketch->isComputeDeferred(false);
+    }
+
+    // Holes left by inside joints are profiles of their own; only the profiles
+    // bounded by more than one loop are material. Without holes every profile is.
+    auto const profiles  = m_sketch->profiles();
+    auto const selection = ObjectCollection::create();
+    for (size_t i = 0; i < profiles->count(); ++i) {
+        auto const profile = profiles->item(i);
+        if (profile->profileLoops()->count() > 1) selection->add(profile);
+    }
+    if (selection->count() == 0) {
+        for (size_t i = 0; i < profiles->count(); ++i) selection->add(profiles->item(i));
+    }
+    if (selection->count() == 0) {
+        PLOG_DEBUG << "No profiles found to extrude for " << m_name;
+        return nullptr;
+    }
+
+    auto const input = createSimpleExtrusion(m_sketch, selection, distance, offset);
+
+    SILVANUS_FUSION_CALL(AddExtrude);
+    return m_sketch->parentComponent()->features()->extrudeFeatures()->add(input);
+}
@@ -0,0 +1,66 @@
+//
+// Created by Hobbyist Maker on 9/30/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_PANELOUTLINESKETCH_HPP
+#define SILVANUSPRO_PANELOUTLINESKETCH_HPP
+
+#include <Core/CoreAll.h>
+#include <Fusion/FusionAll.h>
+
+#include "FusionSketch.hpp"
+#include "entities/ExtrusionDistance.hpp"
+#include "entities/PanelOffset.hpp"
+#include "render/geometry/CoordinateExpressions.hpp"
+#include "render/geometry/PanelOutline.hpp"
+
+#include <functional>
+#include <string>
+#include <tuple>
+
+namespace silvanus::generatebox::fusion {
+
+    // Draws the finished outline of a panel, finger notches and joint holes
+    // included, so the whole panel is a single extrusion. Every line is kept
+    // horizontal or vertical and its position is dimensioned from the sketch
+    // origin, which fully constrains the outline; dimensions with an expression
+    // follow the user parameters.
+    class PanelOutlineSketch : public FusionSketch
+    {
+            std::function<std::tuple<double, double, double>(double, double, double)> m_transform;
+            bool m_length_along_x = true;
+
+            auto sketchPoint(const geometry::OutlinePoint& point) const -> adsk::core::Ptr<adsk::core::Point3D>;
+
+            void drawLoop(
+                const geometry::PanelOutline& outline,
+                const geometry::OutlineLoop& loop,
+                const geometry::CoordinateExpressions& expressions
+            );
+            void constrainLine(
+                const adsk::core::Ptr<adsk::fusion::SketchLine>& line,
+                const geometry::OutlinePoint& start,
+                const geometry::OutlinePoint& end,
+                const geometry::CoordinateExpressions& expressions
+            );
+
+        public:
+            PanelOutlineSketch(
+                const std::string& name,
+                const adsk::core::Ptr<adsk::fusion::ConstructionPlane>& source,
+                std::function<std::tuple<double, double, double>(double, double, double)> transform,
+                const geometry::PanelOutline& outline,
+                const geometry::CoordinateExpressions& expressions
+            );
+
+            // Extrudes the material between the outer contours and the holes.
+            [[nodiscard]] auto extrudeOutline(
+                const entities::ExtrusionDistance& distance,
+                const entities::PanelOffset& offset
+            ) const -> adsk::core::Ptr<adsk::fusion::ExtrudeFeature>;
+    };
+
+}
+
+#endif //SILVANUSPRO_PANELOUTLINESKETCH_HPP
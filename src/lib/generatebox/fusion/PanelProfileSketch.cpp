@@ -6,6 +6,7 @@
 //
 
 #include "PanelProfileSketch.hpp"
+#include "FusionCallProfiler.hpp"
 #include "FusionSupport.hpp"
 #include "entities/Dimensions.hpp"
 #include "entities/PanelProfile.hpp"
@@ -52,6 +53,7 @@ auto PanelProfileSketch::draw_profile() -> Ptr<SketchLineList> {
     auto origin = Point3D::create(0, 0, 0);
     auto end_point = Point3D::create(x, y, 0);
 
+    SILVANUS_FUSION_CALL(DrawSketchLines);
     return m_sketch->sketchCurves()->sketchLines()->addTwoPointRectangle(origin, end_point);
 }
 
@@ -63,5 +65,6 @@ void PanelProfileSketch::addProfileDimensions() {
 auto PanelProfileSketch::extrudeProfile(const ExtrusionDistance& distance, const PanelOffset& offset) const -> Ptr<ExtrudeFeature> {
     const auto& input = silvanus::generatebox::fusion::createSimpleExtrusion(m_sketch, m_sketch->profiles()->item(0), distance, offset);
 
+    SILVANUS_FUSION_CALL(AddExtrude);
     return m_sketch->parentComponent()->features()->extrudeFeatures()->add(input);
 }
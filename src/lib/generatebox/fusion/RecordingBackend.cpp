@@ -0,0 +1,148 @@
+//
+// Created by Hobbyist Maker on 9/29/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "RecordingBackend.hpp"
+
+#include <fmt/format.h>
+
+using namespace silvanus::generatebox::fusion;
+
+namespace {
+
+    auto handleName(BodyHandle handle) -> std::string {
+        return handle ? std::to_string(handle.index) : "-";
+    }
+
+}
+
+auto silvanus::generatebox::fusion::operationName(FusionOperation operation) -> const char* {
+    switch (operation) {
+        case FusionOperation::CreateBox:
+            return "createBox";
+        case FusionOperation::CopyBody:
+            return "copyBody";
+        case FusionOperation::TranslateBody:
+            return "translateBody";
+        case FusionOperation::SubtractBody:
+            return "subtractBody";
+        case FusionOperation::AddBody:
+            return "addBody";
+        default:
+            return "setUserParameter";
+    }
+}
+
+auto RecordingBackend::body(BodyHandle handle) -> RecordedBody* {
+    return handle && handle.index < m_bodies.size() ? &m_bodies[handle.index] : nullptr;
+}
+
+void RecordingBackend::record(FusionOperation operation, BodyHandle body, BodyHandle other) {
+    m_calls.push_back({operation, body, other});
+    ++m_counts[static_cast<size_t>(operation)];
+}
+
+auto RecordingBackend::createBox(const OrientedBox& box) -> BodyHandle {
+    auto handle = BodyHandle{};
+
+    if (box.length > 0 && box.width > 0 && box.height > 0) {
+        handle.index = static_cast<std::uint32_t>(m_bodies.size());
+        m_bodies.push_back({box, {}, {}, {}, false});
+    }
+
+    record(FusionOperation::CreateBox, handle);
+    return handle;
+}
+
+auto RecordingBackend::copyBody(BodyHandle source) -> BodyHandle {
+    auto handle = BodyHandle{};
+
+    if (auto const original = body(source)) {
+        auto copy  = *original;
+        copy.name  = "";
+        copy.added = false;
+
+        handle.index = static_cast<std::uint32_t>(m_bodies.size());
+        m_bodies.push_back(std::move(copy));
+    }
+
+    record(FusionOperation::CopyBody, source, handle);
+    return handle;
+}
+
+void RecordingBackend::translateBody(BodyHandle handle, const Vector3& offset) {
+    if (auto const target = body(handle)) {
+        target->offset.x += offset.x;
+        target->offset.y += offset.y;
+        target->offset.z += offset.z;
+    }
+
+    record(FusionOperation::TranslateBody, handle);
+}
+
+void RecordingBackend::subtractBody(BodyHandle target, BodyHandle tool) {
+    auto const target_body = body(target);
+    auto const tool_body   = body(tool);
+
+    if (target_body && tool_body) {
+        auto cut = tool_body->box;
+        cut.center.x += tool_body->offset.x - target_body->offset.x;
+        cut.center.y += tool_body->offset.y - target_body->offset.y;
+        cut.center.z += tool_body->offset.z - target_body->offset.z;
+        target_body->cuts.push_back(cut);
+    }
+
+    record(FusionOperation::SubtractBody, target, tool);
+}
+
+void RecordingBackend::addBody(BodyHandle handle, const std::string& name) {
+    if (auto const target = body(handle); target && !target->added) {
+        target->name  = name;
+        target->added = true;
+        m_added.push_back(handle.index);
+    }
+
+    record(FusionOperation::AddBody, handle);
+}
+
+auto RecordingBackend::setUserParameter(const std::string& name, const std::string& expression, const std::string& units) -> bool {
+    auto const existing = m_parameters.find(name);
+    if (existing != m_parameters.end() && existing->second.expression == expression && existing->second.units == units) {
+        return false;
+    }
+
+    m_parameters[name] = {expression, units};
+    record(FusionOperation::SetUserParameter, BodyHandle{});
+    return true;
+}
+
+auto RecordingBackend::addedBodies() const -> std::vector<const RecordedBody*> {
+    auto result = std::vector<const RecordedBody*>{};
+    result.reserve(m_added.size());
+
+    for (auto const index: m_added) {
+        result.push_back(&m_bodies[index]);
+    }
+
+    return result;
+}
+
+void RecordingBackend::writeLog(std::ostream& stream) const {
+    for (auto const& call: m_calls) {
+        stream << fmt::format("{} {} {}\n", operationName(call.operation), handleName(call.body), handleName(call.other));
+    }
+
+    for (size_t i = 0; i < fusion_operation_count; ++i) {
+        stream << fmt::format("# {} {}\n", operationName(static_cast<FusionOperation>(i)), m_counts[i]);
+    }
+    stream << fmt::format("# total {}\n", total());
+}
+
+void RecordingBackend::clear() {
+    m_bodies.clear();
+    m_added.clear();
+    m_calls.clear();
+    m_counts.fill(0);
+    m_parameters.clear();
+}
@@ -0,0 +1,90 @@
+//
+// Created by Hobbyist Maker on 9/29/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_RECORDINGBACKEND_HPP
+#define SILVANUSPRO_RECORDINGBACKEND_HPP
+
+#include "FusionBackend.hpp"
+
+#include <array>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace silvanus::generatebox::fusion {
+
+    enum class FusionOperation : std::uint8_t {
+        CreateBox, CopyBody, TranslateBody, SubtractBody, AddBody, SetUserParameter
+    };
+
+    constexpr size_t fusion_operation_count = 6;
+
+    auto operationName(FusionOperation operation) -> const char*;
+
+    // other is the tool of a subtraction and the new body of a copy.
+    struct RecordedCall {
+        FusionOperation operation;
+        BodyHandle      body;
+        BodyHandle      other;
+    };
+
+    // A body as the calls left it. Cuts are the tool boxes subtracted from it,
+    // kept relative to the body so they move with it; offset is the sum of its
+    // translations.
+    struct RecordedBody {
+        OrientedBox              box;
+        Vector3                  offset;
+        std::vector<OrientedBox> cuts;
+        std::string              name;
+        bool                     added = false;
+    };
+
+    struct RecordedParameter {
+        std::string expression;
+        std::string units;
+    };
+
+    // Keeps every body and parameter in memory and records each call, so a
+    // renderer can be run headless and its Fusion call budget checked or
+    // benchmarked. Boxes without volume fail like they do in Fusion.
+    class RecordingBackend : public FusionBackend {
+
+            std::vector<RecordedBody>                  m_bodies;
+            std::vector<std::uint32_t>                 m_added;
+            std::vector<RecordedCall>                  m_calls;
+            std::array<size_t, fusion_operation_count> m_counts{};
+            std::map<std::string, RecordedParameter>   m_parameters;
+
+            auto body(BodyHandle handle) -> RecordedBody*;
+            void record(FusionOperation operation, BodyHandle body, BodyHandle other = {});
+
+        public:
+            auto createBox(const OrientedBox& box) -> BodyHandle override;
+            auto copyBody(BodyHandle body) -> BodyHandle override;
+            void translateBody(BodyHandle body, const Vector3& offset) override;
+            void subtractBody(BodyHandle target, BodyHandle tool) override;
+            void addBody(BodyHandle body, const std::string& name) override;
+
+            auto setUserParameter(const std::string& name, const std::string& expression, const std::string& units) -> bool override;
+
+            [[nodiscard]] auto calls() const -> const std::vector<RecordedCall>& { return m_calls; };
+            [[nodiscard]] auto count(FusionOperation operation) const -> size_t { return m_counts[static_cast<size_t>(operation)]; };
+            [[nodiscard]] auto total() const -> size_t { return m_calls.size(); };
+            [[nodiscard]] auto bodies() const -> const std::vector<RecordedBody>& { return m_bodies; };
+            [[nodiscard]] auto parameters() const -> const std::map<std::string, RecordedParameter>& { return m_parameters; };
+
+            // Bodies that were added to the design, in the order they were added.
+            [[nodiscard]] auto addedBodies() const -> std::vector<const RecordedBody*>;
+
+            // One line per call, then the number of calls of every operation.
+            void writeLog(std::ostream& stream) const;
+
+            void clear();
+    };
+
+}
+
+#endif //SILVANUSPRO_RECORDINGBACKEND_HPP
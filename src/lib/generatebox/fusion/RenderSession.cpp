@@ -0,0 +1,100 @@
+//
+// Created by Hobbyist Maker on 10/1/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "RenderSession.hpp"
+
+#include "FusionCallProfiler.hpp"
+
+#include <plog/Log.h>
+
+using namespace adsk::core;
+using namespace adsk::fusion;
+
+using namespace silvanus::generatebox::fusion;
+
+namespace {
+
+    // Fusion only calls the add-in from its main thread.
+    RenderSession* active_session = nullptr;
+
+    auto milliseconds(std::chrono::steady_clock::duration duration) -> double {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+}
+
+RenderSession::RenderSession(const Ptr<Design>& design, bool deferred)
+    : m_design{design}, m_deferred{deferred}, m_previous{active_session}, m_start{clock::now()} {
+    active_session = this;
+}
+
+RenderSession::~RenderSession() {
+    commit();
+    active_session = m_previous;
+}
+
+auto RenderSession::active() -> RenderSession* {
+    return active_session;
+}
+
+void RenderSession::computeSketch(const Ptr<Sketch>& sketch) {
+    if (m_deferred && !m_committed) {
+        m_sketches.emplace_back(sketch);
+        return;
+    }
+
+    SILVANUS_FUSION_CALL(ComputeSketch);
+    sketch->isComputeDeferred(false);
+}
+
+void RenderSession::groupTimeline(int start, int end, const std::string& name) {
+    if (m_deferred && !m_committed) {
+        m_groups.push_back({start, end, name});
+        return;
+    }
+
+    SILVANUS_FUSION_CALL(AddTimelineGroup);
+    auto const timeline_group = m_design->timeline()->timelineGroups()->add(start, end);
+    timeline_group->name(name);
+}
+
+void RenderSession::commit() {
+    if (m_committed) return;
+    m_committed = true;
+
+    auto const commit_start = clock::now();
+
+    if (m_deferred) {
+        // Copies of the same sketch wrapper each ask for it to be computed.
+        for (auto const& sketch: m_sketches) {
+            if (!sketch->isComputeDeferred()) continue;
+
+            SILVANUS_FUSION_CALL(ComputeSketch);
+            sketch->isComputeDeferred(false);
+        }
+
+        // A group collapses its items into one, which would shift the items of
+        // the groups after it; adding the last group first leaves the recorded
+        // positions of the rest valid.
+        auto const timeline = m_design->timeline();
+        for (auto group = m_groups.rbegin(); group != m_groups.rend(); ++group) {
+            SILVANUS_FUSION_CALL(AddTimelineGroup);
+            auto const timeline_group = timeline->timelineGroups()->add(group->start, group->end);
+            if (timeline_group) timeline_group->name(group->name);
+        }
+
+        {
+            SILVANUS_FUSION_CALL(ComputeDesign);
+            m_design->computeAll();
+        }
+    }
+
+    auto const end = clock::now();
+    PLOG_INFO << "Render took " << milliseconds(end - m_start) << " ms with " << (m_deferred ? "deferred" : "immediate")
+              << " compute, " << milliseconds(end - commit_start) << " ms of it in commit";
+
+    m_sketches.clear();
+    m_groups.clear();
+}
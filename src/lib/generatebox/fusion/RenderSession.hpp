@@ -0,0 +1,68 @@
+//
+// Created by Hobbyist Maker on 10/1/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_RENDERSESSION_HPP
+#define SILVANUSPRO_RENDERSESSION_HPP
+
+#include <Core/CoreAll.h>
+#include <Fusion/FusionAll.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace silvanus::generatebox::fusion {
+
+#ifdef SILVANUS_IMMEDIATE_COMPUTE
+    constexpr bool defer_compute = false;
+#else
+    constexpr bool defer_compute = true;
+#endif
+
+    // Spans one parametric render. While a deferring session is active,
+    // sketches that are done with stay deferred and timeline groups are only
+    // recorded; commit computes the sketches, adds the groups and recomputes
+    // the design once. Sketches whose profiles are needed earlier still compute
+    // on their own. An immediate session does everything as it is asked for,
+    // which is how the add-in behaved before, so both can be timed.
+    class RenderSession {
+            struct TimelineGroupRange {
+                int         start;
+                int         end;
+                std::string name;
+            };
+
+            using clock = std::chrono::steady_clock;
+
+            adsk::core::Ptr<adsk::fusion::Design>              m_design;
+            bool                                               m_deferred;
+            bool                                               m_committed = false;
+            RenderSession*                                     m_previous;
+            clock::time_point                                  m_start;
+            std::vector<adsk::core::Ptr<adsk::fusion::Sketch>> m_sketches;
+            std::vector<TimelineGroupRange>                    m_groups;
+
+        public:
+            RenderSession(const adsk::core::Ptr<adsk::fusion::Design>& design, bool deferred = defer_compute);
+            ~RenderSession();
+
+            RenderSession(const RenderSession&) = delete;
+            auto operator=(const RenderSession&) -> RenderSession& = delete;
+
+            // The innermost session, or nullptr outside of a render.
+            static auto active() -> RenderSession*;
+
+            // Computes the sketch now or when the session commits.
+            void computeSketch(const adsk::core::Ptr<adsk::fusion::Sketch>& sketch);
+
+            // Groups the timeline items from start to end now or when the session commits.
+            void groupTimeline(int start, int end, const std::string& name);
+
+            void commit();
+    };
+
+}
+
+#endif //SILVANUSPRO_RENDERSESSION_HPP
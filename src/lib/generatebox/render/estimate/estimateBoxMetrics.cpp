@@ -0,0 +1,206 @@
+//
+// Created by Hobbyist Maker on 9/26/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "estimateBoxMetrics.hpp"
+
+#include "entities/Enabled.hpp"
+#include "entities/JointEnabled.hpp"
+#include "entities/JointExtrusion.hpp"
+#include "entities/JointGroup.hpp"
+#include "entities/JointOrientation.hpp"
+#include "entities/PanelExtrusion.hpp"
+#include "entities/PanelGroup.hpp"
+#include "entities/ParentPanel.hpp"
+#include "render/geometry/PanelGeometry.hpp"
+#include "render/geometry/PanelOutline.hpp"
+#include "render/geometry/appendJointCuts.hpp"
+
+#include <plog/Log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::estimate;
+using namespace silvanus::generatebox::geometry;
+
+namespace {
+
+    struct PanelTally {
+        PanelGeometry geometry;
+        double        perimeter = 0;
+        double        area      = 0;
+        size_t        outer     = 1;
+        size_t        holes     = 0;
+    };
+
+    constexpr double tolerance = 1e-9;
+
+    // The cuts clipped to the panel, dropping any that miss it.
+    auto clippedCuts(const PanelGeometry& panel) -> std::vector<Rectangle> {
+        auto cuts = std::vector<Rectangle>{};
+        cuts.reserve(panel.cuts.size());
+
+        for (auto const& cut: panel.cuts) {
+            auto const clipped = Rectangle{
+                std::max(cut.min_u, 0.0), std::max(cut.min_v, 0.0),
+                std::min(cut.max_u, panel.length), std::min(cut.max_v, panel.width)
+            };
+            if (clipped.max_u <= clipped.min_u || clipped.max_v <= clipped.min_v) continue;
+            cuts.push_back(clipped);
+        }
+
+        return cuts;
+    }
+
+    // Cuts that overlap or share any part of their boundary merge into one
+    // opening, which the per cut tally below can't account for.
+    auto cutsTouch(const std::vector<Rectangle>& cuts) -> bool {
+        for (size_t i = 0; i < cuts.size(); ++i) {
+            for (size_t j = i + 1; j < cuts.size(); ++j) {
+                auto const& first  = cuts[i];
+                auto const& second = cuts[j];
+
+                if (first.max_u >= second.min_u - tolerance && second.max_u >= first.min_u - tolerance &&
+                    first.max_v >= second.min_v - tolerance && second.max_v >= first.min_v - tolerance) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Adds one cut by the edges it reaches. A notch through one edge lengthens
+    // the outline by twice its depth, a cut into a corner leaves it unchanged, a
+    // cut reaching no edge is a hole and one spanning the panel splits it in two.
+    // This is exact as long as no two cuts touch.
+    void tallyCut(PanelTally& panel, const Rectangle& cut) {
+        auto const u = cut.max_u - cut.min_u;
+        auto const v = cut.max_v - cut.min_v;
+
+        auto const left   = cut.min_u <= tolerance;
+        auto const right  = cut.max_u >= panel.geometry.length - tolerance;
+        auto const bottom = cut.min_v <= tolerance;
+        auto const top    = cut.max_v >= panel.geometry.width - tolerance;
+        auto const edges  = left + right + bottom + top;
+
+        panel.area -= u * v;
+
+        switch (edges) {
+            case 0:
+                panel.perimeter += 2 * (u + v);
+                ++panel.holes;
+                break;
+            case 1:
+                panel.perimeter += (left || right) ? 2 * u : 2 * v;
+                break;
+            case 2:
+                if (left && right) {
+                    panel.perimeter += 2 * panel.geometry.length - 2 * v;
+                    ++panel.outer;
+                } else if (bottom && top) {
+                    panel.perimeter += 2 * panel.geometry.width - 2 * u;
+                    ++panel.outer;
+                }
+                break;
+            case 3:
+                panel.perimeter -= (left && right) ? 2 * v : 2 * u;
+                break;
+            default:
+                panel.perimeter = 0;
+                panel.area      = 0;
+                panel.outer     = 0;
+                break;
+        }
+    }
+
+    // Panels whose cuts touch, like slots running into the corner cuts of the
+    // next joint, are outlined instead. Only those pay for the tracing, and both
+    // ways give the same lengths, areas and contours as the exported outlines.
+    void tallyPanel(PanelTally& panel, PanelOutliner& outliner, PanelOutline& outline) {
+        auto const cuts = clippedCuts(panel.geometry);
+
+        if (!cutsTouch(cuts)) {
+            for (auto const& cut: cuts) {
+                tallyCut(panel, cut);
+            }
+            return;
+        }
+
+        outliner.build(panel.geometry, outline);
+
+        panel.perimeter = outlineLength(outline);
+        panel.area      = outlineArea(outline);
+        panel.outer     = 0;
+        panel.holes     = 0;
+
+        for (auto const& loop: outline.loops) {
+            ++(loop.hole ? panel.holes : panel.outer);
+        }
+    }
+
+}
+
+auto silvanus::generatebox::estimate::estimateBoxMetrics(entt::registry& registry, const MachineProfile& machine) -> BoxMetrics {
+    auto tallies = std::map<entt::entity, PanelTally>{};
+
+    auto panel_view = registry.view<const Enabled, const PanelGroup, const PanelExtrusion, const ParentPanel>().proxy();
+    for (auto &&[entity, enabled, panel_group, extrusion, parent]: panel_view) {
+        if (!enabled.value || tallies.count(parent.id)) continue;
+
+        auto& tally                = tallies[parent.id];
+        tally.geometry.orientation = panel_group.orientation;
+        tally.geometry.length      = panel_group.profile.length.value;
+        tally.geometry.width       = panel_group.profile.width.value;
+        tally.perimeter            = 2 * (tally.geometry.length + tally.geometry.width);
+        tally.area                 = tally.geometry.length * tally.geometry.width;
+    }
+
+    auto joint_view = registry.view<const Enabled, const JointEnabled, const ParentPanel, const JointGroup, const JointOrientation, const JointExtrusion>().proxy();
+    for (auto &&[entity, enabled, joint_enabled, parent, joint_group, joint_orientation, joint]: joint_view) {
+        if (!enabled.value || !joint_enabled.value) continue;
+
+        auto const found = tallies.find(parent.id);
+        if (found == tallies.end()) continue;
+
+        appendJointCuts(found->second.geometry, joint_group.profile, joint_orientation.axis, joint.offset.value, joint.distance.value);
+    }
+
+    auto outliner = PanelOutliner{};
+    auto outline  = PanelOutline{};
+    for (auto& [entity, tally]: tallies) {
+        tallyPanel(tally, outliner, outline);
+    }
+
+    auto metrics = BoxMetrics{};
+    for (auto const& [entity, tally]: tallies) {
+        if (tally.outer == 0) continue;
+
+        ++metrics.panels;
+        metrics.contours        += tally.outer + tally.holes;
+        metrics.cut_length      += tally.perimeter;
+        metrics.toolpath_length += tally.perimeter;
+        metrics.sheet_area      += tally.geometry.length * tally.geometry.width;
+        metrics.material_area   += tally.area;
+    }
+
+    // Shortest tours through n points spread over an area A approach
+    // 0.7124 * sqrt(n * A), which is close enough for a quote.
+    metrics.travel_length = 0.7124 * std::sqrt(static_cast<double>(metrics.contours) * metrics.sheet_area);
+
+    auto const passes    = static_cast<double>(std::max<size_t>(machine.passes, 1));
+    auto const cut_mm    = metrics.toolpath_length * 10 * passes;
+    auto const travel_mm = metrics.travel_length * 10 * passes;
+
+    metrics.laser_time = cut_mm / machine.cut_feed * 60
+                       + travel_mm / machine.rapid_feed * 60
+                       + static_cast<double>(metrics.contours) * passes * machine.pierce_time;
+
+    PLOG_DEBUG << "Estimated " << metrics.panels << " panels, " << metrics.cut_length << " cm cut, " << metrics.laser_time << " s";
+
+    return metrics;
+}
@@ -0,0 +1,50 @@
+//
+// Created by Hobbyist Maker on 9/26/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_ESTIMATEBOXMETRICS_HPP
+#define SILVANUSPRO_ESTIMATEBOXMETRICS_HPP
+
+#include <entt/entt.hpp>
+
+namespace silvanus::generatebox::estimate {
+
+    // Feeds are in millimeters per minute and times in seconds, like the G-code
+    // export.
+    struct MachineProfile {
+        double cut_feed    = 600;
+        double rapid_feed  = 6000;
+        double pierce_time = 0.5;
+        size_t passes      = 1;
+    };
+
+    // Lengths are in centimeters and areas in square centimeters.
+    //
+    // cut_length is the length of the finished outlines. The panel dimensions
+    // already include the kerf adjustments, so toolpath_length, the path the
+    // beam follows, is the same length. sheet_area is the sum of the panel
+    // bounding rectangles, material_area what is left after the cuts.
+    // travel_length is an estimate for a good cut order and laser_time covers
+    // cutting, travel and one pierce per contour for every pass.
+    struct BoxMetrics {
+        size_t panels          = 0;
+        size_t contours        = 0;
+        double cut_length      = 0;
+        double toolpath_length = 0;
+        double travel_length   = 0;
+        double sheet_area      = 0;
+        double material_area   = 0;
+        double laser_time      = 0;
+    };
+
+    // Works straight from the panel profiles, joint extrusions and joint pattern
+    // values of a configured registry. Every finger, corner and slot cut is
+    // classified by the panel edges it reaches; only panels with cuts that
+    // overlap or touch, like trimmed edges running into corner cuts, have their
+    // outlines traced. Lengths, areas and contours match the exported outlines.
+    auto estimateBoxMetrics(entt::registry& registry, const MachineProfile& machine = {}) -> BoxMetrics;
+
+}
+
+#endif //SILVANUSPRO_ESTIMATEBOXMETRICS_HPP
@@ -0,0 +1,112 @@
+//
+// Created by Hobbyist Maker on 9/22/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "DxfWriter.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+using namespace silvanus::generatebox::flatpack;
+using namespace silvanus::generatebox::geometry;
+
+namespace {
+
+    constexpr double millimeters = 10.0;
+
+}
+
+void DxfWriter::group(int code, const std::string& value) {
+    m_stream << code << "\n" << value << "\n";
+}
+
+void DxfWriter::group(int code, double value) {
+    m_stream << code << "\n" << value << "\n";
+}
+
+void DxfWriter::group(int code, int value) {
+    m_stream << code << "\n" << value << "\n";
+}
+
+void DxfWriter::begin(double width, double height) {
+    m_stream << std::fixed << std::setprecision(4);
+
+    group(0, "SECTION");
+    group(2, "HEADER");
+    group(9, "$ACADVER");
+    group(1, "AC1009");
+    group(9, "$INSUNITS");
+    group(70, 4);
+    group(9, "$EXTMIN");
+    group(10, 0.0);
+    group(20, 0.0);
+    group(9, "$EXTMAX");
+    group(10, width * millimeters);
+    group(20, height * millimeters);
+    group(0, "ENDSEC");
+
+    group(0, "SECTION");
+    group(2, "TABLES");
+    group(0, "TABLE");
+    group(2, "LAYER");
+    group(70, 2);
+    for (auto const& [layer, color]: {std::make_pair("CUT", 1), std::make_pair("LABEL", 5)}) {
+        group(0, "LAYER");
+        group(2, layer);
+        group(70, 0);
+        group(62, color);
+        group(6, "CONTINUOUS");
+    }
+    group(0, "ENDTAB");
+    group(0, "ENDSEC");
+
+    group(0, "SECTION");
+    group(2, "ENTITIES");
+}
+
+void DxfWriter::panel(const std::string& name, const PanelOutline& outline, double x, double y) {
+    auto max_u = 0.0;
+    auto max_v = 0.0;
+    for (auto const& point: outline.points) {
+        max_u = std::max(max_u, point.u);
+        max_v = std::max(max_v, point.v);
+    }
+
+    for (auto const& loop: outline.loops) {
+        group(0, "POLYLINE");
+        group(8, "CUT");
+        group(66, 1);
+        group(10, 0.0);
+        group(20, 0.0);
+        group(30, 0.0);
+        group(70, 1);
+
+        for (size_t i = 0; i < loop.count; ++i) {
+            auto const& point = outline.points[loop.first + i];
+            group(0, "VERTEX");
+            group(8, "CUT");
+            group(10, (x + point.u) * millimeters);
+            group(20, (y + point.v) * millimeters);
+        }
+
+        group(0, "SEQEND");
+        group(8, "CUT");
+    }
+
+    group(0, "TEXT");
+    group(8, "LABEL");
+    group(10, (x + max_u / 2) * millimeters);
+    group(20, (y + max_v / 2) * millimeters);
+    group(40, 4.0);
+    group(1, name);
+    group(72, 1);
+    group(11, (x + max_u / 2) * millimeters);
+    group(21, (y + max_v / 2) * millimeters);
+}
+
+void DxfWriter::end() {
+    group(0, "ENDSEC");
+    group(0, "EOF");
+    m_stream.flush();
+}
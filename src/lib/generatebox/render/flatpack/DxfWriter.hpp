@@ -0,0 +1,35 @@
+//
+// Created by Hobbyist Maker on 9/22/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_DXFWRITER_HPP
+#define SILVANUSPRO_DXFWRITER_HPP
+
+#include "FlatPackWriter.hpp"
+
+#include <ostream>
+
+namespace silvanus::generatebox::flatpack {
+
+    // Writes an R12 ASCII DXF in millimeters. Outlines are closed POLYLINE
+    // entities on the CUT layer and panel names are TEXT on the LABEL layer;
+    // R12 is used because every laser package still reads it.
+    class DxfWriter : public FlatPackWriter {
+            std::ostream& m_stream;
+
+            void group(int code, const std::string& value);
+            void group(int code, double value);
+            void group(int code, int value);
+
+        public:
+            explicit DxfWriter(std::ostream& stream) : m_stream{stream} {};
+
+            void begin(double width, double height) override;
+            void panel(const std::string& name, const geometry::PanelOutline& outline, double x, double y) override;
+            void end() override;
+    };
+
+}
+
+#endif //SILVANUSPRO_DXFWRITER_HPP
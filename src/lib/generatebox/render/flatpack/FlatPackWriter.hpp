@@ -0,0 +1,29 @@
+//
+// Created by Hobbyist Maker on 9/22/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_FLATPACKWRITER_HPP
+#define SILVANUSPRO_FLATPACKWRITER_HPP
+
+#include "render/geometry/PanelOutline.hpp"
+
+#include <string>
+
+namespace silvanus::generatebox::flatpack {
+
+    // Receives panel outlines one at a time and streams them straight to its
+    // output, so nothing but the current outline is ever held in memory.
+    // Positions and sizes are in Fusion's internal centimeters.
+    class FlatPackWriter {
+        public:
+            virtual ~FlatPackWriter() = default;
+
+            virtual void begin(double width, double height) = 0;
+            virtual void panel(const std::string& name, const geometry::PanelOutline& outline, double x, double y) = 0;
+            virtual void end() = 0;
+    };
+
+}
+
+#endif //SILVANUSPRO_FLATPACKWRITER_HPP
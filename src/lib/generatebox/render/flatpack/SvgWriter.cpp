@@ -0,0 +1,82 @@
+//
+// Created by Hobbyist Maker on 9/22/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "SvgWriter.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+using namespace silvanus::generatebox::flatpack;
+using namespace silvanus::generatebox::geometry;
+
+namespace {
+
+    constexpr double millimeters = 10.0;
+
+}
+
+void SvgWriter::begin(double width, double height) {
+    m_height = height;
+
+    m_stream << std::fixed << std::setprecision(4);
+    m_stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    m_stream << "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\""
+             << " width=\"" << width * millimeters << "mm\""
+             << " height=\"" << height * millimeters << "mm\""
+             << " viewBox=\"0 0 " << width * millimeters << " " << height * millimeters << "\">\n";
+}
+
+void SvgWriter::panel(const std::string& name, const PanelOutline& outline, double x, double y) {
+    auto const label = escape(name);
+
+    auto max_u = 0.0;
+    auto max_v = 0.0;
+    for (auto const& point: outline.points) {
+        max_u = std::max(max_u, point.u);
+        max_v = std::max(max_v, point.v);
+    }
+
+    m_stream << "  <g id=\"" << label << "\">\n";
+    m_stream << "    <path fill=\"none\" stroke=\"#ff0000\" stroke-width=\"0.01\" fill-rule=\"evenodd\" d=\"";
+    for (auto const& loop: outline.loops) {
+        for (size_t i = 0; i < loop.count; ++i) {
+            auto const& point = outline.points[loop.first + i];
+            m_stream << (i == 0 ? "M" : "L")
+                     << (x + point.u) * millimeters << ","
+                     << (m_height - (y + point.v)) * millimeters << " ";
+        }
+        m_stream << "Z ";
+    }
+    m_stream << "\"/>\n";
+
+    // Labels sit in the middle of the panel; engrave them or drop the blue layer.
+    m_stream << "    <text fill=\"#0000ff\" font-family=\"sans-serif\" font-size=\"4\" text-anchor=\"middle\""
+             << " x=\"" << (x + max_u / 2) * millimeters << "\""
+             << " y=\"" << (m_height - (y + max_v / 2)) * millimeters << "\">"
+             << label << "</text>\n";
+    m_stream << "  </g>\n";
+}
+
+void SvgWriter::end() {
+    m_stream << "</svg>\n";
+    m_stream.flush();
+}
+
+auto SvgWriter::escape(const std::string& text) -> std::string {
+    auto escaped = std::string{};
+    escaped.reserve(text.size());
+
+    for (auto const character: text) {
+        switch (character) {
+            case '&': escaped += "&amp;"; break;
+            case '<': escaped += "&lt;"; break;
+            case '>': escaped += "&gt;"; break;
+            case '"': escaped += "&quot;"; break;
+            default: escaped += character;
+        }
+    }
+
+    return escaped;
+}
@@ -0,0 +1,33 @@
+//
+// Created by Hobbyist Maker on 9/22/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_SVGWRITER_HPP
+#define SILVANUSPRO_SVGWRITER_HPP
+
+#include "FlatPackWriter.hpp"
+
+#include <ostream>
+
+namespace silvanus::generatebox::flatpack {
+
+    // Writes millimeter SVG with cut paths in red hairlines and panel names in
+    // blue so laser software can map them to cut and engrave passes.
+    class SvgWriter : public FlatPackWriter {
+            std::ostream& m_stream;
+            double m_height = 0;
+
+            static auto escape(const std::string& text) -> std::string;
+
+        public:
+            explicit SvgWriter(std::ostream& stream) : m_stream{stream} {};
+
+            void begin(double width, double height) override;
+            void panel(const std::string& name, const geometry::PanelOutline& outline, double x, double y) override;
+            void end() override;
+    };
+
+}
+
+#endif //SILVANUSPRO_SVGWRITER_HPP
@@ -0,0 +1,84 @@
+//
+// Created by Hobbyist Maker on 9/22/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "exportFlatPack.hpp"
+
+#include "render/geometry/collectPanelGeometry.hpp"
+#include "render/geometry/PanelOutline.hpp"
+
+#include <plog/Log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+using namespace silvanus::generatebox::flatpack;
+using namespace silvanus::generatebox::geometry;
+
+auto silvanus::generatebox::flatpack::layoutFlatPack(const std::vector<PanelGeometry>& panels, const FlatPackOptions& options) -> FlatPackLayout {
+    auto layout = FlatPackLayout{};
+    if (panels.empty()) return layout;
+
+    auto order = std::vector<size_t>(panels.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&panels](size_t lhs, size_t rhs) {
+        return panels[lhs].width > panels[rhs].width;
+    });
+
+    auto row_width = options.row_width;
+    if (row_width <= 0) {
+        auto area    = 0.0;
+        auto longest = 0.0;
+        for (auto const& panel: panels) {
+            area += (panel.length + options.spacing) * (panel.width + options.spacing);
+            longest = std::max(longest, panel.length);
+        }
+        row_width = std::max(longest, std::sqrt(area));
+    }
+
+    auto x          = 0.0;
+    auto y          = 0.0;
+    auto row_height = 0.0;
+
+    layout.placements.reserve(panels.size());
+    for (auto const index: order) {
+        auto const& panel = panels[index];
+
+        if (x > 0 && x + panel.length > row_width) {
+            y += row_height + options.spacing;
+            x = 0;
+            row_height = 0;
+        }
+
+        layout.placements.push_back({index, x, y});
+        layout.width = std::max(layout.width, x + panel.length);
+
+        x += panel.length + options.spacing;
+        row_height = std::max(row_height, panel.width);
+    }
+
+    layout.height = y + row_height;
+    return layout;
+}
+
+auto silvanus::generatebox::flatpack::exportFlatPack(entt::registry& registry, FlatPackWriter& writer, const FlatPackOptions& options) -> size_t {
+    auto const panels = collectPanelGeometry(registry);
+    auto const layout = layoutFlatPack(panels, options);
+
+    auto outliner = PanelOutliner{};
+    auto outline  = PanelOutline{};
+
+    writer.begin(layout.width, layout.height);
+    for (auto const& placement: layout.placements) {
+        auto const& panel = panels[placement.panel];
+        outliner.build(panel, outline);
+        writer.panel(panel.name, outline, placement.x, placement.y);
+    }
+    writer.end();
+
+    PLOG_DEBUG << "Exported " << panels.size() << " panel outlines";
+
+    return panels.size();
+}
@@ -0,0 +1,45 @@
+//
+// Created by Hobbyist Maker on 9/22/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_EXPORTFLATPACK_HPP
+#define SILVANUSPRO_EXPORTFLATPACK_HPP
+
+#include "FlatPackWriter.hpp"
+#include "render/geometry/PanelGeometry.hpp"
+
+#include <entt/entt.hpp>
+
+#include <vector>
+
+namespace silvanus::generatebox::flatpack {
+
+    struct FlatPackOptions {
+        double spacing   = 0.5;
+        double row_width = 0;
+    };
+
+    struct FlatPackPlacement {
+        size_t panel = 0;
+        double x     = 0;
+        double y     = 0;
+    };
+
+    struct FlatPackLayout {
+        std::vector<FlatPackPlacement> placements;
+        double width  = 0;
+        double height = 0;
+    };
+
+    // Lays panels out in rows, tallest first, wrapping at options.row_width. A row
+    // width of zero picks one that keeps the layout roughly square.
+    auto layoutFlatPack(const std::vector<geometry::PanelGeometry>& panels, const FlatPackOptions& options) -> FlatPackLayout;
+
+    // Writes every enabled panel of a configured registry through the writer,
+    // outlining one panel at a time. Returns the number of panels written.
+    auto exportFlatPack(entt::registry& registry, FlatPackWriter& writer, const FlatPackOptions& options = {}) -> size_t;
+
+}
+
+#endif //SILVANUSPRO_EXPORTFLATPACK_HPP
@@ -0,0 +1,65 @@
+//
+// Created by Hobbyist Maker on 9/24/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "GCodeWriter.hpp"
+
+#include <iomanip>
+
+using namespace silvanus::generatebox::gcode;
+
+namespace {
+
+    constexpr double millimeters = 10.0;
+
+}
+
+void GCodeWriter::move(const char* command, const ToolPoint& point) {
+    m_stream << command << " X" << point.x * millimeters << " Y" << point.y * millimeters;
+}
+
+void GCodeWriter::begin() {
+    m_stream << std::fixed << std::setprecision(3);
+    m_stream << "; Silvanus laser toolpath\n";
+    m_stream << "G21\n";
+    m_stream << "G90\n";
+    m_stream << "M5\n";
+}
+
+void GCodeWriter::sheet(const SheetToolpath& toolpath) {
+    if (toolpath.sheet > 0) {
+        m_stream << "G0 X0 Y0\n";
+        m_stream << "M0 ; load sheet " << toolpath.sheet + 1 << "\n";
+    }
+    m_stream << "; sheet " << toolpath.sheet + 1 << "\n";
+
+    auto const laser_on = m_options.dynamic_power ? "M4 S" : "M3 S";
+
+    for (auto const& cut: toolpath.cuts) {
+        auto const& points = toolpath.contours[cut.contour].points;
+
+        move("G0", cut.lead_in);
+        m_stream << "\n" << laser_on << m_options.power << "\n";
+
+        move("G1", cut.entry);
+        m_stream << " F" << m_options.cut_feed << "\n";
+
+        for (size_t pass = 0; pass < m_options.passes; ++pass) {
+            for (size_t i = 1; i <= points.size(); ++i) {
+                move("G1", points[(cut.start + i) % points.size()]);
+                m_stream << "\n";
+            }
+            move("G1", cut.entry);
+            m_stream << "\n";
+        }
+
+        m_stream << "M5\n";
+    }
+}
+
+void GCodeWriter::end() {
+    m_stream << "G0 X0 Y0\n";
+    m_stream << "M2\n";
+    m_stream.flush();
+}
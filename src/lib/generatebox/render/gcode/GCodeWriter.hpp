@@ -0,0 +1,42 @@
+//
+// Created by Hobbyist Maker on 9/24/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_GCODEWRITER_HPP
+#define SILVANUSPRO_GCODEWRITER_HPP
+
+#include "ToolpathPlanner.hpp"
+
+#include <ostream>
+
+namespace silvanus::generatebox::gcode {
+
+    // Feeds are in millimeters per minute, power is the spindle S word.
+    struct GCodeOptions {
+        double cut_feed      = 600;
+        int    power         = 1000;
+        size_t passes        = 1;
+        bool   dynamic_power = true;
+    };
+
+    // Streams laser G-code in millimeters, one contour at a time. The laser is
+    // switched off for every travel move and each sheet after the first one
+    // starts with a pause so the operator can load the next sheet.
+    class GCodeWriter {
+            std::ostream& m_stream;
+            GCodeOptions m_options;
+
+            void move(const char* command, const ToolPoint& point);
+
+        public:
+            GCodeWriter(std::ostream& stream, const GCodeOptions& options) : m_stream{stream}, m_options{options} {};
+
+            void begin();
+            void sheet(const SheetToolpath& toolpath);
+            void end();
+    };
+
+}
+
+#endif //SILVANUSPRO_GCODEWRITER_HPP
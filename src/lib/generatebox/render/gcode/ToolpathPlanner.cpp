@@ -0,0 +1,200 @@
+//
+// Created by Hobbyist Maker on 9/24/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "ToolpathPlanner.hpp"
+
+#include "render/geometry/PanelOutline.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace silvanus::generatebox::gcode;
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::nesting;
+
+namespace {
+
+    auto distance(const ToolPoint& lhs, const ToolPoint& rhs) -> double {
+        return std::hypot(lhs.x - rhs.x, lhs.y - rhs.y);
+    }
+
+    auto plannedCut(const SheetToolpath& toolpath, size_t contour, size_t start, double lead_in) -> PlannedCut {
+        auto const& points = toolpath.contours[contour].points;
+        auto const& from   = points[start];
+        auto const& to     = points[(start + 1) % points.size()];
+        auto const  length = distance(from, to);
+
+        auto const entry = ToolPoint{(from.x + to.x) / 2, (from.y + to.y) / 2};
+
+        // Material is on the left of the direction of travel, so the right hand
+        // normal always points into scrap, for outer contours and holes alike.
+        auto const normal_x = (to.y - from.y) / length;
+        auto const normal_y = (from.x - to.x) / length;
+
+        return {contour, start, {entry.x + normal_x * lead_in, entry.y + normal_y * lead_in}, entry};
+    }
+
+    auto closestCut(const SheetToolpath& toolpath, size_t contour, const ToolPoint& position, double lead_in) -> PlannedCut {
+        auto const& points = toolpath.contours[contour].points;
+
+        auto best          = plannedCut(toolpath, contour, 0, lead_in);
+        auto best_distance = distance(position, best.lead_in);
+        for (size_t start = 1; start < points.size(); ++start) {
+            auto const cut = plannedCut(toolpath, contour, start, lead_in);
+            auto const cut_distance = distance(position, cut.lead_in);
+            if (cut_distance < best_distance) {
+                best          = cut;
+                best_distance = cut_distance;
+            }
+        }
+
+        return best;
+    }
+
+    auto orderNearest(
+        const SheetToolpath& toolpath, std::vector<size_t> remaining, const ToolPoint& origin, double lead_in
+    ) -> std::vector<PlannedCut> {
+        auto ordered  = std::vector<PlannedCut>{};
+        auto position = origin;
+
+        ordered.reserve(remaining.size());
+        while (!remaining.empty()) {
+            auto best          = remaining.end();
+            auto best_cut      = PlannedCut{};
+            auto best_distance = std::numeric_limits<double>::max();
+
+            for (auto candidate = remaining.begin(); candidate != remaining.end(); ++candidate) {
+                auto const cut = closestCut(toolpath, *candidate, position, lead_in);
+                auto const cut_distance = distance(position, cut.lead_in);
+                if (cut_distance < best_distance) {
+                    best          = candidate;
+                    best_cut      = cut;
+                    best_distance = cut_distance;
+                }
+            }
+
+            ordered.push_back(best_cut);
+            position = best_cut.entry;
+            remaining.erase(best);
+        }
+
+        return ordered;
+    }
+
+    // Classic 2-opt over an open path that starts at origin. Each cut is treated
+    // as the single point of its lead-in; the entry is only a lead-in away and the
+    // starts are reseated afterwards anyway.
+    void improveOrder(std::vector<PlannedCut>& cuts, const ToolPoint& origin, size_t passes) {
+        auto const count = cuts.size();
+        if (count < 3) return;
+
+        auto const point = [&cuts, &origin](size_t index) -> const ToolPoint& {
+            return index == 0 ? origin : cuts[index - 1].lead_in;
+        };
+
+        for (size_t pass = 0; pass < passes; ++pass) {
+            auto improved = false;
+
+            for (size_t first = 1; first < count; ++first) {
+                for (size_t last = first + 1; last <= count; ++last) {
+                    auto const before = distance(point(first - 1), point(first)) +
+                                        (last < count ? distance(point(last), point(last + 1)) : 0);
+                    auto const after  = distance(point(first - 1), point(last)) +
+                                        (last < count ? distance(point(first), point(last + 1)) : 0);
+
+                    if (after < before - 1e-9) {
+                        std::reverse(cuts.begin() + (long) first - 1, cuts.begin() + (long) last);
+                        improved = true;
+                    }
+                }
+            }
+
+            if (!improved) break;
+        }
+    }
+
+}
+
+auto silvanus::generatebox::gcode::collectContours(
+    const std::vector<PanelGeometry>& panels,
+    const NestingResult& nesting
+) -> std::vector<SheetToolpath> {
+    auto sheets = std::vector<SheetToolpath>(nesting.sheets);
+    for (size_t i = 0; i < sheets.size(); ++i) {
+        sheets[i].sheet = i;
+    }
+
+    auto outliner = PanelOutliner{};
+    auto outline  = PanelOutline{};
+
+    for (auto const& placement: nesting.placements) {
+        auto const& panel = panels[placement.id];
+        auto&       sheet = sheets[placement.sheet];
+
+        outliner.build(panel, outline);
+
+        for (auto const& loop: outline.loops) {
+            auto contour = CutContour{placement.id, loop.hole, {}};
+            contour.points.reserve(loop.count);
+
+            for (size_t i = 0; i < loop.count; ++i) {
+                auto const& point = outline.points[loop.first + i];
+
+                // A quarter turn counter-clockwise keeps the winding, and with it
+                // the side the material is on.
+                if (placement.rotated) {
+                    contour.points.push_back({placement.x + panel.width - point.v, placement.y + point.u});
+                } else {
+                    contour.points.push_back({placement.x + point.u, placement.y + point.v});
+                }
+            }
+
+            sheet.contours.push_back(std::move(contour));
+        }
+    }
+
+    return sheets;
+}
+
+void silvanus::generatebox::gcode::planToolpath(SheetToolpath& toolpath, const ToolpathOptions& options) {
+    auto inner = std::vector<size_t>{};
+    auto outer = std::vector<size_t>{};
+
+    for (size_t i = 0; i < toolpath.contours.size(); ++i) {
+        (toolpath.contours[i].inner ? inner : outer).push_back(i);
+    }
+
+    toolpath.cuts.clear();
+    toolpath.cuts.reserve(toolpath.contours.size());
+
+    auto position = ToolPoint{};
+    for (auto const& group: {inner, outer}) {
+        auto ordered = std::vector<PlannedCut>{};
+
+        if (options.optimize) {
+            ordered = orderNearest(toolpath, group, position, options.lead_in);
+            improveOrder(ordered, position, options.passes);
+        } else {
+            for (auto const contour: group) {
+                ordered.push_back(plannedCut(toolpath, contour, 0, options.lead_in));
+            }
+        }
+
+        if (!ordered.empty()) position = ordered.back().entry;
+        toolpath.cuts.insert(toolpath.cuts.end(), ordered.begin(), ordered.end());
+    }
+
+    position = ToolPoint{};
+    toolpath.travel = 0;
+    for (auto& cut: toolpath.cuts) {
+        if (options.optimize) {
+            cut = closestCut(toolpath, cut.contour, position, options.lead_in);
+        }
+
+        toolpath.travel += distance(position, cut.lead_in);
+        position = cut.entry;
+    }
+}
@@ -0,0 +1,67 @@
+//
+// Created by Hobbyist Maker on 9/24/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_TOOLPATHPLANNER_HPP
+#define SILVANUSPRO_TOOLPATHPLANNER_HPP
+
+#include "render/geometry/PanelGeometry.hpp"
+#include "render/nesting/SheetNester.hpp"
+
+#include <vector>
+
+namespace silvanus::generatebox::gcode {
+
+    struct ToolPoint {
+        double x = 0;
+        double y = 0;
+    };
+
+    // A closed contour placed on a sheet, with the material on its left like the
+    // panel outline it was taken from.
+    struct CutContour {
+        size_t                 part  = 0;
+        bool                   inner = false;
+        std::vector<ToolPoint> points;
+    };
+
+    // One contour in cutting order. The cut starts in the middle of edge `start`,
+    // entered from `lead_in` on the scrap side, and finishes back at that point.
+    struct PlannedCut {
+        size_t    contour = 0;
+        size_t    start   = 0;
+        ToolPoint lead_in;
+        ToolPoint entry;
+    };
+
+    struct SheetToolpath {
+        size_t                  sheet  = 0;
+        std::vector<CutContour> contours;
+        std::vector<PlannedCut> cuts;
+        double                  travel = 0;
+    };
+
+    struct ToolpathOptions {
+        double lead_in  = 0.1;
+        bool   optimize = true;
+        size_t passes   = 50;
+    };
+
+    // Places the outline of every nested panel on its sheet. Placement ids index
+    // into panels, as produced by nesting::nestingParts(panels).
+    auto collectContours(
+        const std::vector<geometry::PanelGeometry>& panels,
+        const nesting::NestingResult& nesting
+    ) -> std::vector<SheetToolpath>;
+
+    // Orders the contours of a sheet: every inner contour is cut before any outer
+    // one so parts never drop out of the sheet before their holes are done. Each
+    // group is ordered nearest neighbour first and then improved with 2-opt, after
+    // which the start of every contour is moved to the edge closest to the cut
+    // before it.
+    void planToolpath(SheetToolpath& toolpath, const ToolpathOptions& options = {});
+
+}
+
+#endif //SILVANUSPRO_TOOLPATHPLANNER_HPP
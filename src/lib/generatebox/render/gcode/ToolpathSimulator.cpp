@@ -0,0 +1,143 @@
+//
+// Created by Hobbyist Maker on 9/24/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "ToolpathSimulator.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace silvanus::generatebox::gcode;
+
+namespace {
+
+    struct Word {
+        char   letter = 0;
+        double value  = 0;
+    };
+
+    auto parseWords(std::string line) -> std::vector<Word> {
+        auto const semicolon = line.find(';');
+        if (semicolon != std::string::npos) line.erase(semicolon);
+
+        auto words = std::vector<Word>{};
+        auto const* cursor = line.c_str();
+        auto depth = 0;
+
+        while (*cursor != '\0') {
+            auto const character = *cursor;
+            if (character == '(') ++depth;
+            if (character == ')') depth = std::max(0, depth - 1);
+
+            if (depth > 0 || !std::isalpha(static_cast<unsigned char>(character))) {
+                ++cursor;
+                continue;
+            }
+
+            char* end = nullptr;
+            auto const value = std::strtod(cursor + 1, &end);
+            words.push_back({static_cast<char>(std::toupper(static_cast<unsigned char>(character))), value});
+            cursor = end == cursor + 1 ? cursor + 1 : end;
+        }
+
+        return words;
+    }
+
+}
+
+auto silvanus::generatebox::gcode::simulateGCode(std::istream& stream, double rapid_feed) -> ToolpathSimulation {
+    auto simulation = ToolpathSimulation{};
+
+    auto position = ToolPoint{};
+    auto scale    = 1.0;
+    auto absolute = true;
+    auto motion   = 0;
+    auto laser    = false;
+    auto power    = 0.0;
+    auto feed     = 0.0;
+    auto cutting  = false;
+
+    auto const extend = [&simulation](const ToolPoint& point) {
+        if (simulation.cuts.size() == 1 && simulation.cuts.front().size() == 1) {
+            simulation.min = point;
+            simulation.max = point;
+        }
+        simulation.min = {std::min(simulation.min.x, point.x), std::min(simulation.min.y, point.y)};
+        simulation.max = {std::max(simulation.max.x, point.x), std::max(simulation.max.y, point.y)};
+    };
+
+    auto line = std::string{};
+    while (std::getline(stream, line)) {
+        auto x = std::optional<double>{};
+        auto y = std::optional<double>{};
+
+        for (auto const& word: parseWords(line)) {
+            auto const code = static_cast<int>(std::lround(word.value));
+
+            switch (word.letter) {
+                case 'G':
+                    switch (code) {
+                        case 0:
+                        case 1: motion = code; break;
+                        case 20: scale = 25.4; break;
+                        case 21: scale = 1.0; break;
+                        case 90: absolute = true; break;
+                        case 91: absolute = false; break;
+                        default: ++simulation.unsupported;
+                    }
+                    break;
+                case 'M':
+                    switch (code) {
+                        case 3:
+                        case 4: laser = true; break;
+                        case 5: laser = false; cutting = false; break;
+                        case 0:
+                        case 2: break;
+                        default: ++simulation.unsupported;
+                    }
+                    break;
+                case 'X': x = word.value * scale; break;
+                case 'Y': y = word.value * scale; break;
+                case 'F': feed = word.value * scale; break;
+                case 'S': power = word.value; break;
+                default: ++simulation.unsupported;
+            }
+        }
+
+        if (!x && !y) continue;
+
+        auto target = position;
+        if (x) target.x = absolute ? *x : position.x + *x;
+        if (y) target.y = absolute ? *y : position.y + *y;
+
+        auto const length = std::hypot(target.x - position.x, target.y - position.y);
+
+        if (motion == 1 && laser && power > 0) {
+            if (!cutting) {
+                ++simulation.pierces;
+                simulation.cuts.push_back({position});
+                extend(position);
+                cutting = true;
+            }
+            simulation.cuts.back().push_back(target);
+            extend(target);
+
+            simulation.cut_length += length;
+            if (feed > 0) simulation.time += length / feed * 60;
+        } else {
+            cutting = false;
+            simulation.travel_length += length;
+            simulation.time += length / (motion == 0 || feed <= 0 ? rapid_feed : feed) * 60;
+        }
+
+        position = target;
+    }
+
+    return simulation;
+}
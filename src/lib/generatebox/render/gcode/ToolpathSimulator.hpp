@@ -0,0 +1,36 @@
+//
+// Created by Hobbyist Maker on 9/24/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_TOOLPATHSIMULATOR_HPP
+#define SILVANUSPRO_TOOLPATHSIMULATOR_HPP
+
+#include "ToolpathPlanner.hpp"
+
+#include <istream>
+#include <vector>
+
+namespace silvanus::generatebox::gcode {
+
+    // Everything is in the machine's millimeters; times are in seconds.
+    struct ToolpathSimulation {
+        std::vector<std::vector<ToolPoint>> cuts;
+        double    cut_length    = 0;
+        double    travel_length = 0;
+        double    time          = 0;
+        size_t    pierces       = 0;
+        size_t    unsupported   = 0;
+        ToolPoint min;
+        ToolPoint max;
+    };
+
+    // Replays the subset of G-code the writer emits (G0, G1, G20, G21, G90, G91,
+    // M0 and M2-M5 with F and S words) and measures what the machine would do. Every
+    // time the laser comes on a new cut starts, so each contour of the job can
+    // be checked on its own. Any other command is counted as unsupported.
+    auto simulateGCode(std::istream& stream, double rapid_feed = 6000) -> ToolpathSimulation;
+
+}
+
+#endif //SILVANUSPRO_TOOLPATHSIMULATOR_HPP
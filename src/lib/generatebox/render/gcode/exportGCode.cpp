@@ -0,0 +1,45 @@
+//
+// Created by Hobbyist Maker on 9/24/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "exportGCode.hpp"
+
+#include "render/geometry/collectPanelGeometry.hpp"
+
+#include <plog/Log.h>
+
+using namespace silvanus::generatebox::gcode;
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::nesting;
+
+auto silvanus::generatebox::gcode::writeGCode(
+    const std::vector<PanelGeometry>& panels,
+    std::ostream& stream,
+    const GCodeExportOptions& options
+) -> size_t {
+    auto const nested = nest(nestingParts(panels), options.nesting);
+    auto toolpaths    = collectContours(panels, nested);
+
+    for (auto const id: nested.unplaced) {
+        PLOG_DEBUG << "Panel " << panels[id].name << " does not fit on the stock sheet";
+    }
+
+    auto writer = GCodeWriter(stream, options.gcode);
+
+    writer.begin();
+    for (auto& toolpath: toolpaths) {
+        planToolpath(toolpath, options.toolpath);
+        writer.sheet(toolpath);
+
+        PLOG_DEBUG << "Sheet " << toolpath.sheet + 1 << ": " << toolpath.cuts.size()
+                   << " contours, " << toolpath.travel << "cm travel";
+    }
+    writer.end();
+
+    return nested.placements.size();
+}
+
+auto silvanus::generatebox::gcode::exportGCode(entt::registry& registry, std::ostream& stream, const GCodeExportOptions& options) -> size_t {
+    return writeGCode(collectPanelGeometry(registry), stream, options);
+}
@@ -0,0 +1,39 @@
+//
+// Created by Hobbyist Maker on 9/24/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_EXPORTGCODE_HPP
+#define SILVANUSPRO_EXPORTGCODE_HPP
+
+#include "GCodeWriter.hpp"
+#include "ToolpathPlanner.hpp"
+#include "render/geometry/PanelGeometry.hpp"
+#include "render/nesting/SheetNester.hpp"
+
+#include <entt/entt.hpp>
+
+#include <ostream>
+#include <vector>
+
+namespace silvanus::generatebox::gcode {
+
+    struct GCodeExportOptions {
+        nesting::NestingOptions nesting{{60, 40}};
+        ToolpathOptions         toolpath;
+        GCodeOptions            gcode;
+    };
+
+    // Nests the panels, plans the toolpath of every sheet and streams it out, one
+    // sheet at a time. Returns the number of panels that made it onto a sheet.
+    auto writeGCode(
+        const std::vector<geometry::PanelGeometry>& panels,
+        std::ostream& stream,
+        const GCodeExportOptions& options = {}
+    ) -> size_t;
+
+    auto exportGCode(entt::registry& registry, std::ostream& stream, const GCodeExportOptions& options = {}) -> size_t;
+
+}
+
+#endif //SILVANUSPRO_EXPORTGCODE_HPP
@@ -0,0 +1,55 @@
+//
+// Created by Hobbyist Maker on 9/30/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "CoordinateExpressions.hpp"
+
+#include "PanelGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace silvanus::generatebox::geometry;
+
+void CoordinateExpressions::add(axisExpressions& axis, double value, const std::string& expression) {
+    if (expression.empty()) return;
+
+    axis.emplace_back(value, expression);
+}
+
+void CoordinateExpressions::sort(axisExpressions& axis) {
+    std::stable_sort(axis.begin(), axis.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+}
+
+auto CoordinateExpressions::find(const axisExpressions& axis, double value) -> const std::string& {
+    static auto const none = std::string{};
+
+    auto const position = std::lower_bound(
+        axis.begin(), axis.end(), value - PanelGrid::tolerance, [](const auto& entry, double key) { return entry.first < key; }
+    );
+    if (position == axis.end() || std::abs(position->first - value) >= PanelGrid::tolerance) return none;
+
+    return position->second;
+}
+
+void CoordinateExpressions::build(const PanelGeometry& panel, const PanelExpressions& expressions) {
+    m_u.clear();
+    m_v.clear();
+
+    add(m_u, panel.length, expressions.length);
+    add(m_v, panel.width, expressions.width);
+
+    for (size_t i = 0; i < panel.cuts.size() && i < expressions.cuts.size(); ++i) {
+        auto const& cut        = panel.cuts[i];
+        auto const& expression = expressions.cuts[i];
+
+        add(m_u, cut.min_u, expression.min_u);
+        add(m_u, cut.max_u, expression.max_u);
+        add(m_v, cut.min_v, expression.min_v);
+        add(m_v, cut.max_v, expression.max_v);
+    }
+
+    sort(m_u);
+    sort(m_v);
+}
@@ -0,0 +1,41 @@
+//
+// Created by Hobbyist Maker on 9/30/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_COORDINATEEXPRESSIONS_HPP
+#define SILVANUSPRO_COORDINATEEXPRESSIONS_HPP
+
+#include "PanelGeometry.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace silvanus::generatebox::geometry {
+
+    // Finds the expression behind a coordinate of a panel outline. Outline points
+    // only carry values, so every value the panel was built from is kept with its
+    // expression along its axis, and looked up again within the grid tolerance.
+    // The panel length and width win over cut edges that were clamped to them.
+    class CoordinateExpressions {
+            using axisExpressions = std::vector<std::pair<double, std::string>>;
+
+            axisExpressions m_u;
+            axisExpressions m_v;
+
+            static void add(axisExpressions& axis, double value, const std::string& expression);
+            static void sort(axisExpressions& axis);
+            [[nodiscard]] static auto find(const axisExpressions& axis, double value) -> const std::string&;
+
+        public:
+            void build(const PanelGeometry& panel, const PanelExpressions& expressions);
+
+            // Empty when the value isn't driven by a parameter.
+            [[nodiscard]] auto u(double value) const -> const std::string& { return find(m_u, value); };
+            [[nodiscard]] auto v(double value) const -> const std::string& { return find(m_v, value); };
+    };
+
+}
+
+#endif //SILVANUSPRO_COORDINATEEXPRESSIONS_HPP
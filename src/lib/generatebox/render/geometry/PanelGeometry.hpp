@@ -0,0 +1,78 @@
+//
+// Created by Hobbyist Maker on 9/20/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_PANELGEOMETRY_HPP
+#define SILVANUSPRO_PANELGEOMETRY_HPP
+
+#include "entities/AxisAlgebra.hpp"
+#include "entities/AxisFlag.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace silvanus::generatebox::geometry {
+
+    using entities::AxisFlag;
+    using entities::profileAxes;
+
+    // Axis aligned area in the panel profile plane, expressed along the panel's
+    // profile length (u) and profile width (v).
+    struct Rectangle {
+        double min_u = 0;
+        double min_v = 0;
+        double max_u = 0;
+        double max_v = 0;
+    };
+
+    // A finished panel reduced to plain numbers: the profile rectangle, the thickness
+    // it is extruded along its orientation axis, and every finger and corner cut
+    // that passes through it. Nothing in here depends on Fusion. Dimensions already
+    // include the kerf adjustments; kerf is kept so exporters can report it.
+    struct PanelGeometry {
+        std::string            name;
+        AxisFlag               orientation = AxisFlag::Length;
+        double                 length      = 0;
+        double                 width       = 0;
+        double                 thickness   = 0;
+        double                 offset      = 0;
+        double                 kerf        = 0;
+        std::vector<Rectangle> cuts;
+    };
+
+    // The user parameter expressions behind a PanelGeometry, field for field, so a
+    // parametric renderer can dimension the outline to the same parameters the
+    // values came from. An empty expression means the value is not driven by a
+    // parameter and is used as is.
+    struct RectangleExpressions {
+        std::string min_u;
+        std::string min_v;
+        std::string max_u;
+        std::string max_v;
+    };
+
+    struct PanelExpressions {
+        std::string                       length;
+        std::string                       width;
+        std::string                       thickness;
+        std::string                       offset;
+        std::vector<RectangleExpressions> cuts;
+    };
+
+    // Converts a point in panel space (profile u, profile v, depth into the panel)
+    // into box space (length, width, height).
+    inline auto toBoxSpace(const PanelGeometry& panel, double u, double v, double t) -> std::array<double, 3> {
+        auto const [u_axis, v_axis] = profileAxes(panel.orientation);
+
+        auto point = std::array<double, 3>{};
+        point[static_cast<size_t>(u_axis)] = u;
+        point[static_cast<size_t>(v_axis)] = v;
+        point[static_cast<size_t>(panel.orientation)] = panel.offset + t;
+        return point;
+    }
+
+}
+
+#endif //SILVANUSPRO_PANELGEOMETRY_HPP
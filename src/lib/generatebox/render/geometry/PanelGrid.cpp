@@ -0,0 +1,57 @@
+//
+// Created by Hobbyist Maker on 9/20/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "PanelGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace silvanus::generatebox::geometry;
+
+void PanelGrid::build(const PanelGeometry& panel) {
+    m_u.clear();
+    m_v.clear();
+
+    m_u.push_back(0);
+    m_u.push_back(panel.length);
+    m_v.push_back(0);
+    m_v.push_back(panel.width);
+
+    for (auto const& cut: panel.cuts) {
+        m_u.push_back(std::clamp(cut.min_u, 0.0, panel.length));
+        m_u.push_back(std::clamp(cut.max_u, 0.0, panel.length));
+        m_v.push_back(std::clamp(cut.min_v, 0.0, panel.width));
+        m_v.push_back(std::clamp(cut.max_v, 0.0, panel.width));
+    }
+
+    auto const nearly_equal = [](double lhs, double rhs) { return std::abs(lhs - rhs) < tolerance; };
+
+    std::sort(m_u.begin(), m_u.end());
+    m_u.erase(std::unique(m_u.begin(), m_u.end(), nearly_equal), m_u.end());
+    std::sort(m_v.begin(), m_v.end());
+    m_v.erase(std::unique(m_v.begin(), m_v.end(), nearly_equal), m_v.end());
+
+    m_solid.assign(columns() * rows(), 1);
+
+    for (auto const& cut: panel.cuts) {
+        auto const first_column = locate(m_u, std::clamp(cut.min_u, 0.0, panel.length));
+        auto const last_column  = locate(m_u, std::clamp(cut.max_u, 0.0, panel.length));
+        auto const first_row    = locate(m_v, std::clamp(cut.min_v, 0.0, panel.width));
+        auto const last_row     = locate(m_v, std::clamp(cut.max_v, 0.0, panel.width));
+
+        for (auto row = first_row; row < last_row; ++row) {
+            std::fill(
+                m_solid.begin() + row * columns() + first_column,
+                m_solid.begin() + row * columns() + last_column,
+                0
+            );
+        }
+    }
+}
+
+auto PanelGrid::locate(const std::vector<double>& edges, double value) -> size_t {
+    auto const position = std::lower_bound(edges.begin(), edges.end(), value - tolerance);
+    return std::distance(edges.begin(), position);
+}
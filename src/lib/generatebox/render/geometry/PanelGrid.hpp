@@ -0,0 +1,47 @@
+//
+// Created by Hobbyist Maker on 9/20/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_PANELGRID_HPP
+#define SILVANUSPRO_PANELGRID_HPP
+
+#include "PanelGeometry.hpp"
+
+#include <vector>
+
+namespace silvanus::generatebox::geometry {
+
+    // Every cut is an axis aligned rectangle, so the material left in a panel is
+    // exactly described by the grid formed from the distinct cut edges, with each
+    // cell either solid or removed. The buffers are kept between panels so a
+    // single grid can be reused for a whole box without reallocating.
+    class PanelGrid {
+            std::vector<double> m_u;
+            std::vector<double> m_v;
+            std::vector<char>   m_solid;
+
+            [[nodiscard]] static auto locate(const std::vector<double>& edges, double value) -> size_t;
+
+        public:
+            static constexpr double tolerance = 1e-7;
+
+            void build(const PanelGeometry& panel);
+
+            [[nodiscard]] auto columns() const -> size_t { return m_u.empty() ? 0 : m_u.size() - 1; };
+            [[nodiscard]] auto rows() const -> size_t { return m_v.empty() ? 0 : m_v.size() - 1; };
+
+            [[nodiscard]] auto u(size_t column) const -> double { return m_u[column]; };
+            [[nodiscard]] auto v(size_t row) const -> double { return m_v[row]; };
+
+            // Cells outside of the grid are reported as empty so boundary checks
+            // don't need special cases at the panel edges.
+            [[nodiscard]] auto solid(long column, long row) const -> bool {
+                if (column < 0 || row < 0 || column >= (long) columns() || row >= (long) rows()) return false;
+                return m_solid[row * columns() + column];
+            };
+    };
+
+}
+
+#endif //SILVANUSPRO_PANELGRID_HPP
@@ -0,0 +1,147 @@
+//
+// Created by Hobbyist Maker on 9/20/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "PanelMesh.hpp"
+
+using namespace silvanus::generatebox::geometry;
+
+namespace {
+
+    auto axisNormal(AxisFlag axis, double direction) -> std::array<double, 3> {
+        auto normal = std::array<double, 3>{0, 0, 0};
+        normal[static_cast<size_t>(axis)] = direction;
+        return normal;
+    }
+
+}
+
+void PanelMesher::append(const PanelGeometry& panel, Mesh& mesh) {
+    m_grid.build(panel);
+
+    addFaces(panel, mesh);
+    addLengthWalls(panel, mesh);
+    addWidthWalls(panel, mesh);
+}
+
+void PanelMesher::addFaces(const PanelGeometry& panel, Mesh& mesh) const {
+    auto const inside  = axisNormal(panel.orientation, -1);
+    auto const outside = axisNormal(panel.orientation, 1);
+
+    for (long row = 0; row < (long) m_grid.rows(); ++row) {
+        auto column = 0L;
+        while (column < (long) m_grid.columns()) {
+            if (!m_grid.solid(column, row)) {
+                ++column;
+                continue;
+            }
+
+            auto const start = column;
+            while (column < (long) m_grid.columns() && m_grid.solid(column, row)) ++column;
+
+            auto const min_u = m_grid.u(start);
+            auto const max_u = m_grid.u(column);
+            auto const min_v = m_grid.v(row);
+            auto const max_v = m_grid.v(row + 1);
+
+            for (auto const& [depth, normal]: {std::make_pair(0.0, inside), std::make_pair(panel.thickness, outside)}) {
+                addQuad(mesh, {
+                    toBoxSpace(panel, min_u, min_v, depth),
+                    toBoxSpace(panel, max_u, min_v, depth),
+                    toBoxSpace(panel, max_u, max_v, depth),
+                    toBoxSpace(panel, min_u, max_v, depth)
+                }, normal);
+            }
+        }
+    }
+}
+
+void PanelMesher::addLengthWalls(const PanelGeometry& panel, Mesh& mesh) const {
+    auto const u_axis = profileAxes(panel.orientation).length;
+
+    for (long column = 0; column <= (long) m_grid.columns(); ++column) {
+        auto row = 0L;
+        while (row < (long) m_grid.rows()) {
+            auto const side = m_grid.solid(column - 1, row) - m_grid.solid(column, row);
+            if (side == 0) {
+                ++row;
+                continue;
+            }
+
+            auto const start = row;
+            while (row < (long) m_grid.rows() && (m_grid.solid(column - 1, row) - m_grid.solid(column, row)) == side) ++row;
+
+            auto const u     = m_grid.u(column);
+            auto const min_v = m_grid.v(start);
+            auto const max_v = m_grid.v(row);
+
+            addQuad(mesh, {
+                toBoxSpace(panel, u, min_v, 0),
+                toBoxSpace(panel, u, max_v, 0),
+                toBoxSpace(panel, u, max_v, panel.thickness),
+                toBoxSpace(panel, u, min_v, panel.thickness)
+            }, axisNormal(u_axis, side));
+        }
+    }
+}
+
+void PanelMesher::addWidthWalls(const PanelGeometry& panel, Mesh& mesh) const {
+    auto const v_axis = profileAxes(panel.orientation).width;
+
+    for (long row = 0; row <= (long) m_grid.rows(); ++row) {
+        auto column = 0L;
+        while (column < (long) m_grid.columns()) {
+            auto const side = m_grid.solid(column, row - 1) - m_grid.solid(column, row);
+            if (side == 0) {
+                ++column;
+                continue;
+            }
+
+            auto const start = column;
+            while (column < (long) m_grid.columns() && (m_grid.solid(column, row - 1) - m_grid.solid(column, row)) == side) ++column;
+
+            auto const v     = m_grid.v(row);
+            auto const min_u = m_grid.u(start);
+            auto const max_u = m_grid.u(column);
+
+            addQuad(mesh, {
+                toBoxSpace(panel, min_u, v, 0),
+                toBoxSpace(panel, max_u, v, 0),
+                toBoxSpace(panel, max_u, v, panel.thickness),
+                toBoxSpace(panel, min_u, v, panel.thickness)
+            }, axisNormal(v_axis, side));
+        }
+    }
+}
+
+void PanelMesher::addQuad(
+    Mesh& mesh,
+    const std::array<std::array<double, 3>, 4>& corners,
+    const std::array<double, 3>& normal
+) {
+    auto const first = (int) mesh.vertices();
+
+    for (auto const& corner: corners) {
+        mesh.coordinates.insert(mesh.coordinates.end(), corner.begin(), corner.end());
+        mesh.normals.insert(mesh.normals.end(), normal.begin(), normal.end());
+    }
+
+    // The axis permutation of a panel can mirror the corner order, so wind the
+    // triangles by checking the corners against the outward normal.
+    auto const& a = corners[0];
+    auto const& b = corners[1];
+    auto const& c = corners[2];
+    auto const cross = std::array<double, 3>{
+        (b[1] - a[1]) * (c[2] - a[2]) - (b[2] - a[2]) * (c[1] - a[1]),
+        (b[2] - a[2]) * (c[0] - a[0]) - (b[0] - a[0]) * (c[2] - a[2]),
+        (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0])
+    };
+    auto const facing = cross[0] * normal[0] + cross[1] * normal[1] + cross[2] * normal[2];
+
+    if (facing >= 0) {
+        mesh.indices.insert(mesh.indices.end(), {first, first + 1, first + 2, first, first + 2, first + 3});
+    } else {
+        mesh.indices.insert(mesh.indices.end(), {first, first + 2, first + 1, first, first + 3, first + 2});
+    }
+}
@@ -0,0 +1,57 @@
+//
+// Created by Hobbyist Maker on 9/20/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_PANELMESH_HPP
+#define SILVANUSPRO_PANELMESH_HPP
+
+#include "PanelGeometry.hpp"
+#include "PanelGrid.hpp"
+
+#include <array>
+#include <vector>
+
+namespace silvanus::generatebox::geometry {
+
+    // Flat triangle list laid out the way Fusion custom graphics consumes it:
+    // xyz triplets for coordinates and normals, one normal per coordinate, and
+    // counter-clockwise triangles when viewed from outside the panel.
+    struct Mesh {
+        std::vector<double> coordinates;
+        std::vector<double> normals;
+        std::vector<int>    indices;
+
+        void clear() {
+            coordinates.clear();
+            normals.clear();
+            indices.clear();
+        }
+
+        [[nodiscard]] auto vertices() const -> size_t { return coordinates.size() / 3; };
+        [[nodiscard]] auto triangles() const -> size_t { return indices.size() / 3; };
+    };
+
+    // Triangulates finger jointed panels by extruding the solid cells of the
+    // panel grid: merged cell runs become the two faces, and every change between
+    // solid and removed cells becomes a side wall.
+    class PanelMesher {
+            PanelGrid m_grid;
+
+            static void addQuad(
+                Mesh& mesh,
+                const std::array<std::array<double, 3>, 4>& corners,
+                const std::array<double, 3>& normal
+            );
+
+            void addFaces(const PanelGeometry& panel, Mesh& mesh) const;
+            void addLengthWalls(const PanelGeometry& panel, Mesh& mesh) const;
+            void addWidthWalls(const PanelGeometry& panel, Mesh& mesh) const;
+
+        public:
+            void append(const PanelGeometry& panel, Mesh& mesh);
+    };
+
+}
+
+#endif //SILVANUSPRO_PANELMESH_HPP
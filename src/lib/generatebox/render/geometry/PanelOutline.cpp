@@ -0,0 +1,161 @@
+//
+// Created by Hobbyist Maker on 9/21/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "PanelOutline.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+using namespace silvanus::generatebox::geometry;
+
+namespace {
+
+    // Boundary edges are stored per grid vertex as a mask of outgoing directions,
+    // oriented so the solid cell is always on the left of the edge.
+    enum Direction : std::uint8_t {
+        PositiveU = 0, PositiveV = 1, NegativeU = 2, NegativeV = 3
+    };
+
+    constexpr auto bit(unsigned direction) -> std::uint8_t { return (std::uint8_t) (1u << direction); }
+
+}
+
+void PanelOutliner::build(const PanelGeometry& panel, PanelOutline& outline) {
+    outline.clear();
+    outline.points.reserve(4 + 8 * panel.cuts.size());
+
+    m_grid.build(panel);
+    if (m_grid.columns() == 0 || m_grid.rows() == 0) return;
+
+    collectEdges();
+    traceLoops(outline);
+}
+
+void PanelOutliner::collectEdges() {
+    auto const columns = (long) m_grid.columns();
+    auto const rows    = (long) m_grid.rows();
+    auto const stride  = columns + 1;
+
+    m_edges.assign(stride * (rows + 1), 0);
+
+    for (long row = 0; row < rows; ++row) {
+        for (long column = 0; column <= columns; ++column) {
+            auto const left  = m_grid.solid(column - 1, row);
+            auto const right = m_grid.solid(column, row);
+
+            if (left && !right) m_edges[row * stride + column] |= bit(PositiveV);
+            if (right && !left) m_edges[(row + 1) * stride + column] |= bit(NegativeV);
+        }
+    }
+
+    for (long row = 0; row <= rows; ++row) {
+        for (long column = 0; column < columns; ++column) {
+            auto const above = m_grid.solid(column, row);
+            auto const below = m_grid.solid(column, row - 1);
+
+            if (above && !below) m_edges[row * stride + column] |= bit(PositiveU);
+            if (below && !above) m_edges[row * stride + column + 1] |= bit(NegativeU);
+        }
+    }
+}
+
+void PanelOutliner::traceLoops(PanelOutline& outline) {
+    auto const stride = (long) m_grid.columns() + 1;
+    auto const steps  = std::array<long, 4>{1, stride, -1, -stride};
+
+    auto const point = [this, stride](long vertex) {
+        return OutlinePoint{m_grid.u(vertex % stride), m_grid.v(vertex / stride)};
+    };
+
+    for (long start = 0; start < (long) m_edges.size(); ++start) {
+        while (m_edges[start]) {
+            auto direction = 0u;
+            while (!(m_edges[start] & bit(direction))) ++direction;
+
+            m_loop.clear();
+
+            auto vertex = start;
+            while (true) {
+                m_loop.push_back(point(vertex));
+                m_edges[vertex] &= (std::uint8_t) ~bit(direction);
+                vertex += steps[direction];
+
+                if (vertex == start) break;
+
+                // Prefer turning left so solid regions that only touch at a corner
+                // are traced as separate contours.
+                auto const mask  = m_edges[vertex];
+                auto       found = false;
+                for (auto const turn: {1u, 0u, 3u}) {
+                    auto const candidate = (direction + turn) % 4;
+                    if (mask & bit(candidate)) {
+                        direction = candidate;
+                        found     = true;
+                        break;
+                    }
+                }
+                if (!found) break;
+            }
+
+            // Only the corners are kept; the grid walk emits a point on every cell edge.
+            auto const first = outline.points.size();
+            auto const count = m_loop.size();
+            for (size_t i = 0; i < count; ++i) {
+                auto const& previous = m_loop[(i + count - 1) % count];
+                auto const& current  = m_loop[i];
+                auto const& next     = m_loop[(i + 1) % count];
+
+                auto const along_u = previous.v == current.v && current.v == next.v;
+                auto const along_v = previous.u == current.u && current.u == next.u;
+                if (along_u || along_v) continue;
+
+                outline.points.push_back(current);
+            }
+
+            auto loop  = OutlineLoop{first, outline.points.size() - first, false};
+            loop.hole  = loopArea(outline, loop) < 0;
+            outline.loops.push_back(loop);
+        }
+    }
+
+    std::stable_partition(outline.loops.begin(), outline.loops.end(), [](const OutlineLoop& loop) { return !loop.hole; });
+}
+
+auto silvanus::generatebox::geometry::loopArea(const PanelOutline& outline, const OutlineLoop& loop) -> double {
+    auto area = 0.0;
+    for (size_t i = 0; i < loop.count; ++i) {
+        auto const& current = outline.points[loop.first + i];
+        auto const& next    = outline.points[loop.first + (i + 1) % loop.count];
+        area += current.u * next.v - next.u * current.v;
+    }
+    return area / 2;
+}
+
+auto silvanus::generatebox::geometry::loopLength(const PanelOutline& outline, const OutlineLoop& loop) -> double {
+    auto length = 0.0;
+    for (size_t i = 0; i < loop.count; ++i) {
+        auto const& current = outline.points[loop.first + i];
+        auto const& next    = outline.points[loop.first + (i + 1) % loop.count];
+        length += std::abs(next.u - current.u) + std::abs(next.v - current.v);
+    }
+    return length;
+}
+
+auto silvanus::generatebox::geometry::outlineArea(const PanelOutline& outline) -> double {
+    auto area = 0.0;
+    for (auto const& loop: outline.loops) {
+        area += loopArea(outline, loop);
+    }
+    return area;
+}
+
+auto silvanus::generatebox::geometry::outlineLength(const PanelOutline& outline) -> double {
+    auto length = 0.0;
+    for (auto const& loop: outline.loops) {
+        length += loopLength(outline, loop);
+    }
+    return length;
+}
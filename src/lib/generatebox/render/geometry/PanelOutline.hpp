@@ -0,0 +1,68 @@
+//
+// Created by Hobbyist Maker on 9/21/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_PANELOUTLINE_HPP
+#define SILVANUSPRO_PANELOUTLINE_HPP
+
+#include "PanelGeometry.hpp"
+#include "PanelGrid.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace silvanus::generatebox::geometry {
+
+    struct OutlinePoint {
+        double u = 0;
+        double v = 0;
+    };
+
+    // A closed polyline inside of PanelOutline::points. The closing segment from
+    // the last point back to the first is implied.
+    struct OutlineLoop {
+        size_t first = 0;
+        size_t count = 0;
+        bool   hole  = false;
+    };
+
+    // The cut path of a finished panel in its profile plane. Outer contours run
+    // counter-clockwise and come first, holes left by inside joints run clockwise.
+    struct PanelOutline {
+        std::vector<OutlinePoint> points;
+        std::vector<OutlineLoop>  loops;
+
+        void clear() {
+            points.clear();
+            loops.clear();
+        }
+    };
+
+    // Traces panel outlines from the panel grid. All working storage is owned by
+    // the outliner and only ever grows, so outlining every panel of a box with one
+    // instance allocates once for the largest panel.
+    class PanelOutliner {
+            PanelGrid m_grid;
+            std::vector<std::uint8_t> m_edges;
+            std::vector<OutlinePoint> m_loop;
+
+            void collectEdges();
+            void traceLoops(PanelOutline& outline);
+
+        public:
+            void build(const PanelGeometry& panel, PanelOutline& outline);
+    };
+
+    auto loopArea(const PanelOutline& outline, const OutlineLoop& loop) -> double;
+    auto loopLength(const PanelOutline& outline, const OutlineLoop& loop) -> double;
+
+    // Material area of the panel, holes subtracted.
+    auto outlineArea(const PanelOutline& outline) -> double;
+
+    // Total length of every contour, which is the cut path length of the panel.
+    auto outlineLength(const PanelOutline& outline) -> double;
+
+}
+
+#endif //SILVANUSPRO_PANELOUTLINE_HPP
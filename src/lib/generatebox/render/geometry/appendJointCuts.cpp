@@ -0,0 +1,40 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "appendJointCuts.hpp"
+
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::geometry;
+
+auto silvanus::generatebox::geometry::appendJointCuts(
+    PanelGeometry& panel, const JointProfile& profile, AxisFlag joint_axis, double offset, double distance
+) -> size_t {
+    if ((profile.finger_type == FingerPatternType::None) || (profile.joint_type == JointPatternType::None)) return 0;
+
+    auto const along_u     = profileAxes(panel.orientation).length == joint_axis;
+    auto const joint_start = offset;
+    auto const joint_end   = offset + distance;
+    auto const first       = panel.cuts.size();
+
+    auto const cut = [&](double finger_start, double finger_end) {
+        if (along_u) {
+            panel.cuts.push_back({joint_start, finger_start, joint_end, finger_end});
+        } else {
+            panel.cuts.push_back({finger_start, joint_start, finger_end, joint_end});
+        }
+    };
+
+    for (auto i = 0; i < profile.finger_count; ++i) {
+        auto const finger_start = profile.pattern_offset + i * profile.finger_offset;
+        cut(finger_start, finger_start + profile.finger_width);
+    }
+
+    if (profile.corner_width != 0) {
+        cut(0, profile.corner_width);
+        cut(profile.corner_distance, profile.corner_distance + profile.corner_width);
+    }
+
+    return panel.cuts.size() - first;
+}
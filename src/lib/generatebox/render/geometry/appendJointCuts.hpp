@@ -0,0 +1,28 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_APPENDJOINTCUTS_HPP
+#define SILVANUSPRO_APPENDJOINTCUTS_HPP
+
+#include "PanelGeometry.hpp"
+
+#include "entities/JointProfile.hpp"
+
+#include <cstddef>
+
+namespace silvanus::generatebox::geometry {
+
+    // Adds the finger and corner cuts of one joint to its panel. Every cut spans
+    // [offset, offset + distance] along the joint axis and one finger or corner
+    // along the other profile axis, fingers first and then both corners. Joints
+    // without a finger or joint pattern cut nothing. Returns the number of cuts
+    // added.
+    auto appendJointCuts(
+        PanelGeometry& panel, const entities::JointProfile& profile, AxisFlag joint_axis, double offset, double distance
+    ) -> size_t;
+
+}
+
+#endif //SILVANUSPRO_APPENDJOINTCUTS_HPP
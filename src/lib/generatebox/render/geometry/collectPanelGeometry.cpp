@@ -0,0 +1,142 @@
+//
+// Created by Hobbyist Maker on 9/20/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "collectPanelGeometry.hpp"
+#include "appendJointCuts.hpp"
+
+#include "entities/Enabled.hpp"
+#include "entities/JointEnabled.hpp"
+#include "entities/JointExtrusion.hpp"
+#include "entities/JointGroup.hpp"
+#include "entities/JointOrientation.hpp"
+#include "entities/Kerf.hpp"
+#include "entities/Panel.hpp"
+#include "entities/PanelExtrusion.hpp"
+#include "entities/PanelGroup.hpp"
+#include "entities/ParentPanel.hpp"
+
+#include <fmt/format.h>
+#include <plog/Log.h>
+
+#include <map>
+
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::geometry;
+
+namespace {
+
+    // Places the expressions of a cut the way appendJointCuts places its values,
+    // spanning [joint_start, joint_end] along the joining panel's axis and
+    // [finger_start, finger_end] along the remaining profile axis.
+    auto makeCutExpressions(
+        AxisFlag panel_axis, AxisFlag joint_axis,
+        const std::string& joint_start, const std::string& joint_end,
+        const std::string& finger_start, const std::string& finger_end
+    ) -> RectangleExpressions {
+        if (profileAxes(panel_axis).length == joint_axis) {
+            return {joint_start, finger_start, joint_end, finger_end};
+        }
+        return {finger_start, joint_start, finger_end, joint_end};
+    }
+
+    // Adds two parameter driven values. A zero without an expression drops out of
+    // the sum, any other value without one leaves the sum without an expression.
+    auto sumExpression(double lhs, const std::string& lhs_expression, double rhs, const std::string& rhs_expression) -> std::string {
+        if (lhs_expression.empty() && lhs == 0) return rhs_expression;
+        if (rhs_expression.empty() && rhs == 0) return lhs_expression;
+        if (lhs_expression.empty() || rhs_expression.empty()) return "";
+
+        return fmt::format("({}) + ({})", lhs_expression, rhs_expression);
+    }
+
+    auto collect(entt::registry& registry, std::vector<PanelExpressions>* expressions) -> std::vector<PanelGeometry> {
+        auto panels = std::vector<PanelGeometry>{};
+        auto index  = std::map<entt::entity, size_t>{};
+
+        auto panel_view = registry.view<const Enabled, const Panel, const PanelGroup, const PanelExtrusion, const ParentPanel>().proxy();
+        for (auto &&[entity, enabled, panel, panel_group, extrusion, parent]: panel_view) {
+            if (!enabled.value || index.count(parent.id)) continue;
+
+            index[parent.id] = panels.size();
+
+            auto& geometry       = panels.emplace_back();
+            geometry.name        = panel.name;
+            geometry.orientation = panel_group.orientation;
+            geometry.length      = panel_group.profile.length.value;
+            geometry.width       = panel_group.profile.width.value;
+            geometry.thickness   = extrusion.distance.value;
+            geometry.offset      = extrusion.offset.value;
+
+            if (auto const kerf = registry.try_get<Kerf>(entity)) {
+                geometry.kerf = kerf->value;
+            }
+
+            if (!expressions) continue;
+
+            auto& panel_expressions     = expressions->emplace_back();
+            panel_expressions.length    = panel_group.profile.length.expression;
+            panel_expressions.width     = panel_group.profile.width.expression;
+            panel_expressions.thickness = extrusion.distance.expression;
+            panel_expressions.offset    = extrusion.offset.expression;
+        }
+
+        auto joint_view = registry.view<const Enabled, const JointEnabled, const ParentPanel, const JointGroup, const JointOrientation, const JointExtrusion>().proxy();
+        for (auto &&[entity, enabled, joint_enabled, parent, joint_group, joint_orientation, joint]: joint_view) {
+            if (!enabled.value || !joint_enabled.value) continue;
+
+            auto const position = index.find(parent.id);
+            if (position == index.end()) continue;
+
+            auto&       geometry = panels[position->second];
+            auto const& profile  = joint_group.profile;
+
+            if (appendJointCuts(geometry, profile, joint_orientation.axis, joint.offset.value, joint.distance.value) == 0) continue;
+
+            if (!expressions) continue;
+
+            // Mirrors the cuts appendJointCuts added so every rectangle has its expressions at the same index.
+            auto const& parameters  = jointProfileParams(registry, profile);
+            auto&       cuts        = (*expressions)[position->second].cuts;
+            auto const  joint_begin = joint.offset.expression;
+            auto const  joint_stop  = sumExpression(joint.offset.value, joint.offset.expression, joint.distance.value, joint.distance.expression);
+
+            for (auto i = 0; i < profile.finger_count; ++i) {
+                auto const step = i == 0 || parameters.finger_offset.empty()
+                    ? std::string{}
+                    : (i == 1 ? parameters.finger_offset : fmt::format("{} * ({})", i, parameters.finger_offset));
+                auto const start = sumExpression(profile.pattern_offset, parameters.pattern_offset, i * profile.finger_offset, step);
+                auto const end   = sumExpression(profile.pattern_offset + i * profile.finger_offset, start, profile.finger_width, parameters.finger_width);
+
+                cuts.emplace_back(makeCutExpressions(geometry.orientation, joint_orientation.axis, joint_begin, joint_stop, start, end));
+            }
+
+            if (profile.corner_width == 0) continue;
+
+            cuts.emplace_back(makeCutExpressions(
+                geometry.orientation, joint_orientation.axis, joint_begin, joint_stop, "", parameters.corner_width
+            ));
+            cuts.emplace_back(makeCutExpressions(
+                geometry.orientation, joint_orientation.axis, joint_begin, joint_stop, parameters.corner_distance,
+                sumExpression(profile.corner_distance, parameters.corner_distance, profile.corner_width, parameters.corner_width)
+            ));
+        }
+
+        PLOG_DEBUG << "Collected geometry for " << panels.size() << " panels";
+
+        return panels;
+    }
+
+}
+
+auto silvanus::generatebox::geometry::collectPanelGeometry(entt::registry& registry) -> std::vector<PanelGeometry> {
+    return collect(registry, nullptr);
+}
+
+auto silvanus::generatebox::geometry::collectPanelGeometry(
+    entt::registry& registry, std::vector<PanelExpressions>& expressions
+) -> std::vector<PanelGeometry> {
+    expressions.clear();
+    return collect(registry, &expressions);
+}
@@ -0,0 +1,28 @@
+//
+// Created by Hobbyist Maker on 9/20/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_COLLECTPANELGEOMETRY_HPP
+#define SILVANUSPRO_COLLECTPANELGEOMETRY_HPP
+
+#include "PanelGeometry.hpp"
+
+#include <entt/entt.hpp>
+
+#include <vector>
+
+namespace silvanus::generatebox::geometry {
+
+    // Reduces a registry that has been through ConfigurePanels and ConfigureJoints
+    // to one PanelGeometry per enabled panel, using the same finger and corner
+    // placement as the renderers.
+    auto collectPanelGeometry(entt::registry& registry) -> std::vector<PanelGeometry>;
+
+    // Also fills expressions with one PanelExpressions per returned panel, for
+    // renderers that keep the geometry tied to the user parameters.
+    auto collectPanelGeometry(entt::registry& registry, std::vector<PanelExpressions>& expressions) -> std::vector<PanelGeometry>;
+
+}
+
+#endif //SILVANUSPRO_COLLECTPANELGEOMETRY_HPP
@@ -0,0 +1,227 @@
+//
+// Created by Hobbyist Maker on 9/23/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "SheetNester.hpp"
+
+#include "common/threadpool.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <tuple>
+
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::nesting;
+
+namespace {
+
+    constexpr double tolerance = 1e-9;
+
+    struct FreeArea {
+        double x      = 0;
+        double y      = 0;
+        double length = 0;
+        double width  = 0;
+    };
+
+    struct Fit {
+        FreeArea area;
+        bool     rotated    = false;
+        double   short_side = std::numeric_limits<double>::max();
+        double   long_side  = std::numeric_limits<double>::max();
+    };
+
+    // Max-rects bin: keeps every maximal free rectangle and places each part in
+    // the one that leaves the shortest leftover side.
+    class MaxRectsSheet {
+            std::vector<FreeArea> m_free;
+
+            static auto intersects(const FreeArea& lhs, const FreeArea& rhs) -> bool {
+                return lhs.x < rhs.x + rhs.length - tolerance && rhs.x < lhs.x + lhs.length - tolerance &&
+                       lhs.y < rhs.y + rhs.width - tolerance && rhs.y < lhs.y + lhs.width - tolerance;
+            }
+
+            static auto contains(const FreeArea& outer, const FreeArea& inner) -> bool {
+                return inner.x >= outer.x - tolerance && inner.y >= outer.y - tolerance &&
+                       inner.x + inner.length <= outer.x + outer.length + tolerance &&
+                       inner.y + inner.width <= outer.y + outer.width + tolerance;
+            }
+
+        public:
+            MaxRectsSheet(double length, double width) : m_free{{0, 0, length, width}} {};
+
+            [[nodiscard]] auto find(double length, double width, bool rotatable) const -> Fit {
+                auto best = Fit{};
+
+                auto const consider = [&best](const FreeArea& free, double part_length, double part_width, bool rotated) {
+                    if (part_length > free.length + tolerance || part_width > free.width + tolerance) return;
+
+                    auto const leftover_length = free.length - part_length;
+                    auto const leftover_width  = free.width - part_width;
+                    auto const short_side      = std::min(leftover_length, leftover_width);
+                    auto const long_side       = std::max(leftover_length, leftover_width);
+
+                    if (std::tie(short_side, long_side) < std::tie(best.short_side, best.long_side)) {
+                        best = {{free.x, free.y, part_length, part_width}, rotated, short_side, long_side};
+                    }
+                };
+
+                for (auto const& free: m_free) {
+                    consider(free, length, width, false);
+                    if (rotatable) consider(free, width, length, true);
+                }
+
+                return best;
+            }
+
+            void place(const FreeArea& used) {
+                auto split = std::vector<FreeArea>{};
+                split.reserve(m_free.size() + 4);
+
+                for (auto const& free: m_free) {
+                    if (!intersects(free, used)) {
+                        split.push_back(free);
+                        continue;
+                    }
+
+                    if (used.x > free.x + tolerance) {
+                        split.push_back({free.x, free.y, used.x - free.x, free.width});
+                    }
+                    if (used.x + used.length < free.x + free.length - tolerance) {
+                        split.push_back({used.x + used.length, free.y, free.x + free.length - used.x - used.length, free.width});
+                    }
+                    if (used.y > free.y + tolerance) {
+                        split.push_back({free.x, free.y, free.length, used.y - free.y});
+                    }
+                    if (used.y + used.width < free.y + free.width - tolerance) {
+                        split.push_back({free.x, used.y + used.width, free.length, free.y + free.width - used.y - used.width});
+                    }
+                }
+
+                m_free.clear();
+                for (size_t i = 0; i < split.size(); ++i) {
+                    auto redundant = false;
+                    for (size_t j = 0; j < split.size() && !redundant; ++j) {
+                        if (i == j || !contains(split[j], split[i])) continue;
+                        // Identical areas keep the first copy only.
+                        redundant = !contains(split[i], split[j]) || j < i;
+                    }
+                    if (!redundant) m_free.push_back(split[i]);
+                }
+            }
+    };
+
+    auto packingOrder(const std::vector<NestingPart>& parts, size_t seed, std::uint32_t base_seed) -> std::vector<size_t> {
+        auto order = std::vector<size_t>(parts.size());
+        std::iota(order.begin(), order.end(), 0);
+
+        auto keys = std::vector<double>(parts.size());
+        auto random = std::mt19937{base_seed + (std::uint32_t) seed};
+        auto jitter = std::uniform_real_distribution<double>{0.7, 1.3};
+
+        for (size_t i = 0; i < parts.size(); ++i) {
+            auto const& part = parts[i];
+            switch (seed) {
+                case 0: keys[i] = part.length * part.width; break;
+                case 1: keys[i] = std::max(part.length, part.width); break;
+                case 2: keys[i] = part.length + part.width; break;
+                default: keys[i] = part.length * part.width * jitter(random);
+            }
+        }
+
+        std::stable_sort(order.begin(), order.end(), [&keys](size_t lhs, size_t rhs) { return keys[lhs] > keys[rhs]; });
+        return order;
+    }
+
+    auto pack(const std::vector<NestingPart>& parts, const std::vector<size_t>& order, const NestingOptions& options) -> std::tuple<NestingResult, double> {
+        auto result = NestingResult{};
+        auto sheets = std::vector<MaxRectsSheet>{};
+        auto fill   = std::vector<double>{};
+
+        // Parts are inflated by the spacing and the usable sheet by the same amount,
+        // which leaves exactly one spacing between neighbours and none at the margin.
+        auto const usable_length = options.sheet.length - 2 * options.margin + options.spacing;
+        auto const usable_width  = options.sheet.width - 2 * options.margin + options.spacing;
+
+        for (auto const index: order) {
+            auto const& part      = parts[index];
+            auto const  length    = part.length + options.spacing;
+            auto const  width     = part.width + options.spacing;
+            auto const  rotatable = options.allow_rotation && part.rotatable;
+
+            auto const fits_blank = (length <= usable_length + tolerance && width <= usable_width + tolerance) ||
+                                    (rotatable && width <= usable_length + tolerance && length <= usable_width + tolerance);
+            if (!fits_blank) {
+                result.unplaced.push_back(part.id);
+                continue;
+            }
+
+            auto sheet = size_t{0};
+            auto fit   = Fit{};
+            for (; sheet < sheets.size(); ++sheet) {
+                fit = sheets[sheet].find(length, width, rotatable);
+                if (fit.short_side != std::numeric_limits<double>::max()) break;
+            }
+
+            if (sheet == sheets.size()) {
+                sheets.emplace_back(usable_length, usable_width);
+                fill.push_back(0);
+                fit = sheets.back().find(length, width, rotatable);
+            }
+
+            sheets[sheet].place(fit.area);
+            fill[sheet] += part.length * part.width;
+
+            result.placements.push_back({
+                part.id, sheet, options.margin + fit.area.x, options.margin + fit.area.y, fit.rotated
+            });
+        }
+
+        result.sheets = sheets.size();
+        if (result.sheets > 0) {
+            auto const used = std::accumulate(fill.begin(), fill.end(), 0.0);
+            result.utilization = used / (result.sheets * options.sheet.length * options.sheet.width);
+        }
+
+        return {result, fill.empty() ? 0.0 : fill.back()};
+    }
+
+}
+
+auto silvanus::generatebox::nesting::nestingParts(const std::vector<PanelGeometry>& panels, size_t first_id) -> std::vector<NestingPart> {
+    auto parts = std::vector<NestingPart>{};
+    parts.reserve(panels.size());
+
+    for (size_t i = 0; i < panels.size(); ++i) {
+        parts.push_back({first_id + i, panels[i].length, panels[i].width, true});
+    }
+
+    return parts;
+}
+
+auto silvanus::generatebox::nesting::nest(const std::vector<NestingPart>& parts, const NestingOptions& options) -> NestingResult {
+    auto const seeds = std::max<size_t>(1, options.seeds);
+
+    auto candidates = std::vector<std::tuple<NestingResult, double>>(seeds);
+
+    auto pool = common::ThreadPool(std::min(seeds, options.threads == 0 ? (size_t) std::thread::hardware_concurrency() : options.threads));
+    pool.parallelFor(seeds, [&](size_t seed) {
+        candidates[seed] = pack(parts, packingOrder(parts, seed, options.seed), options);
+        std::get<0>(candidates[seed]).seed = seed;
+    });
+
+    // Fewest unplaced parts, then fewest sheets, then the emptiest last sheet so
+    // the leftover material comes back as one large offcut.
+    auto const best = std::min_element(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+        auto const& [lhs_result, lhs_fill] = lhs;
+        auto const& [rhs_result, rhs_fill] = rhs;
+        return std::make_tuple(lhs_result.unplaced.size(), lhs_result.sheets, lhs_fill) <
+               std::make_tuple(rhs_result.unplaced.size(), rhs_result.sheets, rhs_fill);
+    });
+
+    return std::get<0>(*best);
+}
@@ -0,0 +1,67 @@
+//
+// Created by Hobbyist Maker on 9/23/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_SHEETNESTER_HPP
+#define SILVANUSPRO_SHEETNESTER_HPP
+
+#include "render/geometry/PanelGeometry.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace silvanus::generatebox::nesting {
+
+    // Rectangular footprint of a part. Finger notches are cut into the panel
+    // profile, so the profile rectangle already covers the full finger depth.
+    struct NestingPart {
+        size_t id        = 0;
+        double length    = 0;
+        double width     = 0;
+        bool   rotatable = true;
+    };
+
+    struct StockSheet {
+        double length = 0;
+        double width  = 0;
+    };
+
+    struct NestingOptions {
+        StockSheet    sheet;
+        double        spacing        = 0.5;
+        double        margin         = 0.5;
+        bool          allow_rotation = true;
+        size_t        seeds          = 16;
+        size_t        threads        = 0;
+        std::uint32_t seed           = 1;
+    };
+
+    struct NestedPart {
+        size_t id      = 0;
+        size_t sheet   = 0;
+        double x       = 0;
+        double y       = 0;
+        bool   rotated = false;
+    };
+
+    struct NestingResult {
+        std::vector<NestedPart> placements;
+        std::vector<size_t>     unplaced;
+        size_t                  sheets      = 0;
+        double                  utilization = 0;
+        size_t                  seed        = 0;
+    };
+
+    auto nestingParts(const std::vector<geometry::PanelGeometry>& panels, size_t first_id = 0) -> std::vector<NestingPart>;
+
+    // Packs parts onto as few stock sheets as possible. Each seed packs the parts
+    // in a different order with a max-rects packer; the seeds run in parallel and
+    // the best result wins, ties going to the lowest seed, so the outcome only
+    // depends on options.seed and never on thread timing.
+    auto nest(const std::vector<NestingPart>& parts, const NestingOptions& options) -> NestingResult;
+
+}
+
+#endif //SILVANUSPRO_SHEETNESTER_HPP
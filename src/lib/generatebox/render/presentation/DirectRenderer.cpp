@@ -16,196 +16,199 @@
 #include "entities/JoinedPanels.hpp"
 #include "entities/Panel.hpp"
 
-#include "plog/Log.h"
+#include "PanelRenderDataBuilder.hpp"
+#include "sortPanelGroups.hpp"
 
-#include <map>
-#include <set>
+#include "plog/Log.h"
 
-using namespace adsk::core;
-using namespace adsk::fusion;
+#include <vector>
 
 using namespace silvanus::generatebox::entities;
 using namespace silvanus::generatebox::render;
 
-void DirectRenderer::execute(DefaultModelingOrientations model_orientation, const Ptr<Component> &component) {
-
-    using jointProfileSet = std::set<size_t>;
-    using panelJointGroup = std::map<jointProfileSet, PanelRenderData>;
-    using positionPanelGroup = std::map<Position, panelJointGroup>;
-    using profilePositionGroup = std::map<PanelProfile, positionPanelGroup, ComparePanelProfile>;
-    using axisProfileGroup = std::map<AxisFlag, profilePositionGroup>;
+void DirectRenderer::execute(ModelOrientation model_orientation) {
 
-    auto panel_groups = axisProfileGroup{};
+    auto const& names = nameTable(m_registry);
+    auto enabled_entities = std::vector<entt::entity>{};
 
     auto      view = m_registry.view<Enabled, JointEnabled, Panel, PanelGroup, JointGroup, PanelExtrusion, JointOrientation, JointName, JointExtrusion, JointDirection>().proxy();
     for (auto &&[entity, enabled, joint_enabled, panel, panel_group, joint_group, panel_extrusion, joint_orientation, joint_name, joint_extrusion, joint_direction]: view) {
 
         PLOG_DEBUG << panel.name << " enabled == " << (int) enabled.value;
-        PLOG_DEBUG << panel.name << " joint to " << joint_name.value << " enabled == " << (int) joint_enabled.value;
+        PLOG_DEBUG << panel.name << " joint to " << names.name(joint_name.value) << " enabled == " << (int) joint_enabled.value;
 
         if (!enabled.value || !joint_enabled.value) continue;
 
-        PLOG_DEBUG << "Adding Panel " << panel.name << " with joint to " << joint_name.value << " for direct render";
+        PLOG_DEBUG << "Adding Panel " << panel.name << " with joint to " << names.name(joint_name.value) << " for direct render";
         PLOG_DEBUG << "Joint direction is " << (int)joint_direction.value;
         PLOG_DEBUG << "Joint thickness is " << joint_group.joint_thickness.value;
         PLOG_DEBUG << "Joint pattern type is " << (int)joint_group.profile.joint_type;
 
-        auto& group = panel_groups[panel_group.orientation][panel_group.profile][panel_group.position][joint_group.tag.value]; // Panels with different joints are being grouped together
+        enabled_entities.push_back(entity);
+    }
+
+    if (enabled_entities.empty()) {
+        PLOG_DEBUG << "No panels found to render.";
+        return;
+    }
+
+    auto const sorted = sortPanelGroups(m_registry, enabled_entities);
 
-        group.names.insert(panel_extrusion.name);
-        group.panels[panel_group.distance].insert(panel_extrusion);
+    auto panel_groups = panelRenderGroups{};
+    for (size_t first = 0; first < sorted.size();) {
+        auto const& panel_group = m_registry.get<PanelGroup>(sorted[first].entity);
 
-        if ((joint_group.profile.finger_type == FingerPatternType::None) || (joint_group.profile.joint_type == JointPatternType::None)) {
+        auto builder = PanelRenderDataBuilder{};
+
+        auto last = first;
+        for (; last < sorted.size() && sorted[last].key == sorted[first].key; ++last) {
+            auto const entity = sorted[last].entity;
+            auto const& panel_extrusion = m_registry.get<PanelExtrusion>(entity);
+            auto const& joint_group     = m_registry.get<JointGroup>(entity);
+
+            builder.addPanel(panel_extrusion);
+
+            if ((joint_group.profile.finger_type == FingerPatternType::None) || (joint_group.profile.joint_type == JointPatternType::None)) {
                 continue;
-        }
+            }
 
-        auto& joined_panel_group = group.joints[joint_group.profile.joint_type][joint_group.profile.joint_direction][joint_orientation.axis][joint_group.profile];
-        joined_panel_group.names.insert(joint_name.value);
-        joined_panel_group.extrusions.insert(joint_extrusion);
-
-//        auto distance = joint_extrusion.distance
-        PLOG_DEBUG << "Panel name: " << panel.name;
-        PLOG_DEBUG << "Panel offset: " << panel_extrusion.offset.value;
-        PLOG_DEBUG << "Panel extrusion: " << panel_extrusion.name;
-        PLOG_DEBUG << "Joint extrusion: " << joint_extrusion.name;
-        PLOG_DEBUG << "Joint orientation: " << (int)joint_orientation.axis;
-        PLOG_DEBUG << "Joint distance: " << joint_group.profile.pattern_distance;
-        PLOG_DEBUG << "Joint extrusion distance: " << joint_extrusion.distance.value;
-        PLOG_DEBUG << "Joint profile orientation: " << (int)joint_group.profile.joint_orientation;
-        PLOG_DEBUG << "Joint Group panel orientation: " << (int)joint_group.profile.panel_orientation;
-        PLOG_DEBUG << "Joint extrusion group names is now size of " << joined_panel_group.names.size();
-        PLOG_DEBUG << "Joint extrusion group is now size of " << joined_panel_group.extrusions.size();
-        PLOG_DEBUG << "Joint direction: " << (int)joint_group.profile.joint_direction;
-        PLOG_DEBUG << "Corner width: " << joint_group.profile.corner_width;
-        PLOG_DEBUG << "Corner distance: " << joint_group.profile.corner_distance;
-    }
+            auto const& joint_orientation = m_registry.get<JointOrientation>(entity);
+            auto const& joint_name        = m_registry.get<JointName>(entity);
+            auto const& joint_extrusion   = m_registry.get<JointExtrusion>(entity);
+
+            builder.addJoint(joint_group.profile, joint_orientation.axis, joint_name.value, joint_extrusion);
+
+            PLOG_DEBUG << "Panel offset: " << panel_extrusion.offset.value;
+            PLOG_DEBUG << "Panel extrusion: " << names.name(panel_extrusion.name);
+            PLOG_DEBUG << "Joint extrusion: " << names.name(joint_extrusion.name);
+            PLOG_DEBUG << "Joint orientation: " << (int)joint_orientation.axis;
+            PLOG_DEBUG << "Joint distance: " << joint_group.profile.pattern_distance;
+            PLOG_DEBUG << "Joint extrusion distance: " << joint_extrusion.distance.value;
+            PLOG_DEBUG << "Joint profile orientation: " << (int)joint_group.profile.joint_orientation;
+            PLOG_DEBUG << "Joint Group panel orientation: " << (int)joint_group.profile.panel_orientation;
+            PLOG_DEBUG << "Joint direction: " << (int)joint_group.profile.joint_direction;
+            PLOG_DEBUG << "Corner width: " << joint_group.profile.corner_width;
+            PLOG_DEBUG << "Corner distance: " << joint_group.profile.corner_distance;
+        }
 
-    if (panel_groups.empty()) {
-        PLOG_DEBUG << "No panels found to render.";
-        return;
+        panel_groups.push_back({panel_group.orientation, panel_group.profile, panel_group.position, builder.build(entt::null)});
+        first = last;
     }
 
     processPanelGroups(model_orientation, panel_groups);
 }
 
 void DirectRenderer::processPanelGroups(
-    const DefaultModelingOrientations &model_orientation,
-    const std::map<AxisFlag, std::map<PanelProfile, std::map<Position, std::map<std::set<size_t>, PanelRenderData>>, ComparePanelProfile>> &panel_groups
+    ModelOrientation model_orientation,
+    const panelRenderGroups &panel_groups
 ) {
-    for (auto&[axis, axis_data] : panel_groups) {
-        for (auto&[profile, profile_data] : axis_data) {
-            for (auto& [position, position_data]: profile_data) {
-                for (auto& [joint_profile, joint_group]: position_data) {
-
-                    auto names = concat_names(std::vector<std::string>(joint_group.names.begin(), joint_group.names.end()));
-
-                    for (auto const&[distance, extrusions]: joint_group.panels) {
-
-                        if (extrusions.empty()) { continue; }
-
-                        auto panels = std::vector<PanelExtrusion>{extrusions.begin(), extrusions.end()};
-
-                        auto panel = panels[0];
-
-                        auto center           = center_selector[model_orientation][axis](0, 0, 0, panel.offset.value);
-                        auto length_center    = profile.length.value / 2;
-                        auto width_center     = profile.width.value / 2;
-                        auto thickness_center = panel.distance.value / 2;
-
-                        auto const& vectors          = orientation_selector[model_orientation][axis];
-                        auto const& transform_vector = transform_selector[model_orientation][axis](
-                            length_center, width_center, thickness_center
-                        );
-                        auto       length_dir        = vectors[0];
-                        auto       width_dir         = vectors[1];
-
-                        PLOG_DEBUG << "Profile length: " << profile.length.value;
-                        PLOG_DEBUG << "Profile width: " << profile.width.value;
-                        PLOG_DEBUG << "Panel distance: " << panel.distance.value;
-
-                        auto bounding_box = OrientedBoundingBox3D::create(
-                            center,
-                            length_dir,
-                            width_dir,
-                            profile.length.value,
-                            profile.width.value,
-                            panel.distance.value
-                        );
-                        auto box          = m_temp_mgr->createBox(bounding_box);
-                        if (!box) {
-                            PLOG_DEBUG << "invalid box";
-                            return;
-                        }
-
-                        auto transform = Matrix3D::create();
-                        transform->translation(transform_vector);
-                        m_temp_mgr->transform(box, transform);
-
-                        PLOG_DEBUG << "Rendering joints";
-                        for (auto const& [joint_type, joint_data]: joint_group.joints) {
-                            PLOG_DEBUG << "Joint type is " << (int)joint_type;
-                            for (auto const& [joint_direction, direction_data]: joint_data) {
-                                PLOG_DEBUG << "Joint direction is " << (int)joint_direction;
-                                renderNormalJoints(model_orientation, axis, joint_group, panel, box, direction_data);
-                            }
-                        }
-                        PLOG_DEBUG << "Finished rendering joints";
-
-                        PLOG_DEBUG << "Adding panel body";
-                        auto body = m_bodies->add(box);
-                        body->name(panel.name + " Panel Body");
-                        PLOG_DEBUG << "Panel body added.";
-
-                        PLOG_DEBUG << "Processing Panel Extrusions";
-                        for (auto const& copy_panel: std::vector<PanelExtrusion>{panels.begin() + 1, panels.end()}) {
-                            auto offset   = copy_panel.offset.value;
-                            auto copy_box = m_temp_mgr->copy(box);
-
-                            auto copy_transform = Matrix3D::create();
-                            copy_transform->translation(copy_transform_selector[model_orientation][axis](offset - panel.offset.value));
-                            m_temp_mgr->transform(copy_box, copy_transform);
-
-                            auto copy_body = m_bodies->add(copy_box);
-                            copy_body->name(copy_panel.name + " Panel Body");
-                        }
-                        PLOG_DEBUG << "Finished Processing Panel Extrusions";
-
-                    }
-                }
-            }
+    for (auto const& panel_group: panel_groups) {
+        auto rendered = true;
+        auto const dispatched = dispatchPanelTransform(model_orientation, panel_group.axis, [&](auto transform) {
+            rendered = renderPanelGroup<decltype(transform)>(panel_group);
+        });
+
+        if (!dispatched) {
+            PLOG_DEBUG << "No transform for model orientation " << (int)model_orientation << " and panel axis " << (int)panel_group.axis;
+            continue;
+        }
+        if (!rendered) return;
+    }
+}
+
+template <typename P>
+auto DirectRenderer::renderPanelGroup(const PanelRenderGroup &panel_group) -> bool {
+    auto const& names = nameTable(m_registry);
+    auto const& profile     = panel_group.profile;
+    auto const& joint_group = panel_group.data;
+
+    for (auto const [first, last]: distanceRuns(joint_group.panels)) {
+        auto panels = std::vector<PanelExtrusion>{joint_group.panels.begin() + first, joint_group.panels.begin() + last};
+
+        auto panel = panels[0];
+
+        auto center           = P::center(0, 0, 0, panel.offset.value);
+        auto length_center    = profile.length.value / 2;
+        auto width_center     = profile.width.value / 2;
+        auto thickness_center = panel.distance.value / 2;
+
+        auto const transform_vector = P::transform(length_center, width_center, thickness_center);
+
+        PLOG_DEBUG << "Profile length: " << profile.length.value;
+        PLOG_DEBUG << "Profile width: " << profile.width.value;
+        PLOG_DEBUG << "Panel distance: " << panel.distance.value;
+
+        auto box = m_backend.createBox({
+            center,
+            P::length_direction,
+            P::width_direction,
+            profile.length.value,
+            profile.width.value,
+            panel.distance.value
+        });
+        if (!box) {
+            PLOG_DEBUG << "invalid box";
+            return false;
+        }
+
+        m_backend.translateBody(box, transform_vector);
+
+        PLOG_DEBUG << "Rendering joints";
+        renderNormalJoints<P>(panel, box, joint_group.joints);
+        PLOG_DEBUG << "Finished rendering joints";
+
+        PLOG_DEBUG << "Adding panel body";
+        m_backend.addBody(box, names.name(panel.name) + " Panel Body");
+        PLOG_DEBUG << "Panel body added.";
+
+        PLOG_DEBUG << "Processing Panel Extrusions";
+        for (auto const& copy_panel: std::vector<PanelExtrusion>{panels.begin() + 1, panels.end()}) {
+            auto offset   = copy_panel.offset.value;
+            auto copy_box = m_backend.copyBody(box);
+
+            m_backend.translateBody(copy_box, P::copy(offset - panel.offset.value));
+            m_backend.addBody(copy_box, names.name(copy_panel.name) + " Panel Body");
         }
+        PLOG_DEBUG << "Finished Processing Panel Extrusions";
+
     }
+
+    return true;
 }
 
+template <typename P>
 void DirectRenderer::renderNormalJoints(
-    const DefaultModelingOrientations &model_orientation,
-    AxisFlag axis,
-    const PanelRenderData& group_data,
     const PanelExtrusion &panel,
-    const Ptr<BRepBody> &box,
-    const renderJointTypeMap& joints_group
+    fusion::BodyHandle box,
+    const jointRenderEntries& joints
 ) {
     PLOG_DEBUG << "started renderNormalJoints";
-    for (auto const&[joint_orientation, joint_groups]: joints_group) {
-        for (auto const&[joint_profile, joint_profile_data]: joint_groups) {
-            renderNormalJoint(model_orientation, axis, panel, box, joint_orientation, joint_profile, joint_profile_data);
+    for (auto const& joint: joints) {
+        PLOG_DEBUG << "Joint type is " << (int)joint.joint_type << ", direction is " << (int)joint.joint_direction;
+
+        auto const dispatched = dispatchJointTransform<P>(joint.joint_orientation, [&](auto transform) {
+            using J = decltype(transform);
 
-            PLOG_DEBUG << "Searching for corner cuts in " << panel.name;
-            if (joint_profile.corner_width == 0) continue;
-            PLOG_DEBUG << "Found corner cuts in " << panel.name;
+            renderNormalJoint<J>(panel, box, joint.profile, joint.group);
 
-            renderCornerJoint(model_orientation, axis, panel, box, joint_orientation, joint_profile, joint_profile_data);
+            PLOG_DEBUG << "Searching for corner cuts in " << nameTable(m_registry).name(panel.name);
+            if (joint.profile.corner_width == 0) return;
+            PLOG_DEBUG << "Found corner cuts in " << nameTable(m_registry).name(panel.name);
+
+            renderCornerJoint<J>(panel, box, joint.profile, joint.group);
+        });
+
+        if (!dispatched) {
+            PLOG_DEBUG << "No transform for joint orientation " << (int)joint.joint_orientation << " in panel axis " << (int)P::axis;
         }
     }
     PLOG_DEBUG << "finished renderNormalJoints";
 }
 
+template <typename J>
 void DirectRenderer::renderNormalJoint(
-    const DefaultModelingOrientations &model_orientation,
-    const AxisFlag &axis,
     const PanelExtrusion &panel,
-    const Ptr<BRepBody> &box,
-    const AxisFlag &joint_orientation,
+    fusion::BodyHandle box,
     const JointProfile &joint_profile,
     const JointRenderGroup &joint_profile_data
 ) {
@@ -214,98 +217,68 @@ void DirectRenderer::renderNormalJoint(
     auto finger_count      = joint_profile.finger_count;
     auto finger_width      = joint_profile.finger_width;
     auto pattern_offset    = joint_profile.pattern_offset;
-    auto finger_vectors    = joint_orientation_selector[model_orientation][axis][joint_orientation];
-    auto finger_length_dir = finger_vectors[0];
-    auto finger_width_dir  = finger_vectors[1];
 
     PLOG_DEBUG << ">>>>>>>> Rendering joint >>>>>>>>";
-    PLOG_DEBUG << "Panel name: " << panel.name;
+    PLOG_DEBUG << "Panel name: " << nameTable(m_registry).name(panel.name);
     PLOG_DEBUG << "Finger count: " << finger_count;
 
+    auto const& extrusions = joint_profile_data.extrusions;
+
     for (int i = 0; i < finger_count; i++) {
-        auto            extrusions = std::vector<JointExtrusion>{
-            joint_profile_data.extrusions.begin(), joint_profile_data.extrusions.end()
-        };
         for (auto const &joint: extrusions) {
-            auto       first_joint              = extrusions[0];
-            auto       finger_bounding_box      = OrientedBoundingBox3D::create(
-                joint_center_selector[model_orientation][axis][joint_orientation](
-                    panel.offset.value, panel.distance.value, joint.offset.value, joint.distance.value
-                ),
-                finger_length_dir,
-                finger_width_dir,
+            auto const finger_bounding_box      = fusion::OrientedBox{
+                J::center(panel.offset.value, panel.distance.value, joint.offset.value, joint.distance.value),
+                J::length_direction,
+                J::width_direction,
                 finger_width,
                 joint.distance.value,
                 panel.distance.value
-            );
+            };
             auto       finger_offset            = (i * joint_profile.finger_offset) + pattern_offset;
-            auto       finger_box               = m_temp_mgr->createBox(finger_bounding_box);
-            auto const &finger_transform_vector = joint_transform_selector[model_orientation][axis][joint_orientation](
-                finger_width / 2 + finger_offset, 0, 0
-            );
-            auto       finger_transform         = Matrix3D::create();
-            finger_transform->translation(finger_transform_vector);
-            m_temp_mgr->transform(finger_box, finger_transform);
-//            auto finger_body = m_bodies->add(finger_box); // Enable for testing
-//            finger_body->name(panel.name + " " + joint.name + " Finger Body"); // Enable for testing
+            auto       finger_box               = m_backend.createBox(finger_bounding_box);
+            auto const finger_transform_vector  = J::transform(finger_width / 2 + finger_offset, 0, 0);
+            m_backend.translateBody(finger_box, finger_transform_vector);
+//            m_backend.addBody(finger_box, names.name(panel.name) + " " + names.name(joint.name) + " Finger Body"); // Enable for testing
             PLOG_DEBUG << ">>>>>>>>>>>>>>>>";
-            PLOG_DEBUG << joint.name + " Finger Body";
+            PLOG_DEBUG << nameTable(m_registry).name(joint.name) << " Finger Body";
             PLOG_DEBUG << "Joint distance: " << joint.distance.value;
             PLOG_DEBUG << "Panel distance: " << panel.distance.value;
-            PLOG_DEBUG << "Panel axis: " << (int)axis;
-            PLOG_DEBUG << "Joint orientation: " << (int)joint_orientation;
             PLOG_DEBUG << "Panel offset: " << panel.offset.value;
             PLOG_DEBUG << "Joint offset: " << joint.offset.value;
             PLOG_DEBUG << "Finger offset: " << finger_offset;
             PLOG_DEBUG << "Finger width: " << finger_width;
-            m_temp_mgr->booleanOperation(box, finger_box, DifferenceBooleanType);
+            m_backend.subtractBody(box, finger_box);
         }
     }
     PLOG_DEBUG << "<<<<<<<<<<<<<<<<<<<<<<<<";
 }
 
+template <typename J>
 void DirectRenderer::renderCornerJoint(
-    const DefaultModelingOrientations &model_orientation,
-    const AxisFlag &axis,
     const PanelExtrusion &panel,
-    const Ptr<BRepBody> &box,
-    const AxisFlag &joint_orientation,
+    fusion::BodyHandle box,
     const JointProfile &joint_profile,
     const JointRenderGroup &joint_profile_data
 ) {
-    auto finger_count      = 2;
     auto finger_width      = joint_profile.corner_width;
-    auto pattern_offset    = 0;
-    auto finger_vectors    = joint_orientation_selector[model_orientation][axis][joint_orientation];
-    auto finger_length_dir = finger_vectors[0];
-    auto finger_width_dir  = finger_vectors[1];
+
+    auto const& extrusions = joint_profile_data.extrusions;
 
     for (auto i: {0, 1}) {
-        auto            extrusions = std::vector<JointExtrusion>{
-            joint_profile_data.extrusions.begin(), joint_profile_data.extrusions.end()
-        };
         for (auto const &joint: extrusions) {
-            auto       first_joint              = extrusions[0];
-            auto       finger_bounding_box      = OrientedBoundingBox3D::create(
-                joint_center_selector[model_orientation][axis][joint_orientation](
-                    panel.offset.value, panel.distance.value, joint.offset.value, joint.distance.value
-                ),
-                finger_length_dir,
-                finger_width_dir,
+            auto const finger_bounding_box      = fusion::OrientedBox{
+                J::center(panel.offset.value, panel.distance.value, joint.offset.value, joint.distance.value),
+                J::length_direction,
+                J::width_direction,
                 finger_width,
                 joint.distance.value,
                 panel.distance.value
-            );
-            auto       finger_box               = m_temp_mgr->createBox(finger_bounding_box);
-            auto const &finger_transform_vector = joint_transform_selector[model_orientation][axis][joint_orientation](
-                finger_width / 2 + joint_profile.corner_distance * i, 0, 0
-            );
-            auto       finger_transform         = Matrix3D::create();
-            finger_transform->translation(finger_transform_vector);
-            m_temp_mgr->transform(finger_box, finger_transform);
-//            auto finger_body = m_bodies->add(finger_box); // Enable for testing
-//            finger_body->name(panel.name + " " + joint.name + " Finger Body"); // Enable for testing
-            m_temp_mgr->booleanOperation(box, finger_box, DifferenceBooleanType);
+            };
+            auto       finger_box               = m_backend.createBox(finger_bounding_box);
+            auto const finger_transform_vector  = J::transform(finger_width / 2 + joint_profile.corner_distance * i, 0, 0);
+            m_backend.translateBody(finger_box, finger_transform_vector);
+//            m_backend.addBody(finger_box, names.name(panel.name) + " " + names.name(joint.name) + " Finger Body"); // Enable for testing
+            m_backend.subtractBody(box, finger_box);
         }
     }
 }
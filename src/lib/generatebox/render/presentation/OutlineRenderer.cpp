@@ -0,0 +1,84 @@
+//
+// Created by Hobbyist Maker on 9/30/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "OutlineRenderer.hpp"
+#include "writeUserParameters.hpp"
+
+#include "entities/ExtrusionDistance.hpp"
+#include "entities/PanelOffset.hpp"
+#include "entities/Parameter.hpp"
+#include "fusion/FusionCallProfiler.hpp"
+#include "fusion/PanelOutlineSketch.hpp"
+#include "render/geometry/CoordinateExpressions.hpp"
+#include "render/geometry/PanelOutline.hpp"
+#include "render/geometry/collectPanelGeometry.hpp"
+
+#include <plog/Log.h>
+
+using namespace adsk::core;
+using namespace adsk::fusion;
+
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::fusion;
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::render;
+
+void OutlineRenderer::execute(ModelOrientation model_orientation) {
+    writeUserParameters(m_registry, m_backend);
+
+    auto expressions  = std::vector<PanelExpressions>{};
+    auto const panels = collectPanelGeometry(m_registry, expressions);
+
+    if (panels.empty()) {
+        PLOG_DEBUG << "No panels found to render.";
+        return;
+    }
+
+    auto const planes = model_orientation == ModelOrientation::ZUp
+        ? axis_plane_map{
+            {AxisFlag::Height, m_component->xYConstructionPlane()},
+            {AxisFlag::Length, m_component->yZConstructionPlane()},
+            {AxisFlag::Width,  m_component->xZConstructionPlane()}
+        }
+        : axis_plane_map{
+            {AxisFlag::Height, m_component->xZConstructionPlane()},
+            {AxisFlag::Length, m_component->yZConstructionPlane()},
+            {AxisFlag::Width,  m_component->xYConstructionPlane()}
+        };
+
+    auto outliner    = PanelOutliner{};
+    auto outline     = PanelOutline{};
+    auto coordinates = CoordinateExpressions{};
+
+    for (size_t i = 0; i < panels.size(); ++i) {
+        auto const& panel = panels[i];
+
+        outliner.build(panel, outline);
+        if (outline.loops.empty()) continue;
+
+        coordinates.build(panel, expressions[i]);
+
+        auto const& transform = sketch_transforms[model_orientation][panel.orientation];
+        auto const  sketch    = PanelOutlineSketch(panel.name + " Outline Sketch", planes.at(panel.orientation), transform, outline, coordinates);
+
+        auto const distance  = ExtrusionDistance{panel.thickness, expressions[i].thickness};
+        auto const offset    = PanelOffset{panel.offset, expressions[i].offset};
+        auto const extrusion = sketch.extrudeOutline(distance, offset);
+        if (!extrusion) {
+            PLOG_DEBUG << "Unable to extrude the outline of " << panel.name;
+            continue;
+        }
+
+        if (!distance.expression.empty()) {
+            SILVANUS_FUSION_CALL(WriteExpression);
+            auto distance_param = Ptr<DistanceExtentDefinition>{extrusion->extentOne()}->distance();
+            distance_param->expression(distance.expression); // Reassign since Fusion appears to throw away the string expression
+        }
+
+        SILVANUS_FUSION_CALL(NameEntity);
+        extrusion->name(panel.name + " Panel Extrusion");
+        extrusion->bodies()->item(0)->name(panel.name + " Panel Body");
+    }
+}
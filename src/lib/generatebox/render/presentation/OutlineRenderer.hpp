@@ -0,0 +1,41 @@
+//
+// Created by Hobbyist Maker on 9/30/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_OUTLINERENDERER_HPP
+#define SILVANUSPRO_OUTLINERENDERER_HPP
+
+#include "Renderer.hpp"
+#include "sketchsupport.hpp"
+#include "fusion/FusionBackend.hpp"
+
+#include <Core/CoreAll.h>
+#include <Fusion/FusionAll.h>
+#include <entt/entt.hpp>
+
+namespace silvanus::generatebox::render {
+
+    // Parametric model with the shortest timeline: each panel is one outline
+    // sketch with its finger notches drawn in, and one extrusion. The outline is
+    // dimensioned to the same user parameters as the ParametricRenderer, but the
+    // number of fingers is fixed when the box is created, since Fusion has no
+    // pattern to recompute.
+    class OutlineRenderer : public Renderer {
+
+            fusion::FusionBackend&                   m_backend;
+            entt::registry&                          m_registry;
+            adsk::core::Ptr<adsk::fusion::Component> m_component;
+
+        public:
+            OutlineRenderer(
+                fusion::FusionBackend& backend, entt::registry& registry,
+                const adsk::core::Ptr<adsk::fusion::Component>& component
+            ) : m_backend{backend}, m_registry{registry}, m_component{component} {};
+
+            void execute(entities::ModelOrientation orientation) override;
+    };
+
+}
+
+#endif //SILVANUSPRO_OUTLINERENDERER_HPP
@@ -0,0 +1,93 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "PanelRenderDataBuilder.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::render;
+
+namespace {
+
+    // Sorts the values and drops every one that compares equal to an earlier
+    // one, keeping the first added as a std::set would.
+    template <class T, class Less>
+    void sortUnique(std::vector<T>& values, Less less) {
+        std::stable_sort(values.begin(), values.end(), less);
+        values.erase(std::unique(values.begin(), values.end(), [&less](const T& lhs, const T& rhs) {
+            return !less(lhs, rhs) && !less(rhs, lhs);
+        }), values.end());
+    }
+
+    auto jointKeyLess(const JointRenderEntry& lhs, const JointRenderEntry& rhs) -> bool {
+        auto const lhs_key = std::tie(lhs.joint_type, lhs.joint_direction, lhs.joint_orientation);
+        auto const rhs_key = std::tie(rhs.joint_type, rhs.joint_direction, rhs.joint_orientation);
+        if (lhs_key != rhs_key) return lhs_key < rhs_key;
+
+        return CompareJointProfile{}(lhs.profile, rhs.profile);
+    }
+
+}
+
+void PanelRenderDataBuilder::addPanel(const PanelExtrusion& extrusion) {
+    m_data.names.push_back(extrusion.name);
+    m_data.panels.push_back(extrusion);
+}
+
+void PanelRenderDataBuilder::addJoint(
+    const JointProfile& profile, AxisFlag joint_orientation, NameId name, const JointExtrusion& extrusion
+) {
+    m_data.joints.push_back({profile.joint_type, profile.joint_direction, joint_orientation, profile, {{name}, {extrusion}}});
+}
+
+auto PanelRenderDataBuilder::build(entt::entity parent) -> PanelRenderData {
+    sortUnique(m_data.names, std::less<NameId>{});
+    sortUnique(m_data.panels, CompareExtrusion{});
+
+    // Entries of one key are adjacent once sorted, and fold into the first.
+    std::stable_sort(m_data.joints.begin(), m_data.joints.end(), jointKeyLess);
+
+    auto joints = jointRenderEntries{};
+    for (auto& entry: m_data.joints) {
+        if (joints.empty() || jointKeyLess(joints.back(), entry)) {
+            joints.push_back(std::move(entry));
+            continue;
+        }
+
+        auto& group = joints.back().group;
+        group.names.insert(group.names.end(), entry.group.names.begin(), entry.group.names.end());
+        group.extrusions.insert(group.extrusions.end(), entry.group.extrusions.begin(), entry.group.extrusions.end());
+    }
+
+    for (auto& entry: joints) {
+        sortUnique(entry.group.names, std::less<NameId>{});
+        sortUnique(entry.group.extrusions, CompareExtrusion{});
+    }
+
+    m_data.joints = std::move(joints);
+    m_data.parent = parent;
+
+    return std::move(m_data);
+}
+
+auto silvanus::generatebox::render::distanceRuns(
+    const std::vector<PanelExtrusion>& panels
+) -> std::vector<std::pair<std::size_t, std::size_t>> {
+    auto runs = std::vector<std::pair<std::size_t, std::size_t>>{};
+
+    for (std::size_t first = 0; first < panels.size();) {
+        auto const distance = quantize(panels[first].distance.value);
+
+        auto last = first + 1;
+        while (last < panels.size() && quantize(panels[last].distance.value) == distance) ++last;
+
+        runs.emplace_back(first, last);
+        first = last;
+    }
+
+    return runs;
+}
@@ -0,0 +1,39 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_PANELRENDERDATABUILDER_HPP
+#define SILVANUSPRO_PANELRENDERDATABUILDER_HPP
+
+#include "rendersupport.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace silvanus::generatebox::render {
+
+    // Collects the panels and joints of one panel group in any order, then
+    // sorts them into a PanelRenderData in one pass each, instead of keeping
+    // nested sets and maps ordered on every insert.
+    class PanelRenderDataBuilder {
+            PanelRenderData m_data;
+
+        public:
+            void addPanel(const entities::PanelExtrusion& extrusion);
+            void addJoint(
+                const entities::JointProfile& profile, entities::AxisFlag joint_orientation,
+                entities::NameId name, const entities::JointExtrusion& extrusion
+            );
+
+            auto build(entt::entity parent) -> PanelRenderData;
+    };
+
+    // The [first, last) index ranges of panels that share an extrusion
+    // distance, which are rendered from one feature.
+    auto distanceRuns(const std::vector<entities::PanelExtrusion>& panels) -> std::vector<std::pair<std::size_t, std::size_t>>;
+
+}
+
+#endif //SILVANUSPRO_PANELRENDERDATABUILDER_HPP
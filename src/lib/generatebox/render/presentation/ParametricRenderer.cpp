@@ -6,17 +6,27 @@
 //
 
 #include "ParametricRenderer.hpp"
+#include "writeUserParameters.hpp"
 
 #include "Core/Geometry/Point3D.h"
 
 #include "fusion/FingerCutsPattern.hpp"
+#include "fusion/FusionCallProfiler.hpp"
 #include "fusion/PanelFingerSketch.hpp"
 #include "fusion/PanelFeature.hpp"
+#include "PanelRenderDataBuilder.hpp"
+#include "sortPanelGroups.hpp"
 #include "entities/EntitiesAll.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <map>
+#include <optional>
 #include <set>
 #include <string>
+#include <tuple>
+
+#include <fmt/format.h>
 
 #include "plog/Log.h"
 
@@ -30,11 +40,120 @@ using namespace silvanus::generatebox::render;
 using std::map;
 using std::unordered_map;
 
-using jointProfileSet = std::set<size_t>;
-using panelJointGroup = std::map<jointProfileSet, PanelRenderData>;
-using positionPanelGroup = std::map<Position, panelJointGroup>;
-using profilePositionGroup = std::map<PanelProfile, positionPanelGroup, ComparePanelProfile>;
-using axisProfileGroup = std::map<AxisFlag, profilePositionGroup>;
+namespace {
+
+    // Adds a dimension to a group signature. One with an expression is added by
+    // its expression, since the user parameters carry its value, and one
+    // without by the value that ends up baked into the feature. The sign is
+    // kept either way because it picks the direction of a cut.
+    void appendDimension(std::string& signature, double value, const std::string& expression) {
+        if (expression.empty()) {
+            signature += fmt::format("{:.6f};", value);
+        } else {
+            signature += fmt::format("{}{};", value < 0 ? "-" : "+", expression);
+        }
+    }
+
+    // Finger cuts that are cut by one extrude feature and copied by one
+    // pattern, if any.
+    struct CutBatch {
+        std::shared_ptr<PanelFingerSketch> sketch;
+        std::string                        pattern;
+        std::vector<const CutProfile*>     cuts;
+    };
+
+    // What the pattern copying a cut is built from: its axes, spacing and
+    // count. Cuts without a pattern get an empty key.
+    auto patternKey(entt::registry& registry, const CutProfile& cut) -> std::string {
+        auto const& profile = cut.profile;
+        if ((profile.finger_count <= 1) && (!cut.corner)) return "";
+
+        auto const& parameters = jointProfileParams(registry, profile);
+
+        auto key = fmt::format("{}:{}:{}|", cut.corner, (int) profile.joint_orientation, (int) profile.panel_orientation);
+        if (cut.corner) {
+            appendDimension(key, profile.corner_distance, parameters.corner_distance);
+        } else {
+            appendDimension(key, profile.pattern_distance, parameters.pattern_distance);
+            appendDimension(key, profile.finger_count, parameters.finger_count);
+        }
+        return key;
+    }
+
+    // Joint extrusions that one cut feature can serve, since it is started at
+    // and extruded by the same parameters.
+    auto sameExtent(const JointExtrusion& lhs, const JointExtrusion& rhs) -> bool {
+        return (CompareExtrusion::key(lhs) == CompareExtrusion::key(rhs))
+            && (lhs.offset.expression == rhs.offset.expression)
+            && (lhs.distance.expression == rhs.distance.expression);
+    }
+
+    // 64 bit FNV-1a, which unlike std::hash is the same on every platform and
+    // in every session, so keys saved in a design can be compared later.
+    auto fingerprint(const std::string& text) -> std::uint64_t {
+        auto hash = std::uint64_t{14695981039346656037ULL};
+        for (auto const c: text) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    // Everything a panel group's features are built from except the user
+    // parameter values, so two groups with the same key render the same
+    // features and a changed group gets a new key. The offsets of instanced
+    // panels are the exception, since their placement is baked in.
+    auto groupKey(
+        entt::registry& registry, const std::string& names, ModelOrientation model_orientation, AxisFlag axis,
+        const PanelProfile& profile, const PanelRenderData& group, bool instanced
+    ) -> std::string {
+        auto const& table = nameTable(registry);
+
+        auto signature = fmt::format("{}|{}|{}|{}|", names, (int) model_orientation, (int) axis, instanced);
+        appendDimension(signature, profile.length.value, profile.length.expression);
+        appendDimension(signature, profile.width.value, profile.width.expression);
+
+        for (auto const [first, last]: distanceRuns(group.panels)) {
+            // Instanced panels are placed by occurrence transforms computed from
+            // the offsets, which do not follow the parameters, so their key
+            // changes with the offset values as well.
+            auto const placed = instanced && last - first > 1;
+
+            for (auto i = first; i < last; ++i) {
+                auto const& panel = group.panels[i];
+                signature += table.name(panel.name) + "|";
+                appendDimension(signature, panel.distance.value, panel.distance.expression);
+                appendDimension(signature, panel.offset.value, panel.offset.expression);
+                if (placed) signature += fmt::format("{:.6f};", panel.offset.value);
+            }
+        }
+
+        for (auto const& [joint_type, joint_direction, joint_orientation, joint, joints]: group.joints) {
+            // Only whether there are no, one or several fingers changes which features are made.
+            auto const fingers = joint.finger_count > 1 ? 2 : std::max(joint.finger_count, 0);
+            signature += fmt::format(
+                "{}:{}:{}:{}:{}|", (int) joint_type, (int) joint_direction, (int) joint_orientation, fingers, joint.corner_width != 0
+            );
+
+            auto const& parameters = jointProfileParams(registry, joint);
+            appendDimension(signature, joint.finger_count, parameters.finger_count);
+            appendDimension(signature, joint.finger_width, parameters.finger_width);
+            appendDimension(signature, joint.pattern_offset, parameters.pattern_offset);
+            appendDimension(signature, joint.pattern_distance, parameters.pattern_distance);
+            appendDimension(signature, joint.corner_width, parameters.corner_width);
+            appendDimension(signature, joint.corner_distance, parameters.corner_distance);
+
+            if (!joints.names.empty()) signature += table.join(joints.names, ",") + ",";
+            for (auto const& extrusion: joints.extrusions) {
+                appendDimension(signature, extrusion.distance.value, extrusion.distance.expression);
+                appendDimension(signature, extrusion.offset.value, extrusion.offset.expression);
+            }
+        }
+
+        return fmt::format("{} {:016x}", names, fingerprint(signature));
+    }
+
+}
 
 auto ParametricRenderer::updateFormula(
     const Ptr<Parameter>& parameter, std::string expression
@@ -49,6 +168,8 @@ auto ParametricRenderer::updateFormula(
     PLOG_DEBUG << "Updating parameter " << parameter->name() << " for " << expression;
 
     auto existing_expression = existing_params[expression];
+
+    SILVANUS_FUSION_CALL(WriteExpression);
     if (existing_expression.length() > 0) {
         parameter->expression(existing_expression);
     } else {
@@ -67,84 +188,64 @@ auto ParametricRenderer::updateFormula(
     }
 }
 
-auto ParametricRenderer::update_parameter(
-    Ptr<Parameter> &parameter, FloatParameter& input
-) -> void {
-    PLOG_DEBUG << "Updating parameter for " << input.name;
-    parameter->expression(input.expression);
-}
-
-auto ParametricRenderer::create_parameter(
-    Ptr<UserParameters> &parameters, FloatParameter& input
-) -> void {
-    PLOG_DEBUG << "Creating new parameter for " << input.name;
-    auto value = ValueInput::createByString(input.expression);
-    parameters->add(input.name, value, input.unit_type, "");
-}
-
-auto ParametricRenderer::find_or_create_parameter(Ptr<ParameterList>& all_parameters, Ptr<UserParameters>& user_parameters, FloatParameter& input) -> void {
-    auto existing = all_parameters->itemByName(input.name);
-
-    if (existing) {
-        update_parameter(existing, input);
-        return;
-    } else {
-        create_parameter(user_parameters, input);
-    }
-}
-
-auto ParametricRenderer::initializeParameters() -> void{
-    auto app = adsk::core::Application::get();
-    auto all_parameters = Ptr<Design>{app->activeProduct()}->allParameters();
-    auto user_parameters = Ptr<Design>{app->activeProduct()}->userParameters();
-
-    auto param_init_view = m_registry.view<FloatParameter>();
-    for (auto &&[entity, parameter]: param_init_view.proxy()) {
-        find_or_create_parameter(all_parameters, user_parameters, parameter);
-    }
-}
-
 auto ParametricRenderer::initializePanelGroups() -> void {
-    auto panel_groups = axisProfileGroup{};
+    auto const& names = nameTable(m_registry);
+    auto enabled_entities = std::vector<entt::entity>{};
 
     auto view = m_registry.view<Enabled, JointEnabled, Panel, PanelGroup, PanelExtrusion, JointGroup, JointName, JointExtrusion>();
     for (auto &&[entity, enabled, joint_enabled, panel, panel_group, panel_extrusion, joint_group, joint_name, joint_extrusion]: view.proxy()) {
         PLOG_DEBUG << panel.name << " enabled == " << (int) enabled.value;
-        PLOG_DEBUG << panel.name << " joint to " << joint_name.value << " enabled == " << (int) joint_enabled.value;
+        PLOG_DEBUG << panel.name << " joint to " << names.name(joint_name.value) << " enabled == " << (int) joint_enabled.value;
 
         if (!enabled.value || !joint_enabled.value) continue;
 
-        PLOG_DEBUG << "Adding Panel " << panel.name << " with joint to " << joint_name.value << " for direct render";
+        PLOG_DEBUG << "Adding Panel " << panel.name << " with joint to " << names.name(joint_name.value) << " for direct render";
         PLOG_DEBUG << "Joint direction is " << (int)joint_group.profile.joint_direction;
         PLOG_DEBUG << "Joint thickness is " << joint_group.joint_thickness.value;
         PLOG_DEBUG << "Joint pattern type is " << (int)joint_group.profile.joint_type;
 
-        auto &group = panel_groups[panel_group.orientation][panel_group.profile][panel_group.position][joint_group.tag.value];
+        enabled_entities.push_back(entity);
+    }
 
-        if (group.parent == entt::null) { group.parent = entity; };
+    if (enabled_entities.empty()) {
+        return;
+    }
 
-        group.names.insert(panel_extrusion.name);
-        group.panels[panel_group.distance].insert(panel_extrusion);
+    auto const sorted = sortPanelGroups(m_registry, enabled_entities);
 
-        if ((joint_group.profile.finger_type == FingerPatternType::None) || (joint_group.profile.joint_type == JointPatternType::None)) {
-            continue;
-        }
+    auto panel_groups = panelRenderGroups{};
+    for (size_t first = 0; first < sorted.size();) {
+        auto const& panel_group = view.get<PanelGroup>(sorted[first].entity);
 
-        auto& joined_panel_group = group.joints[joint_group.profile.joint_type][joint_group.profile.joint_direction][joint_group.profile.joint_orientation][joint_group.profile];
-        joined_panel_group.names.insert(joint_name.value);
-        joined_panel_group.extrusions.insert(joint_extrusion);
-    }
+        auto builder = PanelRenderDataBuilder{};
 
-    if (panel_groups.empty()) {
-        return;
+        auto last = first;
+        for (; last < sorted.size() && sorted[last].key == sorted[first].key; ++last) {
+            auto const entity = sorted[last].entity;
+            auto const& panel_extrusion = view.get<PanelExtrusion>(entity);
+            auto const& joint_group     = view.get<JointGroup>(entity);
+
+            builder.addPanel(panel_extrusion);
+
+            if ((joint_group.profile.finger_type == FingerPatternType::None) || (joint_group.profile.joint_type == JointPatternType::None)) {
+                continue;
+            }
+
+            builder.addJoint(
+                joint_group.profile, joint_group.profile.joint_orientation, view.get<JointName>(entity).value, view.get<JointExtrusion>(entity)
+            );
+        }
+
+        panel_groups.push_back({panel_group.orientation, panel_group.profile, panel_group.position, builder.build(sorted[first].entity)});
+        first = last;
     }
 
-    m_renders.set<axisProfileGroup>(panel_groups);
+    m_renders.set<panelRenderGroups>(panel_groups);
 }
 
-auto ParametricRenderer::renderPanelGroups(DefaultModelingOrientations model_orientation, const Ptr<Component>& component) -> void {
-    auto panel_groups = m_renders.ctx<axisProfileGroup>();
-
+auto ParametricRenderer::profilePlane(
+    ModelOrientation model_orientation, AxisFlag axis, const Ptr<Component>& component
+) -> Ptr<ConstructionPlane> {
     auto yup_planes   = axis_plane_map{
         {AxisFlag::Height, component->xZConstructionPlane()},
         {AxisFlag::Length, component->yZConstructionPlane()},
@@ -156,62 +257,128 @@ auto ParametricRenderer::renderPanelGroups(DefaultModelingOrientations model_ori
         {AxisFlag::Width,  component->xZConstructionPlane()}
     };
     auto orientations = orientation_plane_map{
-        {YUpModelingOrientation, yup_planes},
-        {ZUpModelingOrientation, zup_planes}
+        {ModelOrientation::YUp, yup_planes},
+        {ModelOrientation::ZUp, zup_planes}
     };
 
-    for (auto& [axis, axis_data] : panel_groups) {
-        for (auto& [profile, profile_data] : axis_data) {
-            for (auto& [position, position_data]: profile_data) {
-                for (auto& [joint_profile, joint_group]: position_data) {
-                    auto const &plane     = orientations[model_orientation][axis];
-                    auto const &transform = sketch_transforms[model_orientation][axis];
+    return orientations[model_orientation][axis];
+}
 
-                    auto timeline  = Ptr<Design>{m_app->activeProduct()}->timeline();
-                    auto start_pos = timeline->markerPosition();
+auto ParametricRenderer::renderProfileSketch(
+    const std::string& names,
+    ModelOrientation model_orientation,
+    AxisFlag axis,
+    const Ptr<Component>& component,
+    const PanelProfile& profile
+) -> PanelProfileSketch {
+    auto const &plane     = profilePlane(model_orientation, axis, component);
+    auto const &transform = sketch_transforms[model_orientation][axis];
+
+    auto sketch = PanelProfileSketch(names + " Profile Sketch", plane, transform, profile);
+
+    if (model_orientation == ModelOrientation::ZUp && axis == AxisFlag::Length) { // TODO: This shouldn't be needed
+        updateFormula(sketch.lengthDimension()->parameter(), profile.width.expression);
+        updateFormula(sketch.widthDimension()->parameter(), profile.length.expression);
+    } else {
+        updateFormula(sketch.lengthDimension()->parameter(), profile.length.expression);
+        updateFormula(sketch.widthDimension()->parameter(), profile.width.expression);
+    }
 
-                    auto const names  = concat_names(std::vector<std::string>(joint_group.names.begin(), joint_group.names.end()));
-                    auto sketch = PanelProfileSketch(names + " Profile Sketch", plane, transform, profile);
+    tag(sketch.sketch());
 
-                    if (model_orientation == ZUpModelingOrientation && axis == AxisFlag::Length) { // TODO: This shouldn't be needed
-                        updateFormula(sketch.lengthDimension()->parameter(), profile.width.expression);
-                        updateFormula(sketch.widthDimension()->parameter(), profile.length.expression);
-                    } else {
-                        updateFormula(sketch.lengthDimension()->parameter(), profile.length.expression);
-                        updateFormula(sketch.widthDimension()->parameter(), profile.width.expression);
-                    }
+    return sketch;
+}
+
+auto ParametricRenderer::renderPanelGroups(
+    ModelOrientation model_orientation, const Ptr<Component>& component, RenderSession& session
+) -> void {
+    auto& panel_groups = m_renders.ctx<panelRenderGroups>();
+
+    auto keys = std::vector<std::string>{};
+    keys.reserve(panel_groups.size());
+    for (auto const& group: panel_groups) {
+        auto const names = nameTable(m_registry).join(group.data.names);
+        keys.push_back(groupKey(m_registry, names, model_orientation, group.axis, group.profile, group.data, m_instanced));
+    }
 
-                    for (auto const&[distance, extrusions]: joint_group.panels) {
+    // Groups of this box that are no longer configured are deleted before
+    // anything is rendered, so the timeline positions recorded below stay
+    // valid. The lookup only returns the box's own groups, so every other box
+    // in the design is left as it is.
+    auto existing = std::map<std::string, std::vector<Ptr<Base>>>{};
+    if (m_update_existing) {
+        existing = findTaggedEntities(Ptr<Design>{m_app->activeProduct()}, m_box);
 
-                        if (extrusions.empty()) { continue; }
+        auto const configured = std::set<std::string>{keys.begin(), keys.end()};
 
-                        auto const panels = std::vector<PanelExtrusion>{extrusions.begin(), extrusions.end()};
+        auto removed = size_t{0};
+        for (auto const& [key, entities]: existing) {
+            if (configured.count(key)) continue;
 
-                        auto const feature = renderSinglePanel(names, sketch, panels[0], model_orientation, joint_group.joints);
+            PLOG_DEBUG << "Removing panel group " << key;
+            deleteTaggedEntities(entities);
+            ++removed;
+        }
 
-                        if (panels.size() == 1) { continue; }
+        auto const kept = static_cast<size_t>(std::count_if(keys.begin(), keys.end(), [&existing](auto const& key) {
+            return existing.count(key) > 0;
+        }));
+        PLOG_INFO << "Updating " << m_box << ": keeping " << kept << " panel groups, rendering "
+                  << keys.size() - kept << " and removing " << removed;
+    }
 
-                        renderPanelCopies(feature, panels);
-                    }
+    for (size_t i = 0; i < panel_groups.size(); ++i) {
+        auto& [axis, profile, position, joint_group] = panel_groups[i];
 
-                    auto const end_pos = timeline->markerPosition() - 1;
-                    if ((end_pos - start_pos) <= 0) { continue; }
+        m_group_key = keys[i];
+        if (existing.count(m_group_key)) { continue; }
 
-                    auto const timeline_group = timeline->timelineGroups()->add(start_pos, end_pos);
-                    timeline_group->name(names + " Panel Group");
-                }
+        auto timeline  = Ptr<Design>{m_app->activeProduct()}->timeline();
+        auto start_pos = timeline->markerPosition();
+
+        auto const names  = nameTable(m_registry).join(joint_group.names);
+
+        // Instanced groups draw their own sketch inside their component,
+        // so the shared one is only drawn once a panel needs it.
+        auto sketch = std::optional<PanelProfileSketch>{};
+
+        for (auto const [first, last]: distanceRuns(joint_group.panels)) {
+            auto const panels = std::vector<PanelExtrusion>{joint_group.panels.begin() + first, joint_group.panels.begin() + last};
+
+            if (m_instanced && panels.size() > 1) {
+                renderPanelInstances(names, model_orientation, axis, component, profile, panels, joint_group.joints);
+                continue;
             }
+
+            if (!sketch) {
+                sketch = renderProfileSketch(names, model_orientation, axis, component, profile);
+            }
+
+            auto const feature = renderSinglePanel(names, *sketch, panels[0], model_orientation, joint_group.joints);
+
+            if (panels.size() == 1) { continue; }
+
+            renderPanelCopies(feature, panels);
         }
+
+        auto const end_pos = timeline->markerPosition() - 1;
+        if ((end_pos - start_pos) <= 0) { continue; }
+
+        session.groupTimeline(start_pos, end_pos, names + " Panel Group");
     }
 }
 
-void ParametricRenderer::execute(DefaultModelingOrientations model_orientation, const Ptr<Component>& component) {
+void ParametricRenderer::execute(ModelOrientation model_orientation) {
 
     m_renders.set<ExpressionParameterMap>();
 
-    initializeParameters();
+    auto session = RenderSession(Ptr<Design>{m_app->activeProduct()});
+
+    writeUserParameters(m_registry, m_backend);
     initializePanelGroups();
-    renderPanelGroups(model_orientation, component);
+    renderPanelGroups(model_orientation, m_component, session);
+
+    session.commit();
 
     m_renders.unset<ExpressionParameterMap>();
     m_renders.clear();
@@ -221,88 +388,145 @@ auto ParametricRenderer::renderSinglePanel(
     const std::string& names,
     const PanelProfileSketch& sketch,
     const PanelExtrusion& data,
-    const DefaultModelingOrientations& model_orientation,
-    jointPatternTypeMap& joints
+    const ModelOrientation& model_orientation,
+    const jointRenderEntries& joints
 ) -> Ptr<ExtrudeFeature> {
-    PLOG_DEBUG << "Extruding " << data.name << " with distance " << data.distance.expression << " and offset " << data.offset.expression;
+    auto const& table = nameTable(m_registry);
+    auto const& name  = table.name(data.name);
+
+    PLOG_DEBUG << "Extruding " << name << " with distance " << data.distance.expression << " and offset " << data.offset.expression;
     auto const extrusion = sketch.extrudeProfile(data.distance, data.offset);
 
     auto distance_param = Ptr<DistanceExtentDefinition>{extrusion->extentOne()}->distance();
     updateFormula(distance_param, data.distance.expression); // Reassign since Fusion appears to throw away the string expression
 
-    extrusion->name(data.name + " Panel Extrusion");
     auto const body = extrusion->bodies()->item(0);
-    body->name(data.name + " Panel Body");
+    {
+        SILVANUS_FUSION_CALL(NameEntity);
+        extrusion->name(name + " Panel Extrusion");
+        body->name(name + " Panel Body");
+    }
+    tag(extrusion);
 
     auto cuts = renderJointSketches(names, data, model_orientation, extrusion, joints);
 
+    // Rectangles on one face sketch that are copied by the same pattern, or by
+    // none, are cut together, one extrude feature per joint offset and depth.
+    auto batches = std::vector<CutBatch>{};
     for (auto const& cut_pairs: cuts) {
         for (auto const& cut: cut_pairs) {
-            auto &cut_sketch = cut.sketch;
-            auto const &cut_names  = cut.group.names;
-
-            std::vector<Ptr<ExtrudeFeature>> features;
-
-            for (auto const& cut_extrusion: cut.group.extrusions) {
-                auto const& cut_feature = cut_sketch.cutJoint(cut_extrusion.offset, cut_extrusion.distance, body);
-                auto const& offset_dimension = Ptr<Parameter>{Ptr<FromEntityStartDefinition>{cut_feature->startExtent()}->offset()};
-                auto const& distance_dimension = Ptr<DistanceExtentDefinition>{cut_feature->extentOne()}->distance();
-                PLOG_DEBUG << "Updating offset dimension: " << offset_dimension->name();
-                PLOG_DEBUG << (int)cut_extrusion.joint_id << "Finger cut offset is " << std::to_string(offset_dimension->value()) << " from " << offset_dimension->expression();
-                PLOG_DEBUG << (int)cut_extrusion.joint_id << "Finger cut offset expression is " << cut_extrusion.offset.expression;
-                PLOG_DEBUG << "Updating distance dimension: " << distance_dimension->name();
-                PLOG_DEBUG << (int)cut_extrusion.joint_id << "Finger cut distance expression is " << cut_extrusion.distance.expression;
-
-                auto offset_expression = cut_extrusion.offset.expression;
-                offset_expression.shrink_to_fit();
-                auto negative_offset = offset_expression.length() > 0 ? "-(" + offset_expression + ")" : "";
-                updateFormula(offset_dimension, offset_expression, negative_offset);
-
-                auto distance_expression = cut_extrusion.distance.expression;
-                distance_expression.shrink_to_fit();
-                auto negative_distance = distance_expression.length() > 0 ? "-(" + distance_expression + ")" : "";
-                updateFormula(distance_dimension, distance_expression, negative_distance);
-
-                auto group = cut.group.names;
-                auto feature_prefix = names + " " + concat_names({group.begin(), group.end()});
-                if (cut.corner) {
+            auto const pattern = patternKey(m_registry, cut);
+            auto batch = std::find_if(batches.begin(), batches.end(), [&](const CutBatch& batch) {
+                return (batch.sketch == cut.sketch) && (batch.pattern == pattern);
+            });
+            if (batch == batches.end()) {
+                batch = batches.insert(batches.end(), CutBatch{cut.sketch, pattern, {}});
+            }
+            batch->cuts.push_back(&cut);
+        }
+    }
+
+    for (auto const& batch: batches) {
+        auto const& cut_sketch = batch.sketch;
+        auto const& first_cut  = *batch.cuts.front();
+
+        auto cut_name_ids = std::vector<NameId>{};
+        auto extents      = std::vector<std::pair<JointExtrusion, std::vector<size_t>>>{};
+        for (auto const cut: batch.cuts) {
+            cut_name_ids.insert(cut_name_ids.end(), cut->group.names.begin(), cut->group.names.end());
+
+            for (auto const& cut_extrusion: cut->group.extrusions) {
+                auto extent = std::find_if(extents.begin(), extents.end(), [&cut_extrusion](const auto& extent) {
+                    return sameExtent(extent.first, cut_extrusion);
+                });
+                if (extent == extents.end()) {
+                    extents.emplace_back(cut_extrusion, std::vector<size_t>{cut->finger});
+                } else if (std::find(extent->second.begin(), extent->second.end(), cut->finger) == extent->second.end()) {
+                    extent->second.push_back(cut->finger);
+                }
+            }
+        }
+        std::sort(cut_name_ids.begin(), cut_name_ids.end());
+        cut_name_ids.erase(std::unique(cut_name_ids.begin(), cut_name_ids.end()), cut_name_ids.end());
+        auto const cut_names = table.join(cut_name_ids);
+
+        std::vector<Ptr<ExtrudeFeature>> features;
+
+        for (auto const& [cut_extrusion, fingers]: extents) {
+            auto const& cut_feature = cut_sketch->cutFingers(fingers, cut_extrusion.offset, cut_extrusion.distance, body);
+            if (!cut_feature) continue;
+
+            auto const& offset_dimension = Ptr<Parameter>{Ptr<FromEntityStartDefinition>{cut_feature->startExtent()}->offset()};
+            auto const& distance_dimension = Ptr<DistanceExtentDefinition>{cut_feature->extentOne()}->distance();
+            PLOG_DEBUG << "Updating offset dimension: " << offset_dimension->name();
+            PLOG_DEBUG << (int)cut_extrusion.joint_id << "Finger cut offset is " << std::to_string(offset_dimension->value()) << " from " << offset_dimension->expression();
+            PLOG_DEBUG << (int)cut_extrusion.joint_id << "Finger cut offset expression is " << cut_extrusion.offset.expression;
+            PLOG_DEBUG << "Updating distance dimension: " << distance_dimension->name();
+            PLOG_DEBUG << (int)cut_extrusion.joint_id << "Finger cut distance expression is " << cut_extrusion.distance.expression;
+
+            auto offset_expression = cut_extrusion.offset.expression;
+            offset_expression.shrink_to_fit();
+            auto negative_offset = offset_expression.length() > 0 ? "-(" + offset_expression + ")" : "";
+            updateFormula(offset_dimension, offset_expression, negative_offset);
+
+            auto distance_expression = cut_extrusion.distance.expression;
+            distance_expression.shrink_to_fit();
+            auto negative_distance = distance_expression.length() > 0 ? "-(" + distance_expression + ")" : "";
+            updateFormula(distance_dimension, distance_expression, negative_distance);
+
+            auto feature_prefix = names + " " + cut_names;
+
+            {
+                SILVANUS_FUSION_CALL(NameEntity);
+                if (first_cut.corner) {
                     cut_feature->name(feature_prefix + " Corner Extrusion");
                 } else {
                     cut_feature->name(feature_prefix + " Finger Extrusion");
                 }
-                features.emplace_back(cut_feature);
             }
+            tag(cut_feature);
+            features.emplace_back(cut_feature);
+        }
 
-            if ((cut.profile.finger_count <= 1) && (!cut.corner)) {
-                continue;
-            }
+        if (batch.pattern.empty() || features.empty()) {
+            continue;
+        }
 
-            auto const &product        = m_app->activeProduct();
-            auto const &design         = adsk::core::Ptr<Design>{product};
-            auto const &root_component = design->rootComponent();
+        // Patterns have to live in the component of the features they copy,
+        // which is not the root one for instanced panels.
+        auto const &panel_component = extrusion->parentComponent();
 
-            auto replicator = FingerCutsPattern(m_app, root_component);
+        auto replicator = FingerCutsPattern(m_app, panel_component);
 
-            auto const &copy_feature = replicator.copy(model_orientation, features, cut.profile, cut.corner);
-            if (copy_feature) {
-                auto feature_prefix = names + " " + concat_names({cut_names.begin(), cut_names.end()});
-                if (cut.corner) {
-                    auto const& distance = copy_feature->distanceOne();
+        // Every cut of the batch has the same pattern, so the first one's
+        // profile drives it.
+        auto const &copy_feature = replicator.copy(model_orientation, features, first_cut.profile, first_cut.corner);
+        if (copy_feature) {
+            tag(copy_feature);
 
-                    auto distance_expression = cut.profile.parameters.corner_distance;
-                    updateFormula(distance, distance_expression);
-                    copy_feature->name(feature_prefix.append(" Corner Pattern"));
-                } else {
-                    auto const& distance = copy_feature->distanceOne();
-                    auto const& quantity = copy_feature->quantityOne();
+            auto feature_prefix = names + " " + cut_names;
+            if (first_cut.corner) {
+                auto const& distance = copy_feature->distanceOne();
 
-                    auto distance_expression = cut.profile.parameters.pattern_distance;
-                    updateFormula(distance, distance_expression);
+                auto distance_expression = jointProfileParams(m_registry, first_cut.profile).corner_distance;
+                updateFormula(distance, distance_expression);
 
-                    auto quantity_expression = cut.profile.parameters.finger_count;
-                    updateFormula(quantity, quantity_expression);
-                    copy_feature->name(feature_prefix.append(" Finger Pattern"));
-                }
+                SILVANUS_FUSION_CALL(NameEntity);
+                copy_feature->name(feature_prefix.append(" Corner Pattern"));
+            } else {
+                auto const& distance = copy_feature->distanceOne();
+                auto const& quantity = copy_feature->quantityOne();
+
+                auto const& parameters = jointProfileParams(m_registry, first_cut.profile);
+
+                auto distance_expression = parameters.pattern_distance;
+                updateFormula(distance, distance_expression);
+
+                auto quantity_expression = parameters.finger_count;
+                updateFormula(quantity, quantity_expression);
+
+                SILVANUS_FUSION_CALL(NameEntity);
+                copy_feature->name(feature_prefix.append(" Finger Pattern"));
             }
         }
     }
@@ -316,22 +540,86 @@ void ParametricRenderer::renderPanelCopies(
 ) {
     auto copies = std::vector<PanelExtrusion>{panels.begin() + 1, panels.end()};
 
-    auto      parent = PanelFeature(feature);
+    auto const& table  = nameTable(m_registry);
+    auto        parent = PanelFeature(feature);
     for (auto &panel : copies) {
+        auto const& name = table.name(panel.name);
+
         auto extrusion = parent.extrudeCopy(panel.distance, panel.offset, panels[0].offset);
 
-        extrusion->name(panel.name + " Panel Extrusion");
         auto body = extrusion->bodies()->item(0);
-        body->name(panel.name + " Panel Body");
+        {
+            SILVANUS_FUSION_CALL(NameEntity);
+            extrusion->name(name + " Panel Extrusion");
+            body->name(name + " Panel Body");
+        }
+        tag(extrusion);
+    }
+}
+
+void ParametricRenderer::renderPanelInstances(
+    const std::string& names,
+    ModelOrientation model_orientation,
+    AxisFlag axis,
+    const Ptr<Component>& component,
+    const PanelProfile& profile,
+    const std::vector<PanelExtrusion>& panels,
+    const jointRenderEntries& joints
+) {
+    auto const& table = nameTable(m_registry);
+    auto const& first = panels[0];
+
+    auto instance = Ptr<Occurrence>{};
+    {
+        SILVANUS_FUSION_CALL(AddOccurrence);
+        instance = component->occurrences()->addNewComponent(Matrix3D::create());
+    }
+    if (!instance) {
+        PLOG_DEBUG << "Unable to create a component for " << names << "; rendering the panels as copies";
+        auto const feature = renderSinglePanel(names, renderProfileSketch(names, model_orientation, axis, component, profile), first, model_orientation, joints);
+        renderPanelCopies(feature, panels);
+        return;
+    }
+    tag(instance);
+
+    auto const panel_component = instance->component();
+    auto panel_names = std::vector<std::string>{};
+    for (auto const& panel: panels) panel_names.emplace_back(table.name(panel.name));
+    {
+        SILVANUS_FUSION_CALL(NameEntity);
+        panel_component->name(concat_names(panel_names) + " Panel");
+    }
+
+    // The first panel is rendered where it sits, so its occurrence keeps the
+    // identity transform and every other panel is moved along the panel normal
+    // by the difference of the offsets.
+    auto const sketch = renderProfileSketch(names, model_orientation, axis, panel_component, profile);
+    renderSinglePanel(names, sketch, first, model_orientation, joints);
+
+    auto const normal = profilePlane(model_orientation, axis, component)->geometry()->normal();
+
+    for (auto const& panel: std::vector<PanelExtrusion>{panels.begin() + 1, panels.end()}) {
+        auto const shift     = normal->copy();
+        auto const transform = Matrix3D::create();
+        shift->scaleBy(panel.offset.value - first.offset.value);
+        transform->translation(shift);
+
+        PLOG_DEBUG << "Placing " << table.name(panel.name) << " as an occurrence of " << panel_component->name();
+        auto occurrence = Ptr<Occurrence>{};
+        {
+            SILVANUS_FUSION_CALL(AddOccurrence);
+            occurrence = component->occurrences()->addExistingComponent(panel_component, transform);
+        }
+        tag(occurrence);
     }
 }
 
 auto ParametricRenderer::renderJointSketches(
     const std::string& panel_name,
     const PanelExtrusion& panel,
-    const DefaultModelingOrientations& model_orientation,
+    const ModelOrientation& model_orientation,
     const adsk::core::Ptr<ExtrudeFeature>& extrusion,
-    jointPatternTypeMap& joints
+    const jointRenderEntries& joints
 ) -> std::vector<std::vector<CutProfile>>{
     std::vector<std::vector<CutProfile>> cuts;
 
@@ -345,59 +633,103 @@ auto ParametricRenderer::renderJointSketches(
         {JointPatternType::QuadTenon,   "Quad Tenon"}
     };
 
-    for (auto &[joint_type, joint_name]: name_selector){
-        for (auto&[joint_direction, direction_data]: joints[joint_type]) {
-            for (auto &[joint_orientation, joint_groups]: direction_data) {
-                for (auto const&[joint_profile, joint_profile_data]: joint_groups) {
-                    cuts.emplace_back(
-                        renderJointSketch(panel_name, panel, model_orientation, extrusion, joint_name, joint_orientation, joint_groups));
+    // Every finger and corner rectangle that lands on a face is drawn into one
+    // sketch of that face, and only one that touches a rectangle already
+    // there starts another.
+    auto face_sketches = faceSketchMap{};
+
+    // The entries are sorted by joint type, direction and orientation, so each
+    // run of one orientation is drawn together, in the order of the selector.
+    for (auto first = joints.begin(); first != joints.end();) {
+        auto last = std::find_if(first, joints.end(), [&first](const JointRenderEntry& joint) {
+            return std::tie(joint.joint_type, joint.joint_direction, joint.joint_orientation)
+                != std::tie(first->joint_type, first->joint_direction, first->joint_orientation);
+        });
+
+        auto const selected = name_selector.find(first->joint_type);
+        if (selected != name_selector.end()) {
+            auto const& joint_name = selected->second;
+            cuts.emplace_back(
+                renderJointSketch(panel_name, panel, model_orientation, extrusion, joint_name, first->joint_orientation, first, last, face_sketches));
+            cuts.emplace_back(
+                renderCornerJointSketch(panel_name, panel, model_orientation, extrusion, joint_name + " Corner", first->joint_orientation, first, last, face_sketches));
+        }
+
+        first = last;
+    }
+
+    return cuts;
+}
 
-                    if (joint_profile.corner_width == 0) continue;
+auto ParametricRenderer::drawFingerOnFace(
+    faceSketchMap& face_sketches,
+    const std::string& panel_name,
+    const std::string& sketch_name,
+    const ModelOrientation& model_orientation,
+    const Ptr<ExtrudeFeature>& extrusion,
+    const AxisFlag& joint_orientation,
+    const Ptr<Point3D>& start,
+    const Ptr<Point3D>& end
+) -> std::pair<std::shared_ptr<PanelFingerSketch>, size_t> {
+    auto& sketches = face_sketches[joint_orientation];
 
-                    cuts.emplace_back(
-                        renderCornerJointSketch(panel_name, panel, model_orientation, extrusion, joint_name + " Corner", joint_orientation, joint_groups));
+    for (auto const& sketch: sketches) {
+        if (sketch->overlaps(start, end)) continue;
 
-                }
-            }
-        }
+        return {sketch, sketch->addFinger(start, end)};
     }
 
-    return cuts;
+    auto const& sketch = sketches.emplace_back(std::make_shared<PanelFingerSketch>(
+        extrusion, face_selectors[model_orientation][joint_orientation], start, end, sketch_name
+    ));
+    tag(sketch->sketch());
+    return {sketch, 0};
 }
 
 auto ParametricRenderer::renderJointSketch(
     const std::string& panel_name,
     const PanelExtrusion& panel,
-    const DefaultModelingOrientations &model_orientation,
+    const ModelOrientation &model_orientation,
     const Ptr<ExtrudeFeature> &extrusion,
     const std::string& sketch_prefix,
     const AxisFlag &joint_orientation,
-    const profileRenderGroupMap &joint_groups
+    jointRenderEntries::const_iterator first,
+    jointRenderEntries::const_iterator last,
+    faceSketchMap& face_sketches
 ) -> std::vector<CutProfile>{
     auto profiles    = std::vector<CutProfile>{};
     auto panel_thickness = panel.distance;
 
-    for (auto const& [profile, joints]: joint_groups) {
+    for (auto joint = first; joint != last; ++joint) {
+        auto const& profile = joint->profile;
+        auto const& joints  = joint->group;
+
         if ((profile.joint_direction == JointDirectionType::Inverted) && (profile.finger_count < 1)) {
             continue;
         }
-        auto const suffix         = " " + concat_names(std::vector<std::string>(joints.names.begin(), joints.names.end())) + " " + sketch_prefix + " Sketch";
+        auto const suffix         = " " + nameTable(m_registry).join(joints.names) + " " + sketch_prefix + " Sketch";
         auto const profile_name   = panel_name + suffix;
         auto const pattern_offset = profile.pattern_offset;
         auto const finger_width   = profile.finger_width;
 
-        auto sketch = PanelFingerSketch(
-            extrusion,
-            face_selectors[model_orientation][joint_orientation],
+        auto const [sketch, finger] = drawFingerOnFace(
+            face_sketches, panel_name, profile_name, model_orientation, extrusion, joint_orientation,
             Point3D::create(pattern_offset, 0, 0),
-            Point3D::create(finger_width, panel_thickness.value, 0),
-            profile_name
+            Point3D::create(finger_width, panel_thickness.value, 0)
         );
-        PLOG_DEBUG << "Finger profile width: " << profile.parameters.finger_width;
-        if (profile.parameters.finger_width.length() > 0) sketch.fingerLength()->expression(profile.parameters.finger_width);
-        if (profile.parameters.pattern_offset.length() > 0) sketch.originOffset()->expression(profile.parameters.pattern_offset);
+        auto const& parameters = jointProfileParams(m_registry, profile);
+
+        PLOG_DEBUG << "Finger profile width: " << parameters.finger_width;
+        if (parameters.finger_width.length() > 0) {
+            SILVANUS_FUSION_CALL(WriteExpression);
+            sketch->fingerLength(finger)->expression(parameters.finger_width);
+        }
+        if (parameters.pattern_offset.length() > 0) {
+            SILVANUS_FUSION_CALL(WriteExpression);
+            sketch->originOffset(finger)->expression(parameters.pattern_offset);
+        }
 
-        profiles.emplace_back(CutProfile{sketch, joints, profile});
+        profiles.emplace_back(CutProfile{sketch, joints, profile, false, finger});
     }
 
     return profiles;
@@ -406,30 +738,38 @@ auto ParametricRenderer::renderJointSketch(
 auto ParametricRenderer::renderCornerJointSketch(
     const std::string& panel_name,
     const PanelExtrusion& panel,
-    const DefaultModelingOrientations& model_orientation,
+    const ModelOrientation& model_orientation,
     const Ptr<ExtrudeFeature>& extrusion,
     const std::string& sketch_prefix,
     const AxisFlag& joint_orientation,
-    const profileRenderGroupMap& joint_groups
+    jointRenderEntries::const_iterator first,
+    jointRenderEntries::const_iterator last,
+    faceSketchMap& face_sketches
 ) -> std::vector<CutProfile>{
     auto pairs    = std::vector<CutProfile>{};
     auto panel_thickness = panel.distance;
 
-    for (auto const& [profile, joints]: joint_groups) {
-        auto const suffix         = " " + concat_names(std::vector<std::string>(joints.names.begin(), joints.names.end())) + " " + sketch_prefix + " Sketch";
+    for (auto joint = first; joint != last; ++joint) {
+        auto const& profile = joint->profile;
+        auto const& joints  = joint->group;
+
+        if (profile.corner_width == 0) continue;
+
+        auto const suffix         = " " + nameTable(m_registry).join(joints.names) + " " + sketch_prefix + " Sketch";
         auto const profile_name   = panel_name + suffix;
         auto const pattern_offset = 0;
         auto const finger_width   = profile.corner_width;
 
-        auto sketch = PanelFingerSketch(
-            extrusion,
-            face_selectors[model_orientation][joint_orientation],
+        auto const [sketch, finger] = drawFingerOnFace(
+            face_sketches, panel_name, profile_name, model_orientation, extrusion, joint_orientation,
             Point3D::create(pattern_offset, 0, 0),
-            Point3D::create(finger_width, panel_thickness.value, 0),
-            profile_name
+            Point3D::create(finger_width, panel_thickness.value, 0)
         );
-        sketch.fingerLength()->expression(profile.parameters.corner_width);
-        pairs.emplace_back(CutProfile{sketch, joints, profile, true});
+        {
+            SILVANUS_FUSION_CALL(WriteExpression);
+            sketch->fingerLength(finger)->expression(jointProfileParams(m_registry, profile).corner_width);
+        }
+        pairs.emplace_back(CutProfile{sketch, joints, profile, true, finger});
     }
 
     return pairs;
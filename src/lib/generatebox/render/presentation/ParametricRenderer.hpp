@@ -13,21 +13,25 @@
 #include <entt/entt.hpp>
 
 #include "rendersupport.hpp"
+#include "sketchsupport.hpp"
 
 #include "Renderer.hpp"
+#include "fusion/EntityTags.hpp"
+#include "fusion/FusionBackend.hpp"
 #include "fusion/PanelFingerSketch.hpp"
 #include "fusion/PanelProfileSketch.hpp"
+#include "fusion/RenderSession.hpp"
 #include "entities/AxisFlag.hpp"
 #include "entities/Dimensions.hpp"
 #include "entities/JointExtrusion.hpp"
 #include "entities/JointProfile.hpp"
 #include "entities/JointThickness.hpp"
+#include "entities/ModelOrientation.hpp"
 #include "entities/PanelExtrusion.hpp"
 #include "entities/PanelProfile.hpp"
 #include "entities/Parameter.hpp"
 
 #include <map>
-#include <set>
 #include <string>
 #include <utility>
 
@@ -101,20 +105,52 @@ namespace silvanus::generatebox::render {
             }
 
             orientationAxisSelector face_selectors = {
-                {adsk::core::YUpModelingOrientation, yup_faces},
-                {adsk::core::ZUpModelingOrientation, zup_faces}
+                {entities::ModelOrientation::YUp, yup_faces},
+                {entities::ModelOrientation::ZUp, zup_faces}
             };
 
             adsk::core::Ptr<adsk::core::Application> &m_app;
+            fusion::FusionBackend                    &m_backend;
             entt::registry                           &m_registry;
             entt::registry                           m_renders;
+            adsk::core::Ptr<adsk::fusion::Component> m_component;
+            bool                                     m_instanced;
+            bool                                     m_update_existing;
+            std::string                              m_box;
+
+            // Key of the panel group being rendered, tagged on everything it creates.
+            std::string                              m_group_key;
+
+            // Only a render that updates the box tags what it creates. Tags are
+            // only ever read to update a box, and a box generated with update
+            // mode off saves the attribute write on every entity it creates.
+            template <class T>
+            void tag(const adsk::core::Ptr<T>& entity) const {
+                if (!m_update_existing) return;
+
+                fusion::tagEntity(entity, m_box, m_group_key);
+            }
+
+            auto profilePlane(
+                entities::ModelOrientation model_orientation,
+                entities::AxisFlag axis,
+                const adsk::core::Ptr<adsk::fusion::Component>& component
+            ) -> adsk::core::Ptr<adsk::fusion::ConstructionPlane>;
+
+            auto renderProfileSketch(
+                const std::string& names,
+                entities::ModelOrientation model_orientation,
+                entities::AxisFlag axis,
+                const adsk::core::Ptr<adsk::fusion::Component>& component,
+                const entities::PanelProfile& profile
+            ) -> fusion::PanelProfileSketch;
 
             auto renderSinglePanel(
                 const std::string& names,
                 const fusion::PanelProfileSketch& sketch,
                 const entities::PanelExtrusion& extrusion,
-                const adsk::core::DefaultModelingOrientations& orientation,
-                jointPatternTypeMap& joints
+                const entities::ModelOrientation& orientation,
+                const jointRenderEntries& joints
             ) -> adsk::core::Ptr<adsk::fusion::ExtrudeFeature>;
 
             auto renderPanelCopies(
@@ -122,68 +158,88 @@ namespace silvanus::generatebox::render {
                 const std::vector<entities::PanelExtrusion> &panels
             ) -> void;
 
+            auto renderPanelInstances(
+                const std::string& names,
+                entities::ModelOrientation model_orientation,
+                entities::AxisFlag axis,
+                const adsk::core::Ptr<adsk::fusion::Component>& component,
+                const entities::PanelProfile& profile,
+                const std::vector<entities::PanelExtrusion>& panels,
+                const jointRenderEntries& joints
+            ) -> void;
+
             auto renderJointSketches(
                 const std::string& panel_name,
                 const entities::PanelExtrusion& panel,
-                const adsk::core::DefaultModelingOrientations& orientation,
+                const entities::ModelOrientation& orientation,
                 const adsk::core::Ptr<adsk::fusion::ExtrudeFeature>& extrusion,
-                jointPatternTypeMap& joints
+                const jointRenderEntries& joints
             ) -> std::vector<std::vector<CutProfile>>;
 
+            // Adds the finger to a sketch already started on the face when it
+            // fits there, and starts a new sketch otherwise.
+            auto drawFingerOnFace(
+                faceSketchMap& face_sketches,
+                const std::string& panel_name,
+                const std::string& sketch_name,
+                const entities::ModelOrientation& model_orientation,
+                const adsk::core::Ptr<adsk::fusion::ExtrudeFeature>& extrusion,
+                const entities::AxisFlag& joint_orientation,
+                const adsk::core::Ptr<adsk::core::Point3D>& start,
+                const adsk::core::Ptr<adsk::core::Point3D>& end
+            ) -> std::pair<std::shared_ptr<fusion::PanelFingerSketch>, size_t>;
 
             auto renderJointSketch(
                 const std::string& panel_name,
                 const entities::PanelExtrusion& panel,
-                const adsk::core::DefaultModelingOrientations& model_orientation,
+                const entities::ModelOrientation& model_orientation,
                 const adsk::core::Ptr<adsk::fusion::ExtrudeFeature>& extrusion,
                 const std::string& sketch_prefix,
                 const entities::AxisFlag& joint_orientation,
-                const profileRenderGroupMap& joint_groups
+                jointRenderEntries::const_iterator first,
+                jointRenderEntries::const_iterator last,
+                faceSketchMap& face_sketches
             ) -> std::vector<CutProfile>;
 
             auto renderCornerJointSketch(
                 const std::string& panel_name,
                 const entities::PanelExtrusion& panel,
-                const adsk::core::DefaultModelingOrientations& model_orientation,
+                const entities::ModelOrientation& model_orientation,
                 const adsk::core::Ptr<adsk::fusion::ExtrudeFeature>& extrusion,
                 const std::string& sketch_prefix,
                 const entities::AxisFlag& joint_orientation,
-                const profileRenderGroupMap& joint_groups
+                jointRenderEntries::const_iterator first,
+                jointRenderEntries::const_iterator last,
+                faceSketchMap& face_sketches
             ) -> std::vector<CutProfile>;
 
-            static auto find_or_create_parameter(
-                adsk::core::Ptr<adsk::fusion::ParameterList>& all_parameters,
-                adsk::core::Ptr<adsk::fusion::UserParameters>& user_parameters,
-                entities::FloatParameter& input
-                ) -> void;
-            static auto create_parameter(
-                adsk::core::Ptr<adsk::fusion::UserParameters>& all_parameters,
-                entities::FloatParameter& input
-                ) -> void;
-            static auto update_parameter(
-                adsk::core::Ptr<adsk::fusion::Parameter>& parameter,
-                entities::FloatParameter& input
-            ) -> void;
-
             auto updateFormula(const adsk::core::Ptr<adsk::fusion::Parameter>& parameter, std::string expression) -> void;
             auto updateFormula(
                 const adsk::core::Ptr<adsk::fusion::Parameter>& parameter,
                 const std::string& expression,
                 const std::string& negative) -> void;
-            auto initializeParameters() -> void;
             auto initializePanelGroups() -> void;
             auto renderPanelGroups(
-                adsk::core::DefaultModelingOrientations orientation,
-                const adsk::core::Ptr<adsk::fusion::Component> &component
+                entities::ModelOrientation orientation,
+                const adsk::core::Ptr<adsk::fusion::Component> &component,
+                fusion::RenderSession &session
                 ) -> void;
 
         public:
-            ParametricRenderer(adsk::core::Ptr<adsk::core::Application> &app, entt::registry &registry) : m_app{app}, m_registry{registry} {};
-
-            void execute(
-                adsk::core::DefaultModelingOrientations orientation,
-                const adsk::core::Ptr<adsk::fusion::Component> &component
-            ) override;
+            // With instanced set, identical panels are rendered once in a
+            // component of their own and the others become occurrences of it.
+            // With update_existing set, panel groups of the named box already in
+            // the design from an earlier update render are kept as they are,
+            // since their features follow the user parameters, and only the
+            // groups that changed are replaced. Other boxes are left alone.
+            ParametricRenderer(
+                adsk::core::Ptr<adsk::core::Application> &app, fusion::FusionBackend &backend, entt::registry &registry,
+                const adsk::core::Ptr<adsk::fusion::Component> &component, bool instanced = false, bool update_existing = false,
+                std::string box = ""
+            ) : m_app{app}, m_backend{backend}, m_registry{registry}, m_component{component}, m_instanced{instanced},
+                m_update_existing{update_existing}, m_box{std::move(box)} {};
+
+            void execute(entities::ModelOrientation orientation) override;
 
     };
 }
@@ -0,0 +1,67 @@
+//
+// Created by Hobbyist Maker on 9/20/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "PreviewRenderer.hpp"
+
+#include "fusion/FusionCallProfiler.hpp"
+#include "render/geometry/collectPanelGeometry.hpp"
+
+#include <plog/Log.h>
+
+#include <utility>
+
+using namespace adsk::core;
+using namespace adsk::fusion;
+
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::render;
+
+void PreviewRenderer::execute(ModelOrientation orientation) {
+    auto const panels = collectPanelGeometry(m_registry);
+
+    if (panels.empty()) {
+        PLOG_DEBUG << "No panels found to preview.";
+        return;
+    }
+
+    auto mesher = PanelMesher{};
+    auto mesh   = Mesh{};
+    for (auto const& panel: panels) {
+        mesher.append(panel, mesh);
+    }
+
+    orientMesh(orientation, mesh);
+
+    PLOG_DEBUG << "Preview mesh has " << mesh.triangles() << " triangles for " << panels.size() << " panels";
+
+    SILVANUS_FUSION_CALL(AddCustomGraphics);
+    auto graphics    = m_component->customGraphicsGroups()->add();
+    auto coordinates = CustomGraphicsCoordinates::create(mesh.coordinates);
+    auto body        = graphics->addMesh(coordinates, mesh.indices, mesh.normals, mesh.indices);
+    if (!body) {
+        PLOG_DEBUG << "Unable to add the preview mesh.";
+        return;
+    }
+
+    body->color(CustomGraphicsBasicMaterialColorEffect::create(
+        Color::create(214, 180, 134, 255), Color::create(120, 96, 64, 255)
+    ));
+}
+
+void PreviewRenderer::orientMesh(ModelOrientation orientation, Mesh& mesh) {
+    if (orientation != ModelOrientation::YUp) return;
+
+    // Y up places height on Y and width on Z. Swapping two axes mirrors the mesh,
+    // so the triangle winding is reversed to keep the faces pointing outward.
+    for (size_t i = 0; i < mesh.coordinates.size(); i += 3) {
+        std::swap(mesh.coordinates[i + 1], mesh.coordinates[i + 2]);
+        std::swap(mesh.normals[i + 1], mesh.normals[i + 2]);
+    }
+
+    for (size_t i = 0; i < mesh.indices.size(); i += 3) {
+        std::swap(mesh.indices[i + 1], mesh.indices[i + 2]);
+    }
+}
@@ -0,0 +1,41 @@
+//
+// Created by Hobbyist Maker on 9/20/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_PREVIEWRENDERER_HPP
+#define SILVANUSPRO_PREVIEWRENDERER_HPP
+
+#include "Renderer.hpp"
+#include "render/geometry/PanelMesh.hpp"
+
+#include <Core/CoreAll.h>
+#include <Fusion/FusionAll.h>
+#include <entt/entt.hpp>
+
+namespace silvanus::generatebox::render {
+
+    // Displays the configured panels as custom graphics meshes. Nothing is added
+    // to the design, so Fusion never has to build or boolean a BRep body just to
+    // show the user what the box will look like.
+    class PreviewRenderer : public Renderer {
+
+            adsk::core::Ptr<adsk::core::Application>& m_app;
+            entt::registry& m_registry;
+            adsk::core::Ptr<adsk::fusion::Component> m_component;
+
+            static void orientMesh(entities::ModelOrientation orientation, geometry::Mesh& mesh);
+
+        public:
+
+            PreviewRenderer(
+                adsk::core::Ptr<adsk::core::Application>& app, entt::registry& registry,
+                const adsk::core::Ptr<adsk::fusion::Component>& component
+            ) : m_app{app}, m_registry{registry}, m_component{component} {};
+
+            void execute(entities::ModelOrientation orientation) override;
+    };
+
+}
+
+#endif //SILVANUSPRO_PREVIEWRENDERER_HPP
@@ -7,6 +7,11 @@
 
 #include "rendersupport.hpp"
 
+#include "entities/ModelOrientation.hpp"
+
+#include <string>
+#include <vector>
+
 namespace silvanus::generatebox::render {
 
     class Renderer {
@@ -35,8 +40,8 @@ namespace silvanus::generatebox::render {
             }}
         };
         orientation_transform_map sketch_transforms = { // NOLINT(cert-err58-cpp)
-            {adsk::core::YUpModelingOrientation, yup_sketch_transform},
-            {adsk::core::ZUpModelingOrientation, zup_sketch_transform}
+            {entities::ModelOrientation::YUp, yup_sketch_transform},
+            {entities::ModelOrientation::ZUp, zup_sketch_transform}
         };
 
         static std::string concat_names(const std::vector<std::string>& source) {
@@ -51,10 +56,11 @@ namespace silvanus::generatebox::render {
         }
 
     public:
-        virtual void execute(
-            adsk::core::DefaultModelingOrientations orientation,
-            const adsk::core::Ptr<adsk::fusion::Component>& component
-        ) = 0;
+        virtual ~Renderer() = default;
+
+        // Renderers that draw into a Fusion component are given it when they
+        // are constructed, so this interface stays free of the Fusion SDK.
+        virtual void execute(entities::ModelOrientation orientation) = 0;
     };
 
 }
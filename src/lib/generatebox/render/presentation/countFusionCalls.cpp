@@ -0,0 +1,18 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "countFusionCalls.hpp"
+#include "DirectRenderer.hpp"
+
+#include "entities/ModelOrientation.hpp"
+#include "fusion/RecordingBackend.hpp"
+
+auto silvanus::generatebox::render::countFusionCalls(entt::registry& registry) -> std::size_t {
+    auto backend  = fusion::RecordingBackend{};
+    auto renderer = DirectRenderer(backend, registry);
+    renderer.execute(entities::ModelOrientation::YUp);
+
+    return backend.total();
+}
@@ -0,0 +1,21 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_COUNTFUSIONCALLS_HPP
+#define SILVANUSPRO_COUNTFUSIONCALLS_HPP
+
+#include <entt/entt.hpp>
+
+#include <cstddef>
+
+namespace silvanus::generatebox::render {
+
+    // Renders a configured registry with the direct renderer against a
+    // RecordingBackend and returns the number of Fusion calls it made.
+    auto countFusionCalls(entt::registry& registry) -> std::size_t;
+
+}
+
+#endif //SILVANUSPRO_COUNTFUSIONCALLS_HPP
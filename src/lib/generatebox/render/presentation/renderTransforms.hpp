@@ -0,0 +1,270 @@
+//
+// Created by Hobbyist Maker on 10/6/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_RENDERTRANSFORMS_HPP
+#define SILVANUSPRO_RENDERTRANSFORMS_HPP
+
+#include "fusion/FusionBackend.hpp"
+#include "entities/AxisFlag.hpp"
+#include "entities/ModelOrientation.hpp"
+
+namespace silvanus::generatebox::render {
+
+    using entities::AxisFlag;
+    using entities::ModelOrientation;
+    using fusion::Vector3;
+
+    // How a panel lying on axis A is placed in a Y-up or Z-up model: the
+    // directions of its length and width, where its box is moved to from the
+    // origin, and how far a copy of it is moved along its thickness.
+    template <ModelOrientation O, AxisFlag A>
+    struct PanelTransform;
+
+    template <>
+    struct PanelTransform<ModelOrientation::YUp, AxisFlag::Length> {
+        static constexpr ModelOrientation orientation = ModelOrientation::YUp;
+        static constexpr AxisFlag                    axis        = AxisFlag::Length;
+
+        static constexpr Vector3 length_direction{0.0, 0.0, 1.0};
+        static constexpr Vector3 width_direction{0.0, 1.0, 0.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {h, w, l}; }
+        static constexpr auto center(double l, double w, double h, double o) -> Vector3 { return {l + o, w, h}; }
+        static constexpr auto copy(double o) -> Vector3 { return {o, 0, 0}; }
+    };
+
+    template <>
+    struct PanelTransform<ModelOrientation::YUp, AxisFlag::Width> {
+        static constexpr ModelOrientation orientation = ModelOrientation::YUp;
+        static constexpr AxisFlag                    axis        = AxisFlag::Width;
+
+        static constexpr Vector3 length_direction{1.0, 0.0, 0.0};
+        static constexpr Vector3 width_direction{0.0, 1.0, 0.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {l, w, h}; }
+        static constexpr auto center(double l, double w, double h, double o) -> Vector3 { return {l, w, h + o}; }
+        static constexpr auto copy(double o) -> Vector3 { return {0, 0, o}; }
+    };
+
+    template <>
+    struct PanelTransform<ModelOrientation::YUp, AxisFlag::Height> {
+        static constexpr ModelOrientation orientation = ModelOrientation::YUp;
+        static constexpr AxisFlag                    axis        = AxisFlag::Height;
+
+        static constexpr Vector3 length_direction{1.0, 0.0, 0.0};
+        static constexpr Vector3 width_direction{0.0, 0.0, 1.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {l, h, w}; }
+        static constexpr auto center(double l, double w, double h, double o) -> Vector3 { return {l, w + o, h}; }
+        static constexpr auto copy(double o) -> Vector3 { return {0, o, 0}; }
+    };
+
+    template <>
+    struct PanelTransform<ModelOrientation::ZUp, AxisFlag::Length> {
+        static constexpr ModelOrientation orientation = ModelOrientation::ZUp;
+        static constexpr AxisFlag                    axis        = AxisFlag::Length;
+
+        static constexpr Vector3 length_direction{0.0, 1.0, 0.0};
+        static constexpr Vector3 width_direction{0.0, 0.0, 1.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {h, l, w}; }
+        static constexpr auto center(double l, double w, double h, double o) -> Vector3 { return {l + o, h, w}; }
+        static constexpr auto copy(double o) -> Vector3 { return {o, 0, 0}; }
+    };
+
+    template <>
+    struct PanelTransform<ModelOrientation::ZUp, AxisFlag::Width> {
+        static constexpr ModelOrientation orientation = ModelOrientation::ZUp;
+        static constexpr AxisFlag                    axis        = AxisFlag::Width;
+
+        static constexpr Vector3 length_direction{1.0, 0.0, 0.0};
+        static constexpr Vector3 width_direction{0.0, 0.0, 1.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {l, h, w}; }
+        static constexpr auto center(double l, double w, double h, double o) -> Vector3 { return {l, h + o, w}; }
+        static constexpr auto copy(double o) -> Vector3 { return {0, o, 0}; }
+    };
+
+    template <>
+    struct PanelTransform<ModelOrientation::ZUp, AxisFlag::Height> {
+        static constexpr ModelOrientation orientation = ModelOrientation::ZUp;
+        static constexpr AxisFlag                    axis        = AxisFlag::Height;
+
+        static constexpr Vector3 length_direction{1.0, 0.0, 0.0};
+        static constexpr Vector3 width_direction{0.0, 1.0, 0.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {l, w, h}; }
+        static constexpr auto center(double l, double w, double h, double o) -> Vector3 { return {l, h, w + o}; }
+        static constexpr auto copy(double o) -> Vector3 { return {0, 0, o}; }
+    };
+
+    // How the fingers cut into a panel on axis A by a joint along axis J are
+    // placed: the directions of a finger's length and width, the center of
+    // the first finger from the panel and joint offsets and distances, and
+    // how far a finger is moved along the joint.
+    template <ModelOrientation O, AxisFlag A, AxisFlag J>
+    struct JointTransform;
+
+    template <>
+    struct JointTransform<ModelOrientation::YUp, AxisFlag::Length, AxisFlag::Width> {
+        static constexpr Vector3 length_direction{0.0, 1.0, 0.0};
+        static constexpr Vector3 width_direction{0.0, 0.0, 1.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {h, l, w}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {po + pd/2, 0, jo + jd/2}; }
+    };
+
+    template <>
+    struct JointTransform<ModelOrientation::YUp, AxisFlag::Length, AxisFlag::Height> {
+        static constexpr Vector3 length_direction{0.0, 0.0, 1.0};
+        static constexpr Vector3 width_direction{0.0, 1.0, 0.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {w, h, l}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {po + pd/2, jo + jd/2, 0}; }
+    };
+
+    template <>
+    struct JointTransform<ModelOrientation::YUp, AxisFlag::Width, AxisFlag::Length> {
+        static constexpr Vector3 length_direction{0.0, 1.0, 0.0};
+        static constexpr Vector3 width_direction{1.0, 0.0, 0.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {w, l, h}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {jo + jd/2, 0, po + pd/2}; }
+    };
+
+    template <>
+    struct JointTransform<ModelOrientation::YUp, AxisFlag::Width, AxisFlag::Height> {
+        static constexpr Vector3 length_direction{1.0, 0.0, 0.0};
+        static constexpr Vector3 width_direction{0.0, 1.0, 0.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {l, w, h}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {0, jo + jd/2, po + pd/2}; }
+    };
+
+    template <>
+    struct JointTransform<ModelOrientation::YUp, AxisFlag::Height, AxisFlag::Length> {
+        static constexpr Vector3 length_direction{0.0, 0.0, 1.0};
+        static constexpr Vector3 width_direction{1.0, 0.0, 0.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {h, w, l}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {jo + jd/2, po + pd/2, 0}; }
+    };
+
+    template <>
+    struct JointTransform<ModelOrientation::YUp, AxisFlag::Height, AxisFlag::Width> {
+        static constexpr Vector3 length_direction{1.0, 0.0, 0.0};
+        static constexpr Vector3 width_direction{0.0, 0.0, 1.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {l, h, w}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {0, po + pd/2, jo + jd/2}; }
+    };
+
+    template <>
+    struct JointTransform<ModelOrientation::ZUp, AxisFlag::Length, AxisFlag::Width> {
+        static constexpr Vector3 length_direction{0.0, 0.0, 1.0};
+        static constexpr Vector3 width_direction{0.0, 1.0, 0.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {h, w, l}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {po + pd/2, jo + jd/2, 0}; }
+    };
+
+    template <>
+    struct JointTransform<ModelOrientation::ZUp, AxisFlag::Length, AxisFlag::Height> {
+        static constexpr Vector3 length_direction{0.0, 1.0, 0.0};
+        static constexpr Vector3 width_direction{0.0, 0.0, 1.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {w, l, h}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {po + pd/2, 0, jo + jd/2}; }
+    };
+
+    template <>
+    struct JointTransform<ModelOrientation::ZUp, AxisFlag::Width, AxisFlag::Length> {
+        static constexpr Vector3 length_direction{0.0, 0.0, 1.0};
+        static constexpr Vector3 width_direction{1.0, 0.0, 0.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {w, h, l}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {jo + jd/2, po + pd/2, 0}; }
+    };
+
+    template <>
+    struct JointTransform<ModelOrientation::ZUp, AxisFlag::Width, AxisFlag::Height> {
+        static constexpr Vector3 length_direction{1.0, 0.0, 0.0};
+        static constexpr Vector3 width_direction{0.0, 0.0, 1.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {l, h, w}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {0, po + pd/2, jo + jd/2}; }
+    };
+
+    template <>
+    struct JointTransform<ModelOrientation::ZUp, AxisFlag::Height, AxisFlag::Length> {
+        static constexpr Vector3 length_direction{0.0, 1.0, 0.0};
+        static constexpr Vector3 width_direction{1.0, 0.0, 0.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {h, l, w}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {jo + jd/2, 0, po + pd/2}; }
+    };
+
+    template <>
+    struct JointTransform<ModelOrientation::ZUp, AxisFlag::Height, AxisFlag::Width> {
+        static constexpr Vector3 length_direction{1.0, 0.0, 0.0};
+        static constexpr Vector3 width_direction{0.0, 1.0, 0.0};
+
+        static constexpr auto transform(double l, double w, double h) -> Vector3 { return {l, w, h}; }
+        static constexpr auto center(double po, double pd, double jo, double jd) -> Vector3 { return {0, jo + jd/2, po + pd/2}; }
+    };
+
+    template <ModelOrientation O, typename F>
+    auto dispatchPanelAxis(AxisFlag axis, F&& render) -> bool {
+        switch (axis) {
+            case AxisFlag::Length: render(PanelTransform<O, AxisFlag::Length>{}); return true;
+            case AxisFlag::Width: render(PanelTransform<O, AxisFlag::Width>{}); return true;
+            case AxisFlag::Height: render(PanelTransform<O, AxisFlag::Height>{}); return true;
+        }
+        return false;
+    }
+
+    // Calls render with the PanelTransform for the model orientation and panel
+    // axis, so everything rendered for the panel group is resolved at compile
+    // time. Returns false for an orientation that isn't Y-up or Z-up.
+    template <typename F>
+    auto dispatchPanelTransform(ModelOrientation orientation, AxisFlag axis, F&& render) -> bool {
+        switch (orientation) {
+            case ModelOrientation::YUp: return dispatchPanelAxis<ModelOrientation::YUp>(axis, render);
+            case ModelOrientation::ZUp: return dispatchPanelAxis<ModelOrientation::ZUp>(axis, render);
+            default: return false;
+        }
+    }
+
+    // Calls render with the JointTransform for a joint along joint_axis in a
+    // panel placed by P. Returns false when the joint runs along the panel's
+    // own axis, which no joint does.
+    template <typename P, typename F>
+    auto dispatchJointTransform(AxisFlag joint_axis, F&& render) -> bool {
+        switch (joint_axis) {
+            case AxisFlag::Length:
+                if constexpr (P::axis != AxisFlag::Length) {
+                    render(JointTransform<P::orientation, P::axis, AxisFlag::Length>{});
+                    return true;
+                }
+                break;
+            case AxisFlag::Width:
+                if constexpr (P::axis != AxisFlag::Width) {
+                    render(JointTransform<P::orientation, P::axis, AxisFlag::Width>{});
+                    return true;
+                }
+                break;
+            case AxisFlag::Height:
+                if constexpr (P::axis != AxisFlag::Height) {
+                    render(JointTransform<P::orientation, P::axis, AxisFlag::Height>{});
+                    return true;
+                }
+                break;
+        }
+        return false;
+    }
+
+}
+
+#endif //SILVANUSPRO_RENDERTRANSFORMS_HPP
@@ -8,61 +8,82 @@
 #include "entities/JointDirection.hpp"
 #include "entities/JointExtrusion.hpp"
 #include "entities/JointProfile.hpp"
+#include "entities/ModelOrientation.hpp"
 #include "entities/PanelExtrusion.hpp"
-#include "fusion/PanelFingerSketch.hpp"
+#include "entities/PanelProfile.hpp"
+#include "entities/Position.hpp"
+#include "entities/Quantize.hpp"
 
+#include <entt/entt.hpp>
+
+#include <functional>
 #include <map>
-#include <set>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace silvanus::generatebox::render {
 
+    // Orders extrusions by their quantized distance and offset, so extrusions
+    // that only differ by floating point noise are one set entry.
     struct CompareExtrusion {
+        template <class Extrusion>
+        static auto key(const Extrusion& extrusion) -> std::pair<entities::FixedLength, entities::FixedLength> {
+            return {entities::quantize(extrusion.distance.value), entities::quantize(extrusion.offset.value)};
+        }
+
         bool operator()(const entities::PanelExtrusion &lhs, const entities::PanelExtrusion &rhs) const {
-            return (lhs.distance.value < rhs.distance.value) || (
-                       (rhs.distance.value >= lhs.distance.value) && (lhs.offset.value < rhs.offset.value)
-                   );
+            return key(lhs) < key(rhs);
         }
 
         bool operator()(const entities::JointExtrusion &lhs, const entities::JointExtrusion &rhs) const {
-            return (lhs.distance.value < rhs.distance.value) || (
-                       (rhs.distance.value >= lhs.distance.value) && (lhs.offset.value < rhs.offset.value)
-                   );
+            return key(lhs) < key(rhs);
         }
     };
 
+    // The joints one joint profile cuts into a panel. Both vectors are sorted
+    // and hold each name and extrusion once.
     struct JointRenderGroup {
-        std::set<std::string>                                names;
-        std::set<entities::JointExtrusion, CompareExtrusion> extrusions;
+        std::vector<entities::NameId>         names;
+        std::vector<entities::JointExtrusion> extrusions;
     };
 
-    using profileRenderGroupMap = std::map<entities::JointProfile, JointRenderGroup, entities::CompareJointProfile>;
-    using renderJointTypeMap = std::map<entities::AxisFlag, profileRenderGroupMap>;
-    using jointDirectionTypeMap = std::map<entities::JointDirectionType, renderJointTypeMap>;
-    using jointPatternTypeMap = std::map<entities::JointPatternType, jointDirectionTypeMap>;
-    using panelExtrusionSet = std::set<entities::PanelExtrusion, CompareExtrusion>;
-    using distanceExtrusionMap = std::map<entities::ExtrusionDistance, panelExtrusionSet, entities::CompareExtrusionDistance>;
+    // A joint profile of a panel group with the keys it is rendered in the
+    // order of: pattern type, direction, the face it is cut into and profile.
+    struct JointRenderEntry {
+        entities::JointPatternType   joint_type;
+        entities::JointDirectionType joint_direction;
+        entities::AxisFlag           joint_orientation;
+        entities::JointProfile       profile;
+        JointRenderGroup             group;
+    };
+
+    using jointRenderEntries = std::vector<JointRenderEntry>;
 
+    // Everything one panel group renders, in flat sorted vectors built by
+    // PanelRenderDataBuilder. names holds each panel name once, panels each
+    // extrusion once ordered by CompareExtrusion, so the panels extruded with
+    // one distance are a contiguous run, and joints is ordered by its keys.
     struct PanelRenderData {
-        std::set<std::string> names;
-        distanceExtrusionMap  panels;
-        jointPatternTypeMap   joints;
-        entt::entity          parent = entt::null;
+        std::vector<entities::NameId>         names;
+        std::vector<entities::PanelExtrusion> panels;
+        jointRenderEntries                    joints;
+        entt::entity                          parent = entt::null;
     };
 
-    struct CutProfile {
-        fusion::PanelFingerSketch sketch;
-        JointRenderGroup          group;
-        entities::JointProfile    profile;
-        bool                      corner = false;
+    // One run of entities sharing a key from sortPanelGroups.
+    struct PanelRenderGroup {
+        entities::AxisFlag     axis;
+        entities::PanelProfile profile;
+        entities::Position     position;
+        PanelRenderData        data;
     };
 
-    using axis_plane_map = std::map<entities::AxisFlag, adsk::core::Ptr<adsk::fusion::ConstructionPlane>>;
-    using orientation_plane_map = std::unordered_map<adsk::core::DefaultModelingOrientations, axis_plane_map>;
+    using panelRenderGroups = std::vector<PanelRenderGroup>;
+
     using axis_transform_map = std::map<entities::AxisFlag, std::function<std::tuple<double, double, double>(double, double, double)>>;
-    using orientation_transform_map = std::unordered_map<adsk::core::DefaultModelingOrientations, axis_transform_map>;
-    using axisFaceSelector = std::map<entities::AxisFlag, std::function<adsk::core::Ptr<adsk::fusion::BRepFace>(adsk::core::Ptr<adsk::fusion::BRepBody>)>>;
-    using orientationAxisSelector = std::map<adsk::core::DefaultModelingOrientations, axisFaceSelector>;
+    using orientation_transform_map = std::unordered_map<entities::ModelOrientation, axis_transform_map>;
 
 }
 
@@ -0,0 +1,47 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_SKETCHSUPPORT_HPP
+#define SILVANUSPRO_SKETCHSUPPORT_HPP
+
+#include "rendersupport.hpp"
+
+#include "entities/AxisFlag.hpp"
+#include "entities/JointProfile.hpp"
+#include "entities/ModelOrientation.hpp"
+#include "fusion/PanelFingerSketch.hpp"
+
+#include <Core/CoreAll.h>
+#include <Fusion/FusionAll.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// The parts of rendersupport.hpp that hold Fusion sketches, planes and faces,
+// which only the renderers that build the box from sketches need.
+namespace silvanus::generatebox::render {
+
+    struct CutProfile {
+        std::shared_ptr<fusion::PanelFingerSketch> sketch;
+        JointRenderGroup                           group;
+        entities::JointProfile                     profile;
+        bool                                       corner = false;
+        size_t                                     finger = 0;
+    };
+
+    // Finger sketches of a panel by the face they are drawn on.
+    using faceSketchMap = std::map<entities::AxisFlag, std::vector<std::shared_ptr<fusion::PanelFingerSketch>>>;
+
+    using axis_plane_map = std::map<entities::AxisFlag, adsk::core::Ptr<adsk::fusion::ConstructionPlane>>;
+    using orientation_plane_map = std::unordered_map<entities::ModelOrientation, axis_plane_map>;
+    using axisFaceSelector = std::map<entities::AxisFlag, std::function<adsk::core::Ptr<adsk::fusion::BRepFace>(adsk::core::Ptr<adsk::fusion::BRepBody>)>>;
+    using orientationAxisSelector = std::map<entities::ModelOrientation, axisFaceSelector>;
+
+}
+
+#endif //SILVANUSPRO_SKETCHSUPPORT_HPP
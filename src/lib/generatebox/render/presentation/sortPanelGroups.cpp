@@ -0,0 +1,81 @@
+//
+// Created by Hobbyist Maker on 10/3/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "sortPanelGroups.hpp"
+
+#include "entities/JointGroup.hpp"
+#include "entities/PanelGroup.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::render;
+
+namespace {
+
+    // Profiles and joint tags are too wide to put in a key directly, so each
+    // distinct one is replaced by its rank. 24 bits leaves room for far more
+    // panels than a box will ever have.
+    constexpr auto rank_bits = 24;
+    constexpr auto rank_mask = (uint64_t{1} << rank_bits) - 1;
+
+    // Numbers the distinct values from 0 in ascending order; values that
+    // compare equal share a rank.
+    template<typename Less>
+    auto rankBy(size_t count, Less less) -> std::vector<uint64_t> {
+        auto order = std::vector<size_t>(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), less);
+
+        auto ranks = std::vector<uint64_t>(count);
+        auto rank  = uint64_t{0};
+        for (size_t i = 1; i < count; ++i) {
+            if (less(order[i - 1], order[i])) ++rank;
+            ranks[order[i]] = rank;
+        }
+
+        return ranks;
+    }
+
+}
+
+auto silvanus::generatebox::render::sortPanelGroups(
+    entt::registry& registry, const std::vector<entt::entity>& entities
+) -> std::vector<PanelGroupEntry> {
+    auto panels = std::vector<const PanelGroup*>{};
+    auto joints = std::vector<const JointGroup*>{};
+    panels.reserve(entities.size());
+    joints.reserve(entities.size());
+
+    for (auto const entity: entities) {
+        panels.push_back(&registry.get<PanelGroup>(entity));
+        joints.push_back(&registry.get<JointGroup>(entity));
+    }
+
+    auto const profiles = rankBy(entities.size(), [&panels](size_t lhs, size_t rhs) {
+        return panels[lhs]->profile.fingerprint() < panels[rhs]->profile.fingerprint();
+    });
+    auto const tags = rankBy(entities.size(), [&joints](size_t lhs, size_t rhs) {
+        return joints[lhs]->tag.value < joints[rhs]->tag.value;
+    });
+
+    auto sorted = std::vector<PanelGroupEntry>{};
+    sorted.reserve(entities.size());
+
+    for (size_t i = 0; i < entities.size(); ++i) {
+        auto const key = static_cast<uint64_t>(panels[i]->orientation) << 56
+                       | static_cast<uint64_t>(panels[i]->position) << 48
+                       | (profiles[i] & rank_mask) << rank_bits
+                       | (tags[i] & rank_mask);
+        sorted.push_back({key, entities[i]});
+    }
+
+    std::stable_sort(sorted.begin(), sorted.end(), [](const PanelGroupEntry& lhs, const PanelGroupEntry& rhs) {
+        return lhs.key < rhs.key;
+    });
+
+    return sorted;
+}
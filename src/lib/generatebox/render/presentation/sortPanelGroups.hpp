@@ -0,0 +1,32 @@
+//
+// Created by Hobbyist Maker on 10/3/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_SORTPANELGROUPS_HPP
+#define SILVANUSPRO_SORTPANELGROUPS_HPP
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace silvanus::generatebox::render {
+
+    // A panel/joint entity and the render group it belongs to. Entities that
+    // share a key are rendered together.
+    struct PanelGroupEntry {
+        uint64_t     key;
+        entt::entity entity;
+    };
+
+    // Keys each entity by its panel axis, profile, position and joint tag, in
+    // that order of significance, and sorts them so every group is a contiguous
+    // run in the same order the renderers have always visited them. Entities
+    // keep their relative order within a run. The entities need PanelGroup and
+    // JointGroup.
+    auto sortPanelGroups(entt::registry& registry, const std::vector<entt::entity>& entities) -> std::vector<PanelGroupEntry>;
+
+}
+
+#endif //SILVANUSPRO_SORTPANELGROUPS_HPP
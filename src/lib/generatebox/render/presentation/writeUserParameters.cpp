@@ -0,0 +1,29 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "writeUserParameters.hpp"
+
+#include "entities/Parameter.hpp"
+
+#include <plog/Log.h>
+
+using namespace silvanus::generatebox::entities;
+
+auto silvanus::generatebox::render::writeUserParameters(entt::registry& registry, fusion::FusionBackend& backend) -> std::size_t {
+    auto written = std::size_t{0};
+    auto skipped = std::size_t{0};
+
+    auto param_init_view = registry.view<FloatParameter>();
+    for (auto &&[entity, parameter]: param_init_view.proxy()) {
+        if (backend.setUserParameter(parameter.name, parameter.expression, parameter.unit_type)) {
+            ++written;
+        } else {
+            ++skipped;
+        }
+    }
+
+    PLOG_INFO << "Wrote " << written << " user parameters, skipped " << skipped << " unchanged";
+    return written;
+}
@@ -0,0 +1,24 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_WRITEUSERPARAMETERS_HPP
+#define SILVANUSPRO_WRITEUSERPARAMETERS_HPP
+
+#include "fusion/FusionBackend.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstddef>
+
+namespace silvanus::generatebox::render {
+
+    // Writes every FloatParameter of the registry as a user parameter of the
+    // design, leaving the ones whose expression and units did not change
+    // alone. Returns how many were written.
+    auto writeUserParameters(entt::registry& registry, fusion::FusionBackend& backend) -> std::size_t;
+
+}
+
+#endif //SILVANUSPRO_WRITEUSERPARAMETERS_HPP
@@ -0,0 +1,334 @@
+//
+// Created by Hobbyist Maker on 9/27/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#include "RegistrySnapshot.hpp"
+
+#include "entities/Enabled.hpp"
+#include "entities/JointEnabled.hpp"
+#include "entities/JointExtrusion.hpp"
+#include "entities/JointGroup.hpp"
+#include "entities/JointOrientation.hpp"
+#include "entities/Kerf.hpp"
+#include "entities/Panel.hpp"
+#include "entities/PanelExtrusion.hpp"
+#include "entities/PanelGroup.hpp"
+#include "entities/ParentPanel.hpp"
+#include "render/geometry/appendJointCuts.hpp"
+
+#include <plog/Log.h>
+
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+
+#if defined _WIN32 || defined _WIN64
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::snapshot;
+
+namespace {
+
+    class StringTable {
+            std::unordered_map<std::string, std::uint32_t> m_index;
+            std::vector<SnapshotString> m_strings;
+            std::string m_text;
+
+        public:
+            StringTable() {
+                intern("");
+            };
+
+            auto intern(const std::string& value) -> std::uint32_t {
+                auto const [found, inserted] = m_index.emplace(value, static_cast<std::uint32_t>(m_strings.size()));
+                if (!inserted) return found->second;
+
+                m_strings.push_back({m_text.size(), value.size()});
+                m_text.append(value);
+                m_text.push_back('\0');
+                return found->second;
+            };
+
+            [[nodiscard]] auto strings() const -> const std::vector<SnapshotString>& { return m_strings; };
+            [[nodiscard]] auto text() const -> const std::string& { return m_text; };
+    };
+
+    auto aligned(size_t size) -> size_t {
+        return (size + 7) & ~size_t{7};
+    }
+
+    void pad(std::ostream& stream, size_t size) {
+        static char const zeros[8] = {};
+        stream.write(zeros, static_cast<std::streamsize>(aligned(size) - size));
+    }
+
+    template<class T>
+    void writeTable(std::ostream& stream, const std::vector<T>& table) {
+        auto const size = table.size() * sizeof(T);
+        stream.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(size));
+        pad(stream, size);
+    }
+
+    template<class T>
+    auto section(const char* base, size_t size, std::uint64_t offset, std::uint64_t count) -> const T* {
+        if (offset % alignof(T) != 0 || offset > size || count > (size - offset) / sizeof(T)) {
+            throw std::runtime_error("snapshot section out of bounds");
+        }
+        return reinterpret_cast<const T*>(base + offset);
+    }
+
+}
+
+auto silvanus::generatebox::snapshot::writeSnapshot(entt::registry& registry, std::ostream& stream) -> size_t {
+    auto strings = StringTable{};
+    auto panels  = std::vector<SnapshotPanel>{};
+    auto joints  = std::vector<SnapshotJoint>{};
+    auto index   = std::map<entt::entity, std::uint32_t>{};
+
+    auto const& names = nameTable(registry);
+
+    auto panel_view = registry.view<const Enabled, const Panel, const PanelGroup, const PanelExtrusion, const ParentPanel>().proxy();
+    for (auto &&[entity, enabled, panel, panel_group, extrusion, parent]: panel_view) {
+        if (!enabled.value || index.count(parent.id)) continue;
+
+        index[parent.id] = static_cast<std::uint32_t>(panels.size());
+
+        auto& record          = panels.emplace_back();
+        record.name           = strings.intern(panel.name);
+        record.orientation    = static_cast<std::uint8_t>(panel_group.orientation);
+        record.position       = static_cast<std::uint8_t>(panel_group.position);
+        record.length         = panel_group.profile.length.value;
+        record.width          = panel_group.profile.width.value;
+        record.thickness      = extrusion.distance.value;
+        record.offset         = extrusion.offset.value;
+        record.length_expr    = strings.intern(panel_group.profile.length.expression);
+        record.width_expr     = strings.intern(panel_group.profile.width.expression);
+        record.thickness_expr = strings.intern(extrusion.distance.expression);
+        record.offset_expr    = strings.intern(extrusion.offset.expression);
+        record.extrusion_name = strings.intern(names.name(extrusion.name));
+
+        if (auto const kerf = registry.try_get<Kerf>(entity)) {
+            record.kerf = kerf->value;
+        }
+    }
+
+    auto joint_view = registry.view<const Enabled, const JointEnabled, const ParentPanel, const JointGroup, const JointOrientation, const JointExtrusion>().proxy();
+    for (auto &&[entity, enabled, joint_enabled, parent, joint_group, joint_orientation, joint]: joint_view) {
+        if (!enabled.value || !joint_enabled.value) continue;
+
+        auto const position = index.find(parent.id);
+        if (position == index.end()) continue;
+
+        auto const& profile = joint_group.profile;
+        auto const& params  = jointProfileParams(registry, profile);
+
+        auto& record                 = joints.emplace_back();
+        record.panel                 = position->second;
+        record.name                  = strings.intern(names.name(joint.name));
+        record.orientation           = static_cast<std::uint8_t>(joint_orientation.axis);
+        record.panel_position        = static_cast<std::uint8_t>(profile.panel_position);
+        record.joint_position        = static_cast<std::uint8_t>(profile.joint_position);
+        record.joint_direction       = static_cast<std::uint8_t>(profile.joint_direction);
+        record.joint_type            = static_cast<std::uint8_t>(profile.joint_type);
+        record.finger_type           = static_cast<std::uint8_t>(profile.finger_type);
+        record.finger_count          = profile.finger_count;
+        record.finger_width          = profile.finger_width;
+        record.pattern_distance      = profile.pattern_distance;
+        record.pattern_offset        = profile.pattern_offset;
+        record.finger_offset         = profile.finger_offset;
+        record.corner_width          = profile.corner_width;
+        record.corner_distance       = profile.corner_distance;
+        record.offset                = joint.offset.value;
+        record.distance              = joint.distance.value;
+        record.finger_count_expr     = strings.intern(params.finger_count);
+        record.finger_width_expr     = strings.intern(params.finger_width);
+        record.pattern_distance_expr = strings.intern(params.pattern_distance);
+        record.pattern_offset_expr   = strings.intern(params.pattern_offset);
+        record.finger_offset_expr    = strings.intern(params.finger_offset);
+        record.corner_width_expr     = strings.intern(params.corner_width);
+        record.corner_distance_expr  = strings.intern(params.corner_distance);
+        record.offset_expr           = strings.intern(joint.offset.expression);
+        record.distance_expr         = strings.intern(joint.distance.expression);
+    }
+
+    auto header = SnapshotHeader{};
+    header.panel_offset  = sizeof(SnapshotHeader);
+    header.panel_count   = panels.size();
+    header.joint_offset  = header.panel_offset + aligned(panels.size() * sizeof(SnapshotPanel));
+    header.joint_count   = joints.size();
+    header.string_offset = header.joint_offset + aligned(joints.size() * sizeof(SnapshotJoint));
+    header.string_count  = strings.strings().size();
+    header.text_offset   = header.string_offset + aligned(strings.strings().size() * sizeof(SnapshotString));
+    header.text_size     = strings.text().size();
+    header.file_size     = header.text_offset + aligned(strings.text().size());
+
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeTable(stream, panels);
+    writeTable(stream, joints);
+    writeTable(stream, strings.strings());
+    stream.write(strings.text().data(), static_cast<std::streamsize>(strings.text().size()));
+    pad(stream, strings.text().size());
+
+    PLOG_DEBUG << "Wrote " << header.file_size << " byte snapshot of " << panels.size() << " panels and " << joints.size() << " joints";
+
+    return panels.size();
+}
+
+SnapshotView::SnapshotView(const void* data, size_t size) {
+    auto const base = static_cast<const char*>(data);
+
+    if (base == nullptr || size < sizeof(SnapshotHeader) || reinterpret_cast<std::uintptr_t>(base) % alignof(SnapshotHeader) != 0) {
+        throw std::runtime_error("snapshot is too small or misaligned");
+    }
+
+    m_header = reinterpret_cast<const SnapshotHeader*>(base);
+
+    if (std::memcmp(m_header->magic, SnapshotHeader{}.magic, sizeof(m_header->magic)) != 0) {
+        throw std::runtime_error("not a snapshot");
+    }
+    if (m_header->byte_order != snapshot_byte_order) {
+        throw std::runtime_error("snapshot was written with a different byte order");
+    }
+    if (m_header->version != snapshot_version) {
+        throw std::runtime_error("unsupported snapshot version " + std::to_string(m_header->version));
+    }
+    if (m_header->file_size > size) {
+        throw std::runtime_error("snapshot is truncated");
+    }
+
+    m_panels  = section<SnapshotPanel>(base, size, m_header->panel_offset, m_header->panel_count);
+    m_joints  = section<SnapshotJoint>(base, size, m_header->joint_offset, m_header->joint_count);
+    m_strings = section<SnapshotString>(base, size, m_header->string_offset, m_header->string_count);
+    m_text    = section<char>(base, size, m_header->text_offset, m_header->text_size);
+
+    if (m_header->string_count == 0) {
+        throw std::runtime_error("snapshot has no string table");
+    }
+
+    // Orientations index the box axes when the panels are placed, so they are
+    // checked once here rather than by every reader.
+    auto constexpr max_orientation = static_cast<std::uint8_t>(AxisFlag::Height);
+
+    for (size_t i = 0; i < m_header->panel_count; ++i) {
+        if (m_panels[i].orientation > max_orientation) {
+            throw std::runtime_error("snapshot panel " + std::to_string(i) + " has an invalid orientation");
+        }
+    }
+
+    for (size_t i = 0; i < m_header->joint_count; ++i) {
+        if (m_joints[i].orientation > max_orientation) {
+            throw std::runtime_error("snapshot joint " + std::to_string(i) + " has an invalid orientation");
+        }
+        if (m_joints[i].finger_count < 0) {
+            throw std::runtime_error("snapshot joint " + std::to_string(i) + " has a negative finger count");
+        }
+    }
+}
+
+auto SnapshotView::string(std::uint32_t index) const -> std::string_view {
+    if (index >= m_header->string_count) return {};
+
+    auto const& entry = m_strings[index];
+    if (entry.offset > m_header->text_size || entry.length > m_header->text_size - entry.offset) return {};
+
+    return {m_text + entry.offset, static_cast<size_t>(entry.length)};
+}
+
+#if defined _WIN32 || defined _WIN64
+
+SnapshotFile::SnapshotFile(const std::string& filename) {
+    auto const file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) throw std::runtime_error("could not open " + filename);
+
+    auto size = LARGE_INTEGER{};
+    GetFileSizeEx(file, &size);
+    m_size = static_cast<size_t>(size.QuadPart);
+
+    m_handle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (m_handle == nullptr) throw std::runtime_error("could not map " + filename);
+
+    m_data = MapViewOfFile(m_handle, FILE_MAP_READ, 0, 0, 0);
+    if (m_data == nullptr) {
+        CloseHandle(m_handle);
+        throw std::runtime_error("could not map " + filename);
+    }
+}
+
+SnapshotFile::~SnapshotFile() {
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_handle);
+}
+
+#else
+
+SnapshotFile::SnapshotFile(const std::string& filename) {
+    auto const file = open(filename.c_str(), O_RDONLY);
+    if (file < 0) throw std::runtime_error("could not open " + filename);
+
+    struct stat status{};
+    if (fstat(file, &status) != 0 || status.st_size == 0) {
+        close(file);
+        throw std::runtime_error("could not map " + filename);
+    }
+    m_size = static_cast<size_t>(status.st_size);
+
+    auto const data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (data == MAP_FAILED) throw std::runtime_error("could not map " + filename);
+
+    m_data = data;
+}
+
+SnapshotFile::~SnapshotFile() {
+    munmap(const_cast<void*>(m_data), m_size);
+}
+
+#endif
+
+auto silvanus::generatebox::snapshot::snapshotPanelGeometry(const SnapshotView& view) -> std::vector<PanelGeometry> {
+    auto panels = std::vector<PanelGeometry>{};
+    panels.reserve(view.panelCount());
+
+    for (size_t i = 0; i < view.panelCount(); ++i) {
+        auto const& record = view.panels()[i];
+
+        auto& geometry       = panels.emplace_back();
+        geometry.name        = std::string{view.string(record.name)};
+        geometry.orientation = static_cast<AxisFlag>(record.orientation);
+        geometry.length      = record.length;
+        geometry.width       = record.width;
+        geometry.thickness   = record.thickness;
+        geometry.offset      = record.offset;
+        geometry.kerf        = record.kerf;
+    }
+
+    for (size_t i = 0; i < view.jointCount(); ++i) {
+        auto const& joint = view.joints()[i];
+        if (joint.panel >= panels.size()) continue;
+
+        auto profile = JointProfile{};
+        profile.joint_type      = static_cast<JointPatternType>(joint.joint_type);
+        profile.finger_type     = static_cast<FingerPatternType>(joint.finger_type);
+        profile.finger_count    = joint.finger_count;
+        profile.finger_width    = joint.finger_width;
+        profile.pattern_offset  = joint.pattern_offset;
+        profile.finger_offset   = joint.finger_offset;
+        profile.corner_width    = joint.corner_width;
+        profile.corner_distance = joint.corner_distance;
+
+        appendJointCuts(panels[joint.panel], profile, static_cast<AxisFlag>(joint.orientation), joint.offset, joint.distance);
+    }
+
+    return panels;
+}
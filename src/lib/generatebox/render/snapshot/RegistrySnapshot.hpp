@@ -0,0 +1,152 @@
+//
+// Created by Hobbyist Maker on 9/27/20.
+// Copyright (c) 2020 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_REGISTRYSNAPSHOT_HPP
+#define SILVANUSPRO_REGISTRYSNAPSHOT_HPP
+
+#include "render/geometry/PanelGeometry.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace silvanus::generatebox::snapshot {
+
+    // On disk a snapshot is the header followed by three tables of fixed size
+    // records and the string data, every section 8 byte aligned. Records refer to
+    // strings by index into the string table and string 0 is always empty; the
+    // string data keeps a terminating zero after every string. Nothing needs to
+    // be parsed, so a mapped file can be read in place. Values are stored in the
+    // host byte order, which the header records.
+    constexpr std::uint32_t snapshot_version = 1;
+    constexpr std::uint32_t snapshot_byte_order = 0x01020304;
+
+    struct SnapshotHeader {
+        char          magic[8]      = {'S', 'I', 'L', 'V', 'S', 'N', 'A', 'P'};
+        std::uint32_t version       = snapshot_version;
+        std::uint32_t byte_order    = snapshot_byte_order;
+        std::uint64_t file_size     = 0;
+        std::uint64_t panel_offset  = 0;
+        std::uint64_t panel_count   = 0;
+        std::uint64_t joint_offset  = 0;
+        std::uint64_t joint_count   = 0;
+        std::uint64_t string_offset = 0;
+        std::uint64_t string_count  = 0;
+        std::uint64_t text_offset   = 0;
+        std::uint64_t text_size     = 0;
+    };
+
+    struct SnapshotString {
+        std::uint64_t offset = 0;
+        std::uint64_t length = 0;
+    };
+
+    struct SnapshotPanel {
+        std::uint32_t name           = 0;
+        std::uint8_t  orientation    = 0;
+        std::uint8_t  position       = 0;
+        std::uint16_t reserved       = 0;
+        double        length         = 0;
+        double        width          = 0;
+        double        thickness      = 0;
+        double        offset         = 0;
+        double        kerf           = 0;
+        std::uint32_t length_expr    = 0;
+        std::uint32_t width_expr     = 0;
+        std::uint32_t thickness_expr = 0;
+        std::uint32_t offset_expr    = 0;
+        std::uint32_t extrusion_name = 0;
+        std::uint32_t reserved_expr  = 0;
+    };
+
+    struct SnapshotJoint {
+        std::uint32_t panel                 = 0;
+        std::uint32_t name                  = 0;
+        std::uint8_t  orientation           = 0;
+        std::uint8_t  panel_position        = 0;
+        std::uint8_t  joint_position        = 0;
+        std::uint8_t  joint_direction       = 0;
+        std::uint8_t  joint_type            = 0;
+        std::uint8_t  finger_type           = 0;
+        std::uint16_t reserved              = 0;
+        std::int32_t  finger_count          = 0;
+        std::uint32_t finger_count_expr     = 0;
+        double        finger_width          = 0;
+        double        pattern_distance      = 0;
+        double        pattern_offset        = 0;
+        double        finger_offset         = 0;
+        double        corner_width          = 0;
+        double        corner_distance       = 0;
+        double        offset                = 0;
+        double        distance              = 0;
+        std::uint32_t finger_width_expr     = 0;
+        std::uint32_t pattern_distance_expr = 0;
+        std::uint32_t pattern_offset_expr   = 0;
+        std::uint32_t finger_offset_expr    = 0;
+        std::uint32_t corner_width_expr     = 0;
+        std::uint32_t corner_distance_expr  = 0;
+        std::uint32_t offset_expr           = 0;
+        std::uint32_t distance_expr         = 0;
+    };
+
+    static_assert(std::is_trivially_copyable_v<SnapshotHeader> && sizeof(SnapshotHeader) == 88);
+    static_assert(std::is_trivially_copyable_v<SnapshotString> && sizeof(SnapshotString) == 16);
+    static_assert(std::is_trivially_copyable_v<SnapshotPanel> && sizeof(SnapshotPanel) == 72);
+    static_assert(std::is_trivially_copyable_v<SnapshotJoint> && sizeof(SnapshotJoint) == 120);
+
+    // Captures every enabled panel and joint of a registry that has been through
+    // ConfigurePanels and ConfigureJoints. Returns the number of panels written.
+    auto writeSnapshot(entt::registry& registry, std::ostream& stream) -> size_t;
+
+    // Reads a snapshot in place. The constructor checks the header, that every
+    // section lies inside the buffer and that every orientation and finger count
+    // is in range, and throws std::runtime_error otherwise; the buffer must
+    // outlive the view.
+    class SnapshotView {
+            const SnapshotHeader* m_header  = nullptr;
+            const SnapshotPanel*  m_panels  = nullptr;
+            const SnapshotJoint*  m_joints  = nullptr;
+            const SnapshotString* m_strings = nullptr;
+            const char*           m_text    = nullptr;
+
+        public:
+            SnapshotView(const void* data, size_t size);
+
+            [[nodiscard]] auto panels() const -> const SnapshotPanel* { return m_panels; };
+            [[nodiscard]] auto panelCount() const -> size_t { return m_header->panel_count; };
+            [[nodiscard]] auto joints() const -> const SnapshotJoint* { return m_joints; };
+            [[nodiscard]] auto jointCount() const -> size_t { return m_header->joint_count; };
+
+            [[nodiscard]] auto string(std::uint32_t index) const -> std::string_view;
+    };
+
+    // A read only memory mapping of a snapshot file.
+    class SnapshotFile {
+            const void* m_data   = nullptr;
+            size_t      m_size   = 0;
+            void*       m_handle = nullptr;
+
+        public:
+            explicit SnapshotFile(const std::string& filename);
+            ~SnapshotFile();
+
+            SnapshotFile(const SnapshotFile&) = delete;
+            SnapshotFile& operator=(const SnapshotFile&) = delete;
+
+            [[nodiscard]] auto view() const -> SnapshotView { return SnapshotView(m_data, m_size); };
+    };
+
+    // The same panels collectPanelGeometry returns for the registry the snapshot
+    // was taken from, ready for the flat pack, nesting and G-code exporters.
+    auto snapshotPanelGeometry(const SnapshotView& view) -> std::vector<geometry::PanelGeometry>;
+
+}
+
+#endif //SILVANUSPRO_REGISTRYSNAPSHOT_HPP
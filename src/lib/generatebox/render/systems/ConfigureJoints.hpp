@@ -14,9 +14,6 @@
 
 #include "render/systems/joints/render_joint_systems.hpp"
 
-#include <Core/CoreAll.h>
-#include <Fusion/FusionAll.h>
-
 #include <entt/entt.hpp>
 #include <unordered_map>
 
@@ -24,14 +21,10 @@ namespace silvanus::generatebox::systems {
 
     class ConfigureJoints
     {
-            adsk::core::Ptr<adsk::core::Application> m_app;
             entt::registry &m_registry;
 
         public:
-            ConfigureJoints(
-                const adsk::core::Ptr<adsk::core::Application>& app,
-                entt::registry &registry
-            ) : m_app{app}, m_registry{registry} {};
+            explicit ConfigureJoints(entt::registry &registry) : m_registry{registry} {};
 
             void execute() {
                 updateJointPatternDistances(m_registry);
@@ -8,9 +8,6 @@
 #ifndef SILVANUSPRO_CONFIGUREPANELS_HPP
 #define SILVANUSPRO_CONFIGUREPANELS_HPP
 
-#include <Core/CoreAll.h>
-#include <Fusion/FusionAll.h>
-
 #include <entt/entt.hpp>
 
 #include "entities/AxisFlag.hpp"
@@ -25,14 +22,10 @@ namespace silvanus::generatebox::systems
 {
     class ConfigurePanels
     {
-            adsk::core::Ptr<adsk::core::Application> m_app;
             entt::registry &m_registry;
 
         public:
-            ConfigurePanels(
-                adsk::core::Ptr<adsk::core::Application> app,
-                entt::registry &registry
-            ) : m_app{app}, m_registry{registry} {};
+            explicit ConfigurePanels(entt::registry &registry) : m_registry{registry} {};
 
             void execute() {
                 initializeJointEnabledFromInput(m_registry);
@@ -7,75 +7,117 @@
 
 #include "SilvanusCore.hpp"
 
+#include "fusion/FusionApiBackend.hpp"
+
 #include "lib/generatebox/render/presentation/DirectRenderer.hpp"
+#include "lib/generatebox/render/presentation/OutlineRenderer.hpp"
 #include "lib/generatebox/render/presentation/ParametricRenderer.hpp"
+#include "lib/generatebox/render/presentation/PreviewRenderer.hpp"
+#include "render/flatpack/DxfWriter.hpp"
+#include "render/flatpack/SvgWriter.hpp"
+#include "render/flatpack/exportFlatPack.hpp"
+#include "render/gcode/exportGCode.hpp"
+#include "render/snapshot/RegistrySnapshot.hpp"
 #include "systems/ConfigureJoints.hpp"
 #include "systems/ConfigurePanels.hpp"
 #include "entities/ProgressDialogControl.hpp"
 
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <fstream>
+
 using namespace adsk::core;
 using namespace adsk::fusion;
 
 using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::flatpack;
+using namespace silvanus::generatebox::gcode;
+using namespace silvanus::generatebox::snapshot;
 using namespace silvanus::generatebox::render;
 using namespace silvanus::generatebox::systems;
 
-void SilvanusCore::execute(DefaultModelingOrientations orientation, const Ptr<Component>& component, bool is_parametric)
+void SilvanusCore::execute(ModelOrientation orientation, const Ptr<Component>& component, RenderMode mode, bool update_existing, const std::string& box)
 {
     auto const& product = m_app->activeProduct();
     auto const& design = Ptr<Design>{product};
 
-    auto panel_configurator = ConfigurePanels(m_app, m_registry);
-    auto joint_configurator = ConfigureJoints(m_app, m_registry);
+    auto panel_configurator = ConfigurePanels(m_registry);
+    auto joint_configurator = ConfigureJoints(m_registry);
 
     panel_configurator.execute();
     joint_configurator.execute();
 
-    design->designType(is_parametric ? ParametricDesignType : DirectDesignType);
-    if (is_parametric) {
-        auto renderer = ParametricRenderer(m_app, m_registry);
-        renderer.execute(orientation, component);
+    design->designType(mode == RenderMode::Direct ? DirectDesignType : ParametricDesignType);
+
+    auto backend = fusion::FusionApiBackend(m_app);
+    if (mode == RenderMode::Parametric || mode == RenderMode::Instanced) {
+        auto renderer = ParametricRenderer(m_app, backend, m_registry, component, mode == RenderMode::Instanced, update_existing, box);
+        renderer.execute(orientation);
+    } else if (mode == RenderMode::Outline) {
+        auto renderer = OutlineRenderer(backend, m_registry, component);
+        renderer.execute(orientation);
     } else {
-        auto renderer = DirectRenderer(m_app, m_registry);
-        renderer.execute(orientation, component);
+        auto renderer = DirectRenderer(backend, m_registry);
+        renderer.execute(orientation);
     }
 }
 
-void SilvanusCore::fast_preview(DefaultModelingOrientations orientation, const Ptr<Component> &component)
+void SilvanusCore::fast_preview(ModelOrientation orientation, const Ptr<Component> &component)
+{
+    auto renderer = PreviewRenderer(m_app, m_registry, component);
+    renderer.execute(orientation);
+}
+
+void SilvanusCore::full_preview(ModelOrientation orientation, const Ptr<Component> &component)
 {
     auto const& product = m_app->activeProduct();
     auto const& design = Ptr<Design>{product};
 
-    design->designType(DirectDesignType);
+    design->designType(ParametricDesignType);
 
     configurePanels();
     configureJoints();
 
-    auto renderer = DirectRenderer(m_app, m_registry);
-    renderer.execute(orientation, component);
+    auto backend  = fusion::FusionApiBackend(m_app);
+    auto renderer = ParametricRenderer(m_app, backend, m_registry, component);
+    renderer.execute(orientation);
 }
 
-void SilvanusCore::full_preview(DefaultModelingOrientations orientation, const Ptr<Component> &component)
+auto SilvanusCore::flat_pack(const std::string& filename) -> size_t
 {
-    auto const& product = m_app->activeProduct();
-    auto const& design = Ptr<Design>{product};
-
-    design->designType(ParametricDesignType);
-
     configurePanels();
     configureJoints();
 
-    auto renderer = ParametricRenderer(m_app, m_registry);
-    renderer.execute(orientation, component);
+    if (boost::algorithm::iends_with(filename, ".silvanus")) {
+        auto stream = std::ofstream{filename, std::ios::out | std::ios::trunc | std::ios::binary};
+        if (!stream) return 0;
+
+        return writeSnapshot(m_registry, stream);
+    }
+
+    auto stream = std::ofstream{filename, std::ios::out | std::ios::trunc};
+    if (!stream) return 0;
+
+    if (boost::algorithm::iends_with(filename, ".gcode") || boost::algorithm::iends_with(filename, ".nc")) {
+        return exportGCode(m_registry, stream);
+    }
+
+    if (boost::algorithm::iends_with(filename, ".dxf")) {
+        auto writer = DxfWriter(stream);
+        return exportFlatPack(m_registry, writer);
+    }
+
+    auto writer = SvgWriter(stream);
+    return exportFlatPack(m_registry, writer);
 }
 
 void SilvanusCore::configureJoints() const {
-    auto joint_configurator = ConfigureJoints(m_app, m_registry);
+    auto joint_configurator = ConfigureJoints(m_registry);
     joint_configurator.execute();
 }
 
 void SilvanusCore::configurePanels() const {
-    auto panel_configurator = ConfigurePanels(m_app, m_registry);
+    auto panel_configurator = ConfigurePanels(m_registry);
     panel_configurator.execute();
 }
 
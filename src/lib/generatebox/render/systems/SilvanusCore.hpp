@@ -12,10 +12,19 @@
 #include <Fusion/Components/Component.h>
 
 #include <entt/entt.hpp>
+#include <string>
 #include "ConfigureJoints.hpp"
+#include "entities/ModelOrientation.hpp"
 
 namespace silvanus::generatebox::systems {
 
+    // How execute builds the box. Instanced and Outline are parametric too;
+    // Instanced places identical panels as occurrences of one component and
+    // Outline draws each panel as a single sketch and extrusion.
+    enum class RenderMode {
+        Parametric, Instanced, Outline, Direct
+    };
+
     class SilvanusCore
     {
 
@@ -26,19 +35,27 @@ namespace silvanus::generatebox::systems {
             SilvanusCore(const adsk::core::Ptr<adsk::core::Application>& app, entt::registry& registry)
                 : m_app{app}, m_registry{registry} {};
 
+            // update_existing only applies to the Parametric and Instanced modes,
+            // which then replace only the panel groups of the named box that
+            // changed since it was last rendered into the design.
             void execute(
-                    adsk::core::DefaultModelingOrientations orientation,
+                    entities::ModelOrientation orientation,
                     const adsk::core::Ptr<adsk::fusion::Component>& component,
-                    bool is_parametric
+                    RenderMode mode,
+                    bool update_existing = false,
+                    const std::string& box = ""
             );
+            // Expects a registry that has already been through configurePanels and
+            // configureJoints, which the preview needs for its estimate anyway.
             void fast_preview(
-                    adsk::core::DefaultModelingOrientations orientation,
+                    entities::ModelOrientation orientation,
                     const adsk::core::Ptr<adsk::fusion::Component>& component
             );
             void full_preview(
-                adsk::core::DefaultModelingOrientations orientation,
+                entities::ModelOrientation orientation,
                 const adsk::core::Ptr<adsk::fusion::Component>& component
             );
+            auto flat_pack(const std::string& filename) -> size_t;
 
             void configureJoints() const;
             void configurePanels() const;
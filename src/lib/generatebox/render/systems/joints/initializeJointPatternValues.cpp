@@ -21,9 +21,6 @@
 
 using std::max;
 
-using namespace adsk::core;
-using namespace adsk::fusion;
-
 using namespace silvanus::generatebox::entities;
 
 void initializeInverseTrimJointPatternValues(entt::registry &registry) {
@@ -12,9 +12,6 @@
 
 using std::max;
 
-using namespace adsk::core;
-using namespace adsk::fusion;
-
 using namespace silvanus::generatebox::entities;
 
 void kerfAdjustJointPatternValues(entt::registry &registry)  {
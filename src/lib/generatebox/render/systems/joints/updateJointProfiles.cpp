@@ -16,27 +16,43 @@
 #include <plog/Log.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 using std::max;
 
 using namespace silvanus::generatebox::entities;
 
 void updateJointProfileGroups(entt::registry& registry) {
     PLOG_DEBUG << "Started updateJointProfileGroups";
-    auto hashes = std::map<entt::entity, std::set<size_t>>{};
+    auto hashes = std::vector<std::pair<entt::entity, size_t>>{};
 
     auto profile_view = registry.view<const JointProfile, const ParentPanel>().proxy();
     for (auto &&[entity, profile, parent]: profile_view) {
         PLOG_DEBUG << "Storing joint profile from " << (int)entity << " to " << (int)parent.id;
         auto hash = std::hash<JointProfile>()(profile);
-        hashes[parent.id].insert(hash);
+        hashes.emplace_back(parent.id, hash);
         PLOG_DEBUG << "hash is " << hash;
     }
 
+    // Sorting brings every panel's hashes together in ascending order, so a
+    // panel's tag is the hash of its distinct profile hashes in that order.
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
     auto children_view = registry.view<const ChildPanels>().proxy();
     for (auto &&[entity, children]: children_view) {
+        auto seed  = size_t{0};
+        auto entry = std::lower_bound(hashes.begin(), hashes.end(), std::make_pair(entity, size_t{0}));
+        for (; entry != hashes.end() && entry->first == entity; ++entry) {
+            boost::hash_combine(seed, entry->second);
+        }
+
         for (auto const& child: children.panels) {
             PLOG_DEBUG << "Updating " << (int)child << " with joint profile group from " << (int)entity;
-            registry.emplace<JointGroupTag>(child, hashes[entity]);
+            registry.emplace<JointGroupTag>(child, static_cast<std::uint64_t>(seed));
         }
     }
     PLOG_DEBUG << "Finished updateJointProfileGroups";
@@ -132,7 +148,7 @@ void updateJointProfileValues(entt::registry &registry) {
 
     auto param_view = registry.view<JointProfile, const JointProfileParams>();
     for (auto &&[entity, profile, params]: param_view.proxy()) {
-        profile.parameters = params;
+        profile.parameters = entity;
     }
     PLOG_DEBUG << "Finished updateJointProfilesFromPatternValues";
 }
@@ -15,10 +15,12 @@
 using namespace silvanus::generatebox::entities;
 
 void initializeJointExtrusionValues(entt::registry& registry) {
+    auto const& names = nameTable(registry);
+
     auto create_extrusion_view = registry.view<const JointThickness, const JointPanelOffset, const JointName>().proxy();
     for (auto &&[entity, distance, offset, name]: create_extrusion_view) {
-        PLOG_DEBUG << (int)entity << "Adding joint extrusion values to " << name.value << ": " << distance.value << ", " << offset.value;
-        PLOG_DEBUG << (int)entity << "Adding joint extrusion expressions to " << name.value << ": " << distance.expression << ", " << offset.expression;
+        PLOG_DEBUG << (int)entity << "Adding joint extrusion values to " << names.name(name.value) << ": " << distance.value << ", " << offset.value;
+        PLOG_DEBUG << (int)entity << "Adding joint extrusion expressions to " << names.name(name.value) << ": " << distance.expression << ", " << offset.expression;
         registry.emplace<JointExtrusion>(
             entity, entity, distance, offset, name.value
         );
@@ -26,12 +28,14 @@ void initializeJointExtrusionValues(entt::registry& registry) {
 }
 
 void initializeJointExtrusionExpressions(entt::registry& registry) {
+    auto const& names = nameTable(registry);
+
     auto create_extrusion_view = registry.view<const JointThicknessParam, const JointPanelOffsetParam, const JointName>().proxy();
     for (auto &&[entity, distance, offset, name]: create_extrusion_view) {
         registry.emplace<JointExtrusionParams>(
             entity, distance.expression, offset.expression
         );
-        PLOG_DEBUG << "Adding joint extrusion parameters to " << name.value << ": " << distance.expression << ", " << offset.expression;
+        PLOG_DEBUG << "Adding joint extrusion parameters to " << names.name(name.value) << ": " << distance.expression << ", " << offset.expression;
     }
 }
 
@@ -15,11 +15,13 @@ using namespace silvanus::generatebox::entities;
 
 void initializePanelExtrusionsFromOffsetAndDistance(entt::registry& registry) {
     PLOG_DEBUG << "Started initializePanelExtrusionsFromOffsetAndDistance";
+    auto& names = nameTable(registry);
+
     auto view = registry.view<Panel, const PanelOffset, const ExtrusionDistance>();
     for (auto &&[entity, panel, offset, distance]: view.proxy()) {
         PLOG_DEBUG << "Creating panel extrusions";
         registry.emplace_or_replace<PanelExtrusion>(
-            entity, entity, distance, offset, panel.name
+            entity, entity, distance, offset, names.intern(panel.name)
         );
     }
     PLOG_DEBUG << "Finished initializePanelExtrusionsFromOffsetAndDistance";
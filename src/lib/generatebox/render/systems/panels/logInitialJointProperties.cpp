@@ -41,7 +41,7 @@ void logInitialJointProperties(entt::registry &registry) {
         JointThickness,
         JointPattern,
         JointEnabled
-    >().each([](
+    >().each([&registry](
         auto entity,
         auto const &panel,
         auto const &enable,
@@ -59,7 +59,9 @@ void logInitialJointProperties(entt::registry &registry) {
         auto const &joint_pattern,
         auto const &joint_enabled
     ){
-        PLOG_DEBUG << "<<<<<<<< " << panel.name << " jointed with " << joint_name.value << " <<<<<<<<";
+        auto const& joint = nameTable(registry).name(joint_name.value);
+
+        PLOG_DEBUG << "<<<<<<<< " << panel.name << " jointed with " << joint << " <<<<<<<<";
         PLOG_DEBUG << " panel is enabled == " << enable.value;
         PLOG_DEBUG << " joint is enabled == " << joint_enabled.value;
         PLOG_DEBUG << " thickness is " << thickness.value;
@@ -75,6 +77,6 @@ void logInitialJointProperties(entt::registry &registry) {
         PLOG_DEBUG << " joint position is " << (int) joint_position.value;
         PLOG_DEBUG << " joint thickness is " << joint_thickness.value;
         PLOG_DEBUG << " joint pattern is " << (int) joint_pattern.value;
-        PLOG_DEBUG << ">>>>>>>> " << panel.name << " jointed with " << joint_name.value << " >>>>>>>>";
+        PLOG_DEBUG << ">>>>>>>> " << panel.name << " jointed with " << joint << " >>>>>>>>";
     });
 }
\ No newline at end of file
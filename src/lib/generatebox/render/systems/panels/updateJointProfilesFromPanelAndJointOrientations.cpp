@@ -3,6 +3,7 @@
 // Copyright (c) 2020 Hobbyist Maker. All rights reserved.
 //
 
+#include "entities/AxisAlgebra.hpp"
 #include "entities/JointOrientation.hpp"
 #include "entities/JointProfile.hpp"
 #include "entities/OrientationGroup.hpp"
@@ -30,7 +31,7 @@ void updateJointProfilesFromPanelAndJointOrientations(entt::registry &registry)
         PLOG_DEBUG << "Add orientation group for " << panel.name;
         profile.panel_orientation = panel.orientation;
         profile.joint_orientation = joint.axis;
-        registry.emplace<OrientationGroup>(entity, panel.orientation, joint.axis);
+        registry.emplace<OrientationGroup>(entity, panel.orientation, joint.axis, complementAxis(panel.orientation, joint.axis));
 
         if (progress) progress->control->progressValue(progress_value);
         progress_value += 1;
@@ -6,6 +6,7 @@
 #include <entt/entt.hpp>
 #include <plog/Log.h>
 
+#include "entities/AxisAlgebra.hpp"
 #include "entities/ExtrusionDistance.hpp"
 #include "entities/JointPanelOffset.hpp"
 #include "entities/OrientationTags.hpp"
@@ -19,19 +20,13 @@ void updatePanelOffsetsValues(entt::registry& registry) {
     auto view = registry.view<PanelOffset, const PanelMinPoint, const PanelMinParam, const PanelAxis>();
 
     for (auto &&[entity, offset, min_point, min_param, normal]: view.proxy()) {
-        auto length = min_point.length * normal.length;
-        auto width = min_point.width * normal.width;
-        auto height = min_point.height * normal.height;
+        auto const axis = normalAxis(normal);
 
-        offset.value = std::max({length, width, height});
-
-        auto length_param = normal.length ? min_param.length : "";
-        auto width_param = normal.width ? min_param.width : "";
-        auto height_param = normal.height ? min_param.height : "";
+        offset.value = axisComponent(min_point, axis);
 
         offset.expression.shrink_to_fit();
 
-        offset.expression = length_param.append(width_param).append(height_param);
+        offset.expression = axisComponent(min_param, axis);
         PLOG_DEBUG << (int)entity << ": Adjusting panel offset value to " << offset.value;
     }
 }
@@ -40,13 +35,9 @@ void updatePanelOffsetsExpressions(entt::registry& registry) {
     auto view = registry.view<PanelOffsetParam, const PanelMinParam, const PanelAxis>();
 
     for (auto &&[entity, offset, min_point, normal]: view.proxy()) {
-        auto length = normal.length ? min_point.length : "";
-        auto width = normal.width ? min_point.width : "";
-        auto height = normal.height ? min_point.height : "";
-
         offset.expression.shrink_to_fit();
 
-        offset.expression = length.append(width).append(height);
+        offset.expression = axisComponent(min_point, normalAxis(normal));
         PLOG_DEBUG << (int)entity << ": Adjusting panel offset expression to " << offset.expression;
     }
 }
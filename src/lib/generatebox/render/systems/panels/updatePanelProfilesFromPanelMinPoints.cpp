@@ -5,61 +5,32 @@
 
 #include <entt/entt.hpp>
 #include "plog/Log.h"
+#include "entities/AxisAlgebra.hpp"
+#include "entities/Panel.hpp"
 #include "entities/PanelProfile.hpp"
-#include "entities/OrientationTags.hpp"
 #include "entities/PanelMaxPoint.hpp"
 
 using namespace silvanus::generatebox::entities;
 
 void updatePanelProfilesValues(entt::registry &registry) {
-    auto length_view = registry.view<PanelProfile, const LengthOrientation, const PanelMaxPoint, const PanelMaxParam>().proxy();
-    for (auto &&[entity, profile, orientation, reference, reference_param]: length_view) {
-        PLOG_DEBUG << "Updating LengthOrientation panel profile";
-        profile.length.value = reference.width;
-        profile.length.expression = reference_param.width;
-        profile.width.value = reference.height;
-        profile.width.expression = reference_param.height;
-    }
-
-    auto width_view = registry.view<PanelProfile, const WidthOrientation, const PanelMaxPoint, const PanelMaxParam>().proxy();
-    for (auto &&[entity, profile, orientation, reference, reference_param]: width_view) {
-        PLOG_DEBUG << "Updating WidthOrientation panel profile";
-        profile.length.value = reference.length;
-        profile.length.expression = reference_param.length;
-        profile.width.value = reference.height;
-        profile.width.expression = reference_param.height;
-    }
-
-    auto height_view = registry.view<PanelProfile, const HeightOrientation, const PanelMaxPoint, const PanelMaxParam>().proxy();
-    for (auto &&[entity, profile, orientation, reference, reference_param]: height_view) {
-        PLOG_DEBUG << "Updating HeightOrientation panel profile";
-        profile.length.value = reference.length;
-        profile.length.expression = reference_param.length;
-        profile.width.value = reference.width;
-        profile.width.expression = reference_param.width;
+    auto view = registry.view<PanelProfile, const Panel, const PanelMaxPoint, const PanelMaxParam>().proxy();
+    for (auto &&[entity, profile, panel, reference, reference_param]: view) {
+        PLOG_DEBUG << "Updating " << (int)panel.orientation << " orientation panel profile";
+        auto const axes = profileAxes(panel.orientation);
+        profile.length.value = axisComponent(reference, axes.length);
+        profile.length.expression = axisComponent(reference_param, axes.length);
+        profile.width.value = axisComponent(reference, axes.width);
+        profile.width.expression = axisComponent(reference_param, axes.width);
     }
 }
 
 void updatePanelProfilesExpressions(entt::registry &registry) {
-    auto length_view = registry.view<PanelProfileParams, const LengthOrientation, const PanelMaxParam>().proxy();
-    for (auto &&[entity, profile, orientation, reference]: length_view) {
-        profile.length = reference.width;
-        profile.width = reference.height;
-        PLOG_DEBUG << "Updating LengthOrientation panel profile expressions: " << profile.length << ", " << profile.width;
-    }
-
-    auto width_view = registry.view<PanelProfileParams, const WidthOrientation, const PanelMaxParam>().proxy();
-    for (auto &&[entity, profile, orientation, reference]: width_view) {
-        profile.length = reference.length;
-        profile.width = reference.height;
-        PLOG_DEBUG << "Updating WidthOrientation panel profile expressions: " << profile.length << ", " << profile.width;
-    }
-
-    auto height_view = registry.view<PanelProfileParams, const HeightOrientation, const PanelMaxParam>().proxy();
-    for (auto &&[entity, profile, orientation, reference]: height_view) {
-        profile.length = reference.length;
-        profile.width = reference.width;
-        PLOG_DEBUG << "Updating HeightOrientation panel profile expressions: " << profile.length << ", " << profile.width;
+    auto view = registry.view<PanelProfileParams, const Panel, const PanelMaxParam>().proxy();
+    for (auto &&[entity, profile, panel, reference]: view) {
+        auto const axes = profileAxes(panel.orientation);
+        profile.length = axisComponent(reference, axes.length);
+        profile.width = axisComponent(reference, axes.width);
+        PLOG_DEBUG << "Updating " << (int)panel.orientation << " orientation panel profile expressions: " << profile.length << ", " << profile.width;
     }
 }
 
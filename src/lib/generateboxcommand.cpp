@@ -20,17 +20,44 @@
 #include "entities/PanelProfile.hpp"
 #include "entities/Position.hpp"
 #include "entities/PanelMinPoint.hpp"
+#include "fusion/FusionCallProfiler.hpp"
+#include "fusion/FusionSupport.hpp"
+#include "render/estimate/estimateBoxMetrics.hpp"
 
 #include <Core/CoreAll.h>
 #include <Fusion/FusionAll.h>
 
 #include "plog/Log.h"
 
+#include <sstream>
+
 using namespace adsk::core;
 using namespace adsk::fusion;
 
 using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::estimate;
 using namespace silvanus;
+using silvanus::generatebox::fusion::toModelOrientation;
+using silvanus::generatebox::systems::RenderMode;
+
+#ifdef SILVANUS_PROFILE_FUSION
+namespace {
+
+    auto renderModeName(RenderMode mode) -> const char* {
+        switch (mode) {
+            case RenderMode::Parametric:
+                return "parametric";
+            case RenderMode::Instanced:
+                return "instanced";
+            case RenderMode::Outline:
+                return "outline";
+            default:
+                return "direct";
+        }
+    }
+
+}
+#endif
 
 GenerateBoxCommand::GenerateBoxCommand(
     const adsk::core::Ptr<Application>& app
@@ -91,7 +118,7 @@ void GenerateBoxCommand::onCreate(const adsk::core::Ptr<CommandCreatedEventArgs>
     auto inputs = command->commandInputs();
     auto use_metric = (units_manager->distanceDisplayUnits() < InchDistanceUnits);
     auto root_component = design->rootComponent();
-    auto orientation = preferences->generalPreferences()->defaultModelingOrientation();
+    auto orientation = toModelOrientation(preferences->generalPreferences()->defaultModelingOrientation());
 
     command_dialog.create(m_app, inputs, root_component, orientation, use_metric);
 }
@@ -107,6 +134,11 @@ void GenerateBoxCommand::onDestroy(const adsk::core::Ptr<CommandEventArgs>& args
 }
 
 void GenerateBoxCommand::onExecute(const adsk::core::Ptr<CommandEventArgs>& args) {
+    if (command_dialog.is_flat_pack()) {
+        exportFlatPack();
+        return;
+    }
+
     auto progress = m_app->userInterface()->createProgressDialog();
     progress->show("Generating Parametric Box Design", "Starting rendering process...", 0, 1, 1);
     progress->reset();
@@ -120,25 +152,59 @@ void GenerateBoxCommand::onExecute(const adsk::core::Ptr<CommandEventArgs>& args
     auto product = adsk::core::Ptr<Product>{m_app->activeProduct()};
     auto design = adsk::core::Ptr<Design>{product};
     auto root_component = design->rootComponent();
-    auto orientation = preferences->generalPreferences()->defaultModelingOrientation();
+    auto orientation = toModelOrientation(preferences->generalPreferences()->defaultModelingOrientation());
 
     command_dialog.initializePanels();
 
-    m_core.execute(orientation, root_component, command_dialog.is_parametric());
+    auto const mode = command_dialog.is_parametric() ? (command_dialog.instanced_panels() ? RenderMode::Instanced : RenderMode::Parametric)
+        : command_dialog.is_outline() ? RenderMode::Outline
+        : RenderMode::Direct;
+
+    SILVANUS_FUSION_PROFILE_RESET();
+    m_core.execute(orientation, root_component, mode, command_dialog.update_existing(), command_dialog.box_name());
 
     m_registry.unset<ProgressDialogControl>();
+
+#ifdef SILVANUS_PROFILE_FUSION
+    auto summary = std::stringstream{};
+    generatebox::fusion::FusionCallProfiler::writeSummary(summary);
+    PLOG_INFO << "Fusion calls for " << renderModeName(mode) << " render:\n" << summary.str();
+#endif
 }
 
-void GenerateBoxCommand::onPreview(const adsk::core::Ptr<CommandEventArgs>& args) {
-    if (!command_dialog.fast_preview()) return;
+void GenerateBoxCommand::exportFlatPack() {
+    auto file_dialog = m_ui->createFileDialog();
+    file_dialog->title("Export Flat Pack");
+    file_dialog->filter("SVG Files (*.svg);;DXF Files (*.dxf);;G-code Files (*.gcode *.nc);;Silvanus Snapshots (*.silvanus)");
+    file_dialog->filterIndex(0);
+
+    if (file_dialog->showSave() != DialogOK) return;
 
     command_dialog.initializePanels();
 
+    auto const filename = file_dialog->filename();
+    auto const exported = m_core.flat_pack(filename);
+
+    PLOG_DEBUG << "Exported " << exported << " panels to " << filename;
+    if (exported == 0) {
+        m_ui->messageBox("No panels were exported to " + filename);
+    }
+}
+
+void GenerateBoxCommand::onPreview(const adsk::core::Ptr<CommandEventArgs>& args) {
+    command_dialog.initializePanels();
+    m_core.configurePanels();
+    m_core.configureJoints();
+
+    command_dialog.showEstimate(estimateBoxMetrics(m_registry));
+
+    if (!command_dialog.fast_preview()) return;
+
     auto preferences = adsk::core::Ptr<Preferences>{m_app->preferences()};
     auto product = adsk::core::Ptr<Product>{m_app->activeProduct()};
     auto design = adsk::core::Ptr<Design>{product};
     auto root_component = design->rootComponent();
-    auto orientation = preferences->generalPreferences()->defaultModelingOrientation();
+    auto orientation = toModelOrientation(preferences->generalPreferences()->defaultModelingOrientation());
 
     m_core.fast_preview(orientation, root_component);
 }
@@ -31,6 +31,8 @@ namespace silvanus {
 
         bool updated = false;
 
+        void exportFlatPack();
+
     public:
         explicit GenerateBoxCommand(
              const adsk::core::Ptr<adsk::core::Application>& app
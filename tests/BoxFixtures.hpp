@@ -0,0 +1,33 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#ifndef SILVANUSPRO_BOXFIXTURES_HPP
+#define SILVANUSPRO_BOXFIXTURES_HPP
+
+#include "batch/BatchGenerator.hpp"
+#include "batch/BoxSpecification.hpp"
+
+#include <vector>
+
+namespace silvanus::generatebox::testing {
+
+    // A box with its top enabled and the given number of length and width
+    // dividers, which gives every panel orientation, inner joints and holes
+    // to check. Everything else is taken from base.
+    inline auto makeDividedBox(int length_dividers, int width_dividers, batch::BoxSpecification base = {}) -> batch::BoxSpecification {
+        base.top.enabled           = true;
+        base.length_dividers.count = length_dividers;
+        base.width_dividers.count  = width_dividers;
+        return base;
+    }
+
+    // The finished panels of makeDividedBox.
+    inline auto makeDividedPanels(int length_dividers, int width_dividers, const batch::BoxSpecification& base = {}) -> std::vector<geometry::PanelGeometry> {
+        return batch::generateBox(makeDividedBox(length_dividers, width_dividers, base));
+    }
+
+}
+
+#endif //SILVANUSPRO_BOXFIXTURES_HPP
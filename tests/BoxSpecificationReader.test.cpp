@@ -0,0 +1,129 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "batch/BoxSpecificationReader.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace silvanus::generatebox::batch;
+
+namespace {
+
+    struct ReadResult {
+        std::vector<BoxSpecification> specifications;
+        std::vector<std::string>      errors;
+    };
+
+    // Reads everything the way the batch generator does: a record that throws
+    // is reported and the reader carries on with the next one.
+    auto readAll(const std::string& text) -> ReadResult {
+        auto stream = std::istringstream{text};
+        auto reader = BoxSpecificationReader(stream);
+        auto result = ReadResult{};
+
+        while (true) {
+            auto specification = BoxSpecification{};
+            try {
+                if (!reader.next(specification)) break;
+                result.specifications.push_back(specification);
+            } catch (const std::runtime_error& error) {
+                result.errors.emplace_back(error.what());
+            }
+        }
+        return result;
+    }
+
+}
+
+TEST_CASE("CSV records are read in millimeters with dialog defaults", "[reader]") {
+    auto const result = readAll(
+        "# product sheet\n"
+        "Name,Length,Width,Height,Top,Length_Dividers,SKU\r\n"
+        "\n"
+        "tray,300,200,50,yes,2,T-1\r\n"
+        "plain,,,,,,\n"
+    );
+
+    REQUIRE(result.errors.empty());
+    REQUIRE(result.specifications.size() == 2);
+
+    auto const& tray = result.specifications[0];
+    CHECK(tray.name == "tray");
+    CHECK(tray.length == Approx(30));
+    CHECK(tray.width == Approx(20));
+    CHECK(tray.height == Approx(5));
+    CHECK(tray.top.enabled);
+    CHECK(tray.length_dividers.count == 2);
+
+    auto const defaults = BoxSpecification{};
+    auto const& plain   = result.specifications[1];
+    CHECK(plain.name == "plain");
+    CHECK(plain.length == Approx(defaults.length));
+    CHECK(plain.top.enabled == defaults.top.enabled);
+    CHECK(plain.length_dividers.count == 0);
+}
+
+TEST_CASE("A malformed CSV record is reported with its line and reading carries on", "[reader]") {
+    auto const result = readAll(
+        "name,length,width_dividers,joint_pattern\n"
+        "first,100,1,box\n"
+        "# comment lines still count\n"
+        "second,-5,1,box\n"
+        "third,100,1.5,box\n"
+        "fourth,100,1,dovetail\n"
+        "fifth,\"100,1,box\n"
+        "sixth,100,1,box,extra\n"
+        "seventh,120,2,lap\n"
+    );
+
+    REQUIRE(result.errors.size() == 5);
+    CHECK(result.errors[0].rfind("line 4: ", 0) == 0);
+    CHECK(result.errors[1].rfind("line 5: ", 0) == 0);
+    CHECK(result.errors[2].rfind("line 6: ", 0) == 0);
+    CHECK(result.errors[3].rfind("line 7: ", 0) == 0);
+    CHECK(result.errors[4].rfind("line 8: ", 0) == 0);
+
+    CHECK(result.errors[0].find("length") != std::string::npos);
+    CHECK(result.errors[1].find("width_dividers") != std::string::npos);
+    CHECK(result.errors[2].find("joint_pattern") != std::string::npos);
+
+    REQUIRE(result.specifications.size() == 2);
+    CHECK(result.specifications[0].name == "first");
+    CHECK(result.specifications[1].name == "seventh");
+    CHECK(result.specifications[1].length == Approx(12));
+    CHECK(result.specifications[1].width_dividers.count == 2);
+    CHECK(result.specifications[1].joint_pattern == JointPatternType::LapJoint);
+}
+
+TEST_CASE("A malformed JSON line is reported with its line and reading carries on", "[reader]") {
+    auto const result = readAll(
+        "{\"name\": \"first\", \"length\": 100, \"top\": true}\n"
+        "{\"name\": \"broken\", \"length\": \n"
+        "{\"name\": \"nested\", \"top\": {\"enabled\": true}}\n"
+        "{\"name\": \"wrong\", \"top\": \"maybe\"}\n"
+        "{\"height\": 60}\n"
+    );
+
+    REQUIRE(result.errors.size() == 3);
+    CHECK(result.errors[0].rfind("line 2: ", 0) == 0);
+    CHECK(result.errors[1].rfind("line 3: ", 0) == 0);
+    CHECK(result.errors[2].rfind("line 4: ", 0) == 0);
+    CHECK(result.errors[2].find("top") != std::string::npos);
+
+    REQUIRE(result.specifications.size() == 2);
+    CHECK(result.specifications[0].name == "first");
+    CHECK(result.specifications[0].length == Approx(10));
+    CHECK(result.specifications[0].top.enabled);
+
+    // Lines that are not records at all take no number; a record with a bad
+    // value does.
+    CHECK(result.specifications[1].name == "box-3");
+    CHECK(result.specifications[1].height == Approx(6));
+}
@@ -0,0 +1,90 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "BoxFixtures.hpp"
+#include "batch/BatchGenerator.hpp"
+#include "entities/ModelOrientation.hpp"
+#include "fusion/RecordingBackend.hpp"
+#include "render/geometry/collectPanelGeometry.hpp"
+#include "render/presentation/DirectRenderer.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <map>
+
+using namespace silvanus::generatebox;
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::fusion;
+
+namespace {
+
+    // 20 x 10 x 5 with 1 cm fingers, so the finger counts don't move with the
+    // automatic width rules.
+    auto fixedBox() -> BoxSpecification {
+        auto specification = BoxSpecification{};
+        specification.length       = 20;
+        specification.width        = 10;
+        specification.height       = 5;
+        specification.thickness    = 0.5;
+        specification.finger_width = 1;
+        specification.finger_mode  = FingerPatternType::ConstantWidth;
+        return specification;
+    }
+
+    void renderBox(entt::registry& registry, RecordingBackend& backend) {
+        auto renderer = render::DirectRenderer(backend, registry);
+        renderer.execute(entities::ModelOrientation::YUp);
+    }
+
+}
+
+TEST_CASE("The direct renderer keeps to its Fusion call budget for a fixed box", "[render]") {
+    auto registry = entt::registry{};
+    configureBox(fixedBox(), registry);
+
+    auto backend = RecordingBackend{};
+    renderBox(registry, backend);
+
+    // Left and right, and front and back, share a profile, so only the bottom,
+    // the left and the back panel are built; the other two are copies. Each
+    // built panel is one box plus one box and subtraction per finger or corner
+    // cut: 26 in the bottom, 9 in the left and 12 in the back panel.
+    CHECK(backend.count(FusionOperation::SubtractBody) == 26 + 9 + 12);
+    CHECK(backend.count(FusionOperation::CreateBox) == 3 + 47);
+    CHECK(backend.count(FusionOperation::CopyBody) == 2);
+    CHECK(backend.count(FusionOperation::TranslateBody) == 50 + 2);
+    CHECK(backend.count(FusionOperation::AddBody) == 5);
+    CHECK(backend.count(FusionOperation::SetUserParameter) == 0);
+    CHECK(backend.total() == 50 + 2 + 52 + 47 + 5);
+}
+
+TEST_CASE("Every rendered body carries the cuts of its panel", "[render]") {
+    auto registry = entt::registry{};
+    configureBox(testing::makeDividedBox(2, 1, fixedBox()), registry);
+
+    auto cuts = std::map<std::string, size_t>{};
+    for (auto const& panel: geometry::collectPanelGeometry(registry)) {
+        cuts[panel.name + " Panel Body"] = panel.cuts.size();
+    }
+
+    auto backend = RecordingBackend{};
+    renderBox(registry, backend);
+
+    auto const added = backend.addedBodies();
+    REQUIRE(added.size() == cuts.size());
+    CHECK(backend.count(FusionOperation::AddBody) == cuts.size());
+
+    for (auto const* body: added) {
+        INFO(body->name);
+        REQUIRE(cuts.count(body->name) == 1);
+        CHECK(body->cuts.size() == cuts[body->name]);
+    }
+
+    // Copies are translated into place, every other box is the panel or the
+    // finger it was created for.
+    auto const built = added.size() - backend.count(FusionOperation::CopyBody);
+    CHECK(backend.count(FusionOperation::CreateBox) == built + backend.count(FusionOperation::SubtractBody));
+    CHECK(backend.count(FusionOperation::TranslateBody) == backend.count(FusionOperation::CreateBox) + backend.count(FusionOperation::CopyBody));
+}
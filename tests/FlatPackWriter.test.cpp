@@ -0,0 +1,161 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "BoxFixtures.hpp"
+#include "render/flatpack/DxfWriter.hpp"
+#include "render/flatpack/exportFlatPack.hpp"
+#include "render/flatpack/SvgWriter.hpp"
+#include "render/geometry/PanelOutline.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <iterator>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::flatpack;
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::testing;
+
+namespace {
+
+    // A 10 x 6 panel with an edge notch and a hole, so it has two loops.
+    auto notchedOutline() -> PanelOutline {
+        auto panel = PanelGeometry{};
+        panel.length    = 10;
+        panel.width     = 6;
+        panel.thickness = 0.3;
+        panel.cuts      = {{2, -1, 4, 0.3}, {6, 2, 7, 3}};
+
+        auto outliner = PanelOutliner{};
+        auto outline  = PanelOutline{};
+        outliner.build(panel, outline);
+        return outline;
+    }
+
+    auto count(const std::string& text, const std::string& pattern) -> size_t {
+        auto const expression = std::regex(pattern);
+        return static_cast<size_t>(std::distance(std::sregex_iterator(text.begin(), text.end(), expression), std::sregex_iterator()));
+    }
+
+    using DxfGroups = std::vector<std::pair<int, std::string>>;
+
+    auto dxfGroups(const std::string& text) -> DxfGroups {
+        auto groups = DxfGroups{};
+        auto stream = std::istringstream{text};
+        auto code   = std::string{};
+        auto value  = std::string{};
+        while (std::getline(stream, code) && std::getline(stream, value)) {
+            groups.emplace_back(std::stoi(code), value);
+        }
+        return groups;
+    }
+
+    auto entities(const DxfGroups& groups, const std::string& type) -> size_t {
+        auto result = size_t{0};
+        for (auto const& [code, value]: groups) {
+            if (code == 0 && value == type) ++result;
+        }
+        return result;
+    }
+
+}
+
+TEST_CASE("The SVG writer draws every loop in millimeters with the y axis flipped", "[flatpack]") {
+    auto const outline = notchedOutline();
+    REQUIRE(outline.loops.size() == 2);
+
+    auto stream = std::ostringstream{};
+    auto writer = SvgWriter(stream);
+    writer.begin(20, 10);
+    writer.panel("Front <1> & back", outline, 5, 2);
+    writer.end();
+
+    auto const svg = stream.str();
+
+    CHECK(svg.find("width=\"200.0000mm\" height=\"100.0000mm\" viewBox=\"0 0 200.0000 100.0000\"") != std::string::npos);
+    CHECK(count(svg, "<g ") == 1);
+    CHECK(count(svg, "M") == outline.loops.size());
+    CHECK(count(svg, "Z ") == outline.loops.size());
+    CHECK(count(svg, "L") == outline.points.size() - outline.loops.size());
+    CHECK(svg.find("Front &lt;1&gt; &amp; back") != std::string::npos);
+    CHECK(svg.find("<1>") == std::string::npos);
+
+    // The first point of the outer loop, moved by the placement and flipped.
+    auto const& first = outline.points[0];
+    auto point = std::ostringstream{};
+    point << std::fixed;
+    point.precision(4);
+    point << "M" << (5 + first.u) * 10 << "," << (10 - (2 + first.v)) * 10 << " ";
+    CHECK(svg.find(point.str()) != std::string::npos);
+
+    CHECK(svg.rfind("</svg>\n") == svg.size() - 7);
+}
+
+TEST_CASE("The DXF writer closes one polyline per loop on the cut layer", "[flatpack]") {
+    auto const outline = notchedOutline();
+
+    auto stream = std::ostringstream{};
+    auto writer = DxfWriter(stream);
+    writer.begin(20, 10);
+    writer.panel("Left", outline, 5, 2);
+    writer.end();
+
+    auto const groups = dxfGroups(stream.str());
+    REQUIRE_FALSE(groups.empty());
+
+    CHECK(entities(groups, "SECTION") == 3);
+    CHECK(entities(groups, "ENDSEC") == 3);
+    CHECK(entities(groups, "POLYLINE") == outline.loops.size());
+    CHECK(entities(groups, "SEQEND") == outline.loops.size());
+    CHECK(entities(groups, "VERTEX") == outline.points.size());
+    CHECK(entities(groups, "TEXT") == 1);
+    CHECK(groups.back() == std::make_pair(0, std::string{"EOF"}));
+
+    // Every vertex is on the cut layer at the outline point in millimeters,
+    // without the flip SVG needs.
+    auto vertex = size_t{0};
+    for (size_t i = 0; i < groups.size(); ++i) {
+        if (groups[i] != std::make_pair(0, std::string{"VERTEX"})) continue;
+        REQUIRE(i + 3 < groups.size());
+
+        auto const& point = outline.points[vertex++];
+        CHECK(groups[i + 1] == std::make_pair(8, std::string{"CUT"}));
+        CHECK(groups[i + 2].first == 10);
+        CHECK(std::stod(groups[i + 2].second) == Approx((5 + point.u) * 10));
+        CHECK(groups[i + 3].first == 20);
+        CHECK(std::stod(groups[i + 3].second) == Approx((2 + point.v) * 10));
+    }
+    CHECK(vertex == outline.points.size());
+
+    // Polylines are closed.
+    for (size_t i = 0; i < groups.size(); ++i) {
+        if (groups[i] != std::make_pair(0, std::string{"POLYLINE"})) continue;
+        REQUIRE(i + 6 < groups.size());
+        CHECK(groups[i + 6] == std::make_pair(70, std::string{"1"}));
+    }
+}
+
+TEST_CASE("A divided box is written with one group per panel", "[flatpack]") {
+    auto registry = entt::registry{};
+    configureBox(makeDividedBox(2, 1), registry);
+
+    auto svg        = std::ostringstream{};
+    auto svg_writer = SvgWriter(svg);
+    auto const svg_panels = exportFlatPack(registry, svg_writer);
+
+    auto dxf        = std::ostringstream{};
+    auto dxf_writer = DxfWriter(dxf);
+    auto const dxf_panels = exportFlatPack(registry, dxf_writer);
+
+    CHECK(svg_panels == 9);
+    CHECK(dxf_panels == svg_panels);
+    CHECK(count(svg.str(), "<g ") == svg_panels);
+    CHECK(entities(dxfGroups(dxf.str()), "TEXT") == dxf_panels);
+}
@@ -0,0 +1,86 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "BoxFixtures.hpp"
+#include "entities/JointExtrusion.hpp"
+#include "entities/JointName.hpp"
+#include "entities/NameTable.hpp"
+#include "entities/Panel.hpp"
+#include "entities/PanelExtrusion.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::testing;
+
+TEST_CASE("A name is interned once and keeps its id", "[names]") {
+    auto table = NameTable{};
+
+    CHECK(table.intern("") == NameId{});
+    CHECK(table.name(NameId{}).empty());
+
+    auto const front = table.intern("Front");
+    auto const back  = table.intern("Back");
+    CHECK(front != NameId{});
+    CHECK(back != front);
+    CHECK(table.intern("Front") == front);
+    CHECK(table.intern(std::string{"Fro"} + "nt") == front);
+    CHECK(table.name(front) == "Front");
+    CHECK(table.name(back) == "Back");
+
+    // Ids stay valid as the table grows past its first allocation.
+    auto ids = std::vector<NameId>{};
+    for (auto i = 0; i < 100; ++i) ids.push_back(table.intern("Divider " + std::to_string(i)));
+    CHECK(table.name(front) == "Front");
+    CHECK(table.name(ids[42]) == "Divider 42");
+    CHECK(table.intern("Divider 42") == ids[42]);
+}
+
+TEST_CASE("Joined names are in the alphabetical order of the strings", "[names]") {
+    auto table = NameTable{};
+
+    // Interned in the reverse of alphabetical order, so sorting by id would
+    // give the wrong order.
+    auto const top    = table.intern("Top");
+    auto const left   = table.intern("Left");
+    auto const bottom = table.intern("Bottom");
+
+    CHECK(table.join({top, left, bottom}) == "Bottom-Left-Top");
+    CHECK(table.join({bottom, top}, ", ") == "Bottom, Top");
+    CHECK(table.join({left}) == "Left");
+    CHECK(table.join({}).empty());
+}
+
+TEST_CASE("Configured joints and extrusions name panels through the registry's table", "[names]") {
+    auto registry = entt::registry{};
+    configureBox(makeDividedBox(2, 1), registry);
+
+    auto& table = nameTable(registry);
+
+    auto panel_names = std::set<std::string>{};
+    for (auto&& [entity, panel, extrusion]: registry.view<const Panel, const PanelExtrusion>().proxy()) {
+        panel_names.insert(panel.name);
+        CHECK(table.name(extrusion.name) == panel.name);
+    }
+    REQUIRE(panel_names.size() == 9);
+
+    auto joints = 0;
+    for (auto&& [entity, joint_name, extrusion]: registry.view<const JointName, const JointExtrusion>().proxy()) {
+        ++joints;
+        CHECK(extrusion.name == joint_name.value);
+        CHECK(panel_names.count(table.name(joint_name.value)) == 1);
+    }
+    CHECK(joints > 0);
+
+    // Every panel name is already in the table, once.
+    for (auto&& [entity, panel, extrusion]: registry.view<const Panel, const PanelExtrusion>().proxy()) {
+        CHECK(table.intern(panel.name) == extrusion.name);
+    }
+}
@@ -0,0 +1,122 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "BoxFixtures.hpp"
+#include "render/geometry/PanelMesh.hpp"
+#include "render/geometry/PanelOutline.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::testing;
+
+namespace {
+
+    auto panel(AxisFlag orientation, std::vector<Rectangle> cuts = {}) -> PanelGeometry {
+        auto result = PanelGeometry{};
+        result.name        = "panel";
+        result.orientation = orientation;
+        result.length      = 10;
+        result.width       = 6;
+        result.thickness   = 0.3;
+        result.offset      = 1;
+        result.cuts        = std::move(cuts);
+        return result;
+    }
+
+    auto vertex(const Mesh& mesh, int index) -> std::array<double, 3> {
+        return {mesh.coordinates[index * 3], mesh.coordinates[index * 3 + 1], mesh.coordinates[index * 3 + 2]};
+    }
+
+    // A closed surface has no vector area, and by the divergence theorem its
+    // outward wound triangles enclose the volume of the solid.
+    struct Closure {
+        std::array<double, 3> area{};
+        double                volume = 0;
+    };
+
+    auto closure(const Mesh& mesh) -> Closure {
+        auto result = Closure{};
+
+        for (size_t i = 0; i < mesh.triangles(); ++i) {
+            auto const a = vertex(mesh, mesh.indices[i * 3]);
+            auto const b = vertex(mesh, mesh.indices[i * 3 + 1]);
+            auto const c = vertex(mesh, mesh.indices[i * 3 + 2]);
+
+            auto const ab = std::array<double, 3>{b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+            auto const ac = std::array<double, 3>{c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+            auto const cross = std::array<double, 3>{
+                ab[1] * ac[2] - ab[2] * ac[1],
+                ab[2] * ac[0] - ab[0] * ac[2],
+                ab[0] * ac[1] - ab[1] * ac[0]
+            };
+
+            for (size_t axis = 0; axis < 3; ++axis) {
+                result.area[axis] += cross[axis] / 2;
+            }
+
+            result.volume += (a[0] * (b[1] * c[2] - b[2] * c[1]) +
+                              a[1] * (b[2] * c[0] - b[0] * c[2]) +
+                              a[2] * (b[0] * c[1] - b[1] * c[0])) / 6;
+        }
+
+        return result;
+    }
+
+}
+
+TEST_CASE("A panel without cuts is meshed as a closed box", "[mesh]") {
+    for (auto const orientation: {AxisFlag::Length, AxisFlag::Width, AxisFlag::Height}) {
+        auto mesher = PanelMesher{};
+        auto mesh   = Mesh{};
+        mesher.append(panel(orientation), mesh);
+
+        CHECK(mesh.triangles() == 12);
+        CHECK(mesh.vertices() == 24);
+        CHECK(mesh.normals.size() == mesh.coordinates.size());
+
+        auto const [area, volume] = closure(mesh);
+        CHECK(area[0] == Approx(0).margin(1e-9));
+        CHECK(area[1] == Approx(0).margin(1e-9));
+        CHECK(area[2] == Approx(0).margin(1e-9));
+        CHECK(volume == Approx(10 * 6 * 0.3));
+    }
+}
+
+TEST_CASE("A hole adds its faces and walls to the mesh", "[mesh]") {
+    auto mesher = PanelMesher{};
+    auto mesh   = Mesh{};
+    mesher.append(panel(AxisFlag::Height, {{3, 2, 5, 2.3}}), mesh);
+
+    // Four face runs on both sides and four walls each around the panel and
+    // around the hole.
+    CHECK(mesh.triangles() == (4 * 2 + 4 + 4) * 2);
+    CHECK(closure(mesh).volume == Approx((60 - 2 * 0.3) * 0.3));
+}
+
+TEST_CASE("Every panel of a divided box is meshed closed and outward facing", "[mesh]") {
+    auto mesher   = PanelMesher{};
+    auto outliner = PanelOutliner{};
+    auto outline  = PanelOutline{};
+    auto mesh     = Mesh{};
+
+    for (auto const& panel: makeDividedPanels(2, 1)) {
+        INFO(panel.name);
+        mesh.clear();
+        mesher.append(panel, mesh);
+        outliner.build(panel, outline);
+
+        REQUIRE(mesh.triangles() > 12);
+        CHECK(mesh.indices.size() % 3 == 0);
+
+        auto const [area, volume] = closure(mesh);
+        CHECK(area[0] == Approx(0).margin(1e-6));
+        CHECK(area[1] == Approx(0).margin(1e-6));
+        CHECK(area[2] == Approx(0).margin(1e-6));
+        CHECK(volume == Approx(outlineArea(outline) * panel.thickness));
+    }
+}
@@ -0,0 +1,101 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "BoxFixtures.hpp"
+#include "render/geometry/PanelOutline.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::testing;
+
+namespace {
+
+    auto panel(std::vector<Rectangle> cuts = {}) -> PanelGeometry {
+        auto result = PanelGeometry{};
+        result.name      = "panel";
+        result.length    = 10;
+        result.width     = 6;
+        result.thickness = 0.3;
+        result.cuts      = std::move(cuts);
+        return result;
+    }
+
+}
+
+TEST_CASE("A panel without cuts is outlined by its profile rectangle", "[outline]") {
+    auto outliner = PanelOutliner{};
+    auto outline  = PanelOutline{};
+    outliner.build(panel(), outline);
+
+    REQUIRE(outline.loops.size() == 1);
+    CHECK_FALSE(outline.loops[0].hole);
+    CHECK(outline.loops[0].count == 4);
+    CHECK(outlineArea(outline) == Approx(60));
+    CHECK(outlineLength(outline) == Approx(32));
+}
+
+TEST_CASE("Edge notches stay part of the outer contour", "[outline]") {
+    auto outliner = PanelOutliner{};
+    auto outline  = PanelOutline{};
+    outliner.build(panel({{2, -1, 4, 0.3}}), outline);
+
+    REQUIRE(outline.loops.size() == 1);
+    CHECK_FALSE(outline.loops[0].hole);
+    CHECK(outline.loops[0].count == 8);
+    CHECK(outlineArea(outline) == Approx(60 - 2 * 0.3));
+    CHECK(outlineLength(outline) == Approx(32 + 2 * 0.3));
+}
+
+TEST_CASE("Inside cuts become clockwise holes after the outer contour", "[outline]") {
+    auto outliner = PanelOutliner{};
+    auto outline  = PanelOutline{};
+    outliner.build(panel({{3, 2, 5, 2.3}, {6, 4, 7, 5}}), outline);
+
+    REQUIRE(outline.loops.size() == 3);
+    CHECK_FALSE(outline.loops[0].hole);
+    CHECK(loopArea(outline, outline.loops[0]) == Approx(60));
+
+    for (size_t i = 1; i < outline.loops.size(); ++i) {
+        CHECK(outline.loops[i].hole);
+        CHECK(loopArea(outline, outline.loops[i]) < 0);
+    }
+
+    CHECK(outlineArea(outline) == Approx(60 - 2 * 0.3 - 1));
+    CHECK(outlineLength(outline) == Approx(32 + 2 * 2.3 + 4));
+}
+
+TEST_CASE("Every panel of a divided box has a counter-clockwise outer contour", "[outline]") {
+    auto specification = BoxSpecification{};
+    specification.width_dividers.first = JointPatternType::LapJoint;
+
+    auto const panels = makeDividedPanels(2, 1, specification);
+    REQUIRE(panels.size() == 9);
+
+    auto outliner = PanelOutliner{};
+    auto outline  = PanelOutline{};
+
+    for (auto const& panel: panels) {
+        INFO(panel.name);
+        outliner.build(panel, outline);
+
+        REQUIRE_FALSE(outline.loops.empty());
+        CHECK_FALSE(outline.loops[0].hole);
+
+        auto holes = false;
+        for (auto const& loop: outline.loops) {
+            CHECK(loop.count >= 4);
+            CHECK(loop.count % 2 == 0);
+            CHECK((loopArea(outline, loop) < 0) == loop.hole);
+
+            if (loop.hole) holes = true;
+            else CHECK_FALSE(holes);
+        }
+
+        CHECK(outlineArea(outline) > 0);
+        CHECK(outlineArea(outline) < panel.length * panel.width);
+    }
+}
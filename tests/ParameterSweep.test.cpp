@@ -0,0 +1,97 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "BoxFixtures.hpp"
+#include "batch/ParameterSweep.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::testing;
+
+TEST_CASE("A sweep range keeps its end point and parses in millimeters", "[sweep]") {
+    auto const range = parseSweepRange("height=40:100:20");
+    CHECK(range.name == "height");
+    CHECK(range.field == &BoxSpecification::height);
+    REQUIRE(range.count() == 4);
+    CHECK(range.value(0) == Approx(4));
+    CHECK(range.value(3) == Approx(10));
+
+    // Decimal steps do not lose the end point to rounding.
+    auto const kerf = parseSweepRange("kerf=0:0.3:0.1");
+    CHECK(kerf.count() == 4);
+    CHECK(kerf.value(3) == Approx(0.03));
+
+    CHECK(parseSweepRange("width=50:50:0").count() == 1);
+
+    CHECK_THROWS_AS(parseSweepRange("depth=1:2:1"), std::invalid_argument);
+    CHECK_THROWS_AS(parseSweepRange("height"), std::invalid_argument);
+    CHECK_THROWS_AS(parseSweepRange("height=40:100"), std::invalid_argument);
+    CHECK_THROWS_AS(parseSweepRange("height=40:100:10:5"), std::invalid_argument);
+    CHECK_THROWS_AS(parseSweepRange("height=40:100:x"), std::invalid_argument);
+    CHECK_THROWS_AS(parseSweepRange("height=100:40:10"), std::invalid_argument);
+}
+
+TEST_CASE("A sweep fills one row per point with the first range varying slowest", "[sweep]") {
+    auto const base   = makeDividedBox(1, 1);
+    auto const ranges = std::vector<SweepRange>{parseSweepRange("length=200:300:100"), parseSweepRange("height=40:80:20")};
+
+    auto const results = sweepParameters(base, ranges, 2);
+
+    REQUIRE(results.points == 6);
+    REQUIRE(results.inputs.size() == 2);
+    CHECK(results.input_names == std::vector<std::string>{"length", "height"});
+
+    auto const lengths = std::vector<double>{20, 20, 20, 30, 30, 30};
+    auto const heights = std::vector<double>{4, 6, 8, 4, 6, 8};
+
+    for (size_t row = 0; row < results.points; ++row) {
+        INFO(row);
+        CHECK(results.inputs[0][row] == Approx(lengths[row]));
+        CHECK(results.inputs[1][row] == Approx(heights[row]));
+
+        auto specification   = base;
+        specification.length = lengths[row];
+        specification.height = heights[row];
+
+        CHECK(results.failed[row] == 0);
+        CHECK(results.panels[row] == static_cast<int>(generateBox(specification).size()));
+        CHECK(results.joints[row] > 0);
+        CHECK(results.min_finger_count[row] <= results.max_finger_count[row]);
+        CHECK(results.min_finger_width[row] <= results.max_finger_width[row]);
+        CHECK(results.cut_length[row] > 0);
+        CHECK(results.sheet_area[row] >= results.panel_area[row]);
+    }
+
+    // A taller box has more panel area and more cut length at the same length.
+    CHECK(results.panel_area[2] > results.panel_area[0]);
+    CHECK(results.cut_length[2] > results.cut_length[0]);
+
+    // The same sweep on one thread gives the same rows.
+    auto const serial = sweepParameters(base, ranges, 1);
+    CHECK(serial.finger_count == results.finger_count);
+    CHECK(serial.cut_length == results.cut_length);
+}
+
+TEST_CASE("Sweep results are written as CSV in millimeters", "[sweep]") {
+    auto const results = sweepParameters(BoxSpecification{}, {parseSweepRange("thickness=3:6:3")}, 1);
+
+    auto stream = std::ostringstream{};
+    writeSweepCsv(results, stream);
+
+    auto lines = std::vector<std::string>{};
+    auto input = std::istringstream{stream.str()};
+    for (auto line = std::string{}; std::getline(input, line);) lines.push_back(line);
+
+    REQUIRE(lines.size() == 3);
+    CHECK(lines[0].rfind("thickness_mm,failed,panels,", 0) == 0);
+    CHECK(lines[1].rfind("3.000,0,5,", 0) == 0);
+    CHECK(lines[2].rfind("6.000,0,5,", 0) == 0);
+}
@@ -0,0 +1,180 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "entities/JointProfile.hpp"
+#include "entities/PanelProfile.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <vector>
+
+using namespace silvanus::generatebox::entities;
+
+namespace {
+
+    // 0.1 + 0.2 is 0.30000000000000004 as a double.
+    constexpr auto sum   = 0.1 + 0.2;
+    constexpr auto exact = 0.3;
+
+    // Checks every property std::map and std::sort rely on over all pairs and
+    // triples of values: irreflexivity, asymmetry, transitivity, and
+    // transitivity of equivalence.
+    template<class T, class Compare>
+    void checkStrictWeakOrdering(const std::vector<T>& values, Compare less) {
+        auto const equivalent = [&](const T& a, const T& b) { return !less(a, b) && !less(b, a); };
+
+        for (size_t i = 0; i < values.size(); ++i) {
+            INFO("a = " << i);
+            auto const& a = values[i];
+            CHECK_FALSE(less(a, a));
+
+            for (size_t j = 0; j < values.size(); ++j) {
+                INFO("b = " << j);
+                auto const& b = values[j];
+                if (less(a, b)) CHECK_FALSE(less(b, a));
+
+                for (size_t k = 0; k < values.size(); ++k) {
+                    INFO("c = " << k);
+                    auto const& c = values[k];
+                    if (less(a, b) && less(b, c)) CHECK(less(a, c));
+                    if (equivalent(a, b) && equivalent(b, c)) CHECK(equivalent(a, c));
+                }
+            }
+        }
+    }
+
+    auto baseJoint() -> JointProfile {
+        auto profile = JointProfile{};
+        profile.panel_position    = Position::Inside;
+        profile.joint_position    = Position::Inside;
+        profile.joint_type        = JointPatternType::LapJoint;
+        profile.finger_type       = FingerPatternType::ConstantWidth;
+        profile.panel_orientation = AxisFlag::Width;
+        profile.joint_orientation = AxisFlag::Width;
+        profile.finger_count      = 5;
+        profile.finger_width      = 1.2;
+        profile.pattern_distance  = 10;
+        profile.pattern_offset    = exact;
+        profile.finger_offset     = 0.5;
+        profile.corner_width      = 0.6;
+        profile.corner_distance   = 9;
+        return profile;
+    }
+
+    // The base, a profile larger in every field, profiles that differ from the
+    // base in one field, and ones that differ in two fields in opposite
+    // directions. Comparing field by field with && ordered the base before the
+    // larger profile but found both equivalent to the single field changes,
+    // so equivalence was not transitive and a map merged different joints.
+    auto jointProfiles() -> std::vector<JointProfile> {
+        auto result = std::vector<JointProfile>{baseJoint()};
+
+        auto vary = [&](auto change) {
+            auto profile = baseJoint();
+            change(profile);
+            result.push_back(profile);
+        };
+
+        vary([](JointProfile& p) {
+            p.panel_position    = Position::Outside;
+            p.joint_position    = Position::Outside;
+            p.joint_direction   = JointDirectionType::Inverted;
+            p.joint_type        = JointPatternType::Tenon;
+            p.finger_type       = FingerPatternType::ConstantCount;
+            p.panel_orientation = AxisFlag::Height;
+            p.joint_orientation = AxisFlag::Height;
+            p.finger_count      = 7;
+            p.finger_width      = 1.4;
+            p.pattern_distance  = 12;
+            p.pattern_offset    = 0.4;
+            p.finger_offset     = 0.7;
+            p.corner_width      = 0.8;
+            p.corner_distance   = 11;
+        });
+        vary([](JointProfile& p) { p.panel_position = Position::Outside; });
+        vary([](JointProfile& p) { p.joint_position = Position::Outside; });
+        vary([](JointProfile& p) { p.joint_direction = JointDirectionType::Inverted; });
+        vary([](JointProfile& p) { p.joint_type = JointPatternType::BoxJoint; });
+        vary([](JointProfile& p) { p.finger_type = FingerPatternType::AutomaticWidth; });
+        vary([](JointProfile& p) { p.panel_orientation = AxisFlag::Length; });
+        vary([](JointProfile& p) { p.joint_orientation = AxisFlag::Height; });
+        vary([](JointProfile& p) { p.finger_count = 7; });
+        vary([](JointProfile& p) { p.finger_width = 0.8; });
+        vary([](JointProfile& p) { p.pattern_distance = 12; });
+        vary([](JointProfile& p) { p.pattern_offset = 0.2; });
+        vary([](JointProfile& p) { p.finger_offset = 0.7; });
+        vary([](JointProfile& p) { p.corner_width = 0.4; });
+        vary([](JointProfile& p) { p.corner_distance = 11; });
+        vary([](JointProfile& p) { p.finger_count = 7; p.finger_width = 0.8; });
+        vary([](JointProfile& p) { p.finger_count = 3; p.finger_width = 1.6; });
+        vary([](JointProfile& p) { p.pattern_offset = sum; });
+
+        return result;
+    }
+
+    auto panelProfile(double length, double width) -> PanelProfile {
+        return {{length, "length"}, {width, "width"}};
+    }
+
+}
+
+TEST_CASE("Joint profile comparisons are strict weak orderings", "[profile]") {
+    auto const profiles = jointProfiles();
+
+    checkStrictWeakOrdering(profiles, CompareJointProfile{});
+    checkStrictWeakOrdering(profiles, std::less<JointProfile>{});
+}
+
+TEST_CASE("Joint profiles are equivalent exactly when their geometry matches", "[profile]") {
+    auto const profiles = jointProfiles();
+    auto const noisy    = profiles.back();
+    auto const compare  = CompareJointProfile{};
+    auto const hash     = std::hash<JointProfile>{};
+
+    // The last profile only differs from the base by floating point noise.
+    CHECK_FALSE(compare(profiles.front(), noisy));
+    CHECK_FALSE(compare(noisy, profiles.front()));
+    CHECK(hash(noisy) == hash(profiles.front()));
+
+    // Every other one is a different joint, whatever order they are added in.
+    auto shuffled = std::vector<JointProfile>(profiles.begin(), profiles.end() - 1);
+    auto const expected = shuffled.size();
+
+    for (auto pass = 0; pass < 3; ++pass) {
+        auto groups = std::map<JointProfile, int, CompareJointProfile>{};
+        for (auto const& profile: shuffled) ++groups[profile];
+        ++groups[noisy];
+
+        CHECK(groups.size() == expected);
+        CHECK(groups.at(profiles.front()) == 2);
+
+        std::reverse(shuffled.begin(), shuffled.end());
+        std::rotate(shuffled.begin(), shuffled.begin() + 5, shuffled.end());
+    }
+}
+
+TEST_CASE("Panel profile comparisons are strict weak orderings", "[profile]") {
+    auto const profiles = std::vector<PanelProfile>{
+        panelProfile(10, 5),
+        panelProfile(12, 5),
+        panelProfile(10, 7),
+        panelProfile(12, 3),
+        panelProfile(8, 7),
+        panelProfile(10 + sum - exact, 5),
+        panelProfile(exact, sum)
+    };
+
+    checkStrictWeakOrdering(profiles, ComparePanelProfile{});
+
+    // Comparing length and width with & made a longer, narrower panel
+    // equivalent to the base one, so the two shared a sketch.
+    auto groups = std::map<PanelProfile, int, ComparePanelProfile>{};
+    for (auto const& profile: profiles) ++groups[profile];
+    CHECK(groups.size() == profiles.size() - 1);
+    CHECK(groups.at(panelProfile(10, 5)) == 2);
+}
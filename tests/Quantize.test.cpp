@@ -0,0 +1,71 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "dialog/systems/detectPanelCollisions.hpp"
+#include "entities/Quantize.hpp"
+#include "render/presentation/rendersupport.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <set>
+
+using namespace silvanus::generatebox::entities;
+using namespace silvanus::generatebox::render;
+
+namespace {
+
+    // 0.1 + 0.2 is 0.30000000000000004 as a double, one of the sums the
+    // dialog makes when a dimension is built up from a thickness and an offset.
+    constexpr auto sum   = 0.1 + 0.2;
+    constexpr auto exact = 0.3;
+
+    auto plane(double min_x, double max_x) -> PanelPlane {
+        return {quantize(min_x), 0, quantize(max_x), quantize(10)};
+    }
+
+    auto planes(AxisFlag orientation, PanelPlane length) -> JointPanelPlanes {
+        auto const all = plane(0, 10);
+        return {entt::null, {"panel", 0, orientation, {}}, {length, all, all}};
+    }
+
+}
+
+TEST_CASE("Lengths that only differ by floating point noise quantize to the same value", "[quantize]") {
+    REQUIRE(sum != exact);
+    CHECK(quantize(sum) == quantize(exact));
+    CHECK(quantize(exact + length_quantum) == quantize(exact) + 1);
+    CHECK(toCentimeters(quantize(exact)) == Approx(exact));
+}
+
+TEST_CASE("Extrusions that only differ by floating point noise are one set entry", "[quantize]") {
+    auto panels = std::set<PanelExtrusion, CompareExtrusion>{};
+    panels.insert(PanelExtrusion{entt::null, {exact, "thickness"}, {exact, ""}, {}});
+    panels.insert(PanelExtrusion{entt::null, {sum, "thickness"}, {sum, ""}, {}});
+    CHECK(panels.size() == 1);
+
+    panels.insert(PanelExtrusion{entt::null, {exact, "thickness"}, {exact + 2 * length_quantum, ""}, {}});
+    CHECK(panels.size() == 2);
+
+    auto joints = std::set<JointExtrusion, CompareExtrusion>{};
+    joints.insert(JointExtrusion{entt::null, {exact, ""}, {sum, ""}, {}});
+    joints.insert(JointExtrusion{entt::null, {sum, ""}, {exact, ""}, {}});
+    CHECK(joints.size() == 1);
+}
+
+TEST_CASE("Panels that touch by a noisy sum still collide", "[quantize]") {
+    // Compared as doubles, a panel ending at 0.3 and one starting at 0.1 + 0.2
+    // missed each other, and the joint between them was dropped.
+    REQUIRE_FALSE(exact >= sum);
+
+    auto const first  = planes(AxisFlag::Length, plane(0, exact));
+    auto const second = planes(AxisFlag::Width, plane(sum, 1));
+
+    auto const collision = detectPanelCollisionsImpl(first, second);
+    CHECK(collision.collision_detected);
+    CHECK(collision.data.panel_offset == Approx(exact));
+
+    auto const apart = planes(AxisFlag::Width, plane(exact + 2 * length_quantum, 1));
+    CHECK_FALSE(detectPanelCollisionsImpl(first, apart).collision_detected);
+}
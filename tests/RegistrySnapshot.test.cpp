@@ -0,0 +1,147 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "BoxFixtures.hpp"
+#include "render/geometry/collectPanelGeometry.hpp"
+#include "render/snapshot/RegistrySnapshot.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::snapshot;
+using namespace silvanus::generatebox::testing;
+
+namespace {
+
+    // A snapshot is read in place, so it is copied into 8 byte aligned storage
+    // like a mapped file would be.
+    auto snapshotOf(const BoxSpecification& specification) -> std::vector<std::uint64_t> {
+        auto registry = entt::registry{};
+        configureBox(specification, registry);
+
+        auto stream = std::ostringstream{};
+        writeSnapshot(registry, stream);
+
+        auto const bytes = stream.str();
+        auto buffer = std::vector<std::uint64_t>((bytes.size() + 7) / 8);
+        std::memcpy(buffer.data(), bytes.data(), bytes.size());
+        return buffer;
+    }
+
+    auto byName(const std::vector<PanelGeometry>& panels) -> std::map<std::string, PanelGeometry> {
+        auto result = std::map<std::string, PanelGeometry>{};
+        for (auto const& panel: panels) result.emplace(panel.name, panel);
+        return result;
+    }
+
+    auto sortedCuts(std::vector<Rectangle> cuts) -> std::vector<Rectangle> {
+        std::sort(cuts.begin(), cuts.end(), [](const Rectangle& lhs, const Rectangle& rhs) {
+            return std::tie(lhs.min_u, lhs.min_v, lhs.max_u, lhs.max_v) < std::tie(rhs.min_u, rhs.min_v, rhs.max_u, rhs.max_v);
+        });
+        return cuts;
+    }
+
+    auto variants() -> std::vector<std::pair<std::string, BoxSpecification>> {
+        auto result = std::vector<std::pair<std::string, BoxSpecification>>{};
+
+        result.emplace_back("open box", BoxSpecification{});
+        result.emplace_back("divided box", makeDividedBox(2, 1));
+
+        auto lap = makeDividedBox(3, 2);
+        lap.length_dividers.first = JointPatternType::LapJoint;
+        lap.width_dividers.second = JointPatternType::Trim;
+        result.emplace_back("lap and trim dividers", lap);
+
+        auto bottomless = makeDividedBox(1, 0);
+        bottomless.bottom.enabled = false;
+        result.emplace_back("top without bottom", bottomless);
+
+        auto thick = makeDividedBox(1, 1);
+        thick.top.thickness = 0.64;
+        thick.kerf          = 0.02;
+        result.emplace_back("thick top with kerf", thick);
+
+        auto upright = makeDividedBox(2, 2);
+        upright.divider_orientations = 1;
+        upright.joint_pattern        = JointPatternType::DoubleTenon;
+        result.emplace_back("upright tenon dividers", upright);
+
+        return result;
+    }
+
+}
+
+TEST_CASE("A loaded snapshot gives the panels of the registry it was taken from", "[snapshot]") {
+    for (auto const& [label, specification]: variants()) {
+        INFO(label);
+
+        auto const buffer   = snapshotOf(specification);
+        auto const view     = SnapshotView(buffer.data(), buffer.size() * sizeof(std::uint64_t));
+        auto const loaded   = byName(snapshotPanelGeometry(view));
+        auto const expected = byName(generateBox(specification));
+
+        REQUIRE(loaded.size() == expected.size());
+
+        for (auto const& [name, panel]: expected) {
+            INFO(name);
+            REQUIRE(loaded.count(name) == 1);
+
+            auto const& copy = loaded.at(name);
+            CHECK(copy.orientation == panel.orientation);
+            CHECK(copy.length == Approx(panel.length));
+            CHECK(copy.width == Approx(panel.width));
+            CHECK(copy.thickness == Approx(panel.thickness));
+            CHECK(copy.offset == Approx(panel.offset));
+            CHECK(copy.kerf == Approx(panel.kerf));
+
+            auto const cuts          = sortedCuts(copy.cuts);
+            auto const expected_cuts = sortedCuts(panel.cuts);
+            REQUIRE(cuts.size() == expected_cuts.size());
+
+            for (size_t i = 0; i < cuts.size(); ++i) {
+                CHECK(cuts[i].min_u == Approx(expected_cuts[i].min_u));
+                CHECK(cuts[i].min_v == Approx(expected_cuts[i].min_v));
+                CHECK(cuts[i].max_u == Approx(expected_cuts[i].max_u));
+                CHECK(cuts[i].max_v == Approx(expected_cuts[i].max_v));
+            }
+        }
+    }
+}
+
+TEST_CASE("A damaged snapshot is refused", "[snapshot]") {
+    auto buffer = snapshotOf(makeDividedBox(1, 1));
+    auto const size = buffer.size() * sizeof(std::uint64_t);
+
+    SECTION("truncated") {
+        CHECK_THROWS_AS(SnapshotView(buffer.data(), size / 2), std::runtime_error);
+    }
+
+    SECTION("wrong magic") {
+        reinterpret_cast<char*>(buffer.data())[0] = 'X';
+        CHECK_THROWS_AS(SnapshotView(buffer.data(), size), std::runtime_error);
+    }
+
+    SECTION("invalid orientation") {
+        auto header = SnapshotHeader{};
+        std::memcpy(&header, buffer.data(), sizeof(header));
+
+        auto panel = SnapshotPanel{};
+        auto const position = reinterpret_cast<char*>(buffer.data()) + header.panel_offset;
+        std::memcpy(&panel, position, sizeof(panel));
+        panel.orientation = 7;
+        std::memcpy(position, &panel, sizeof(panel));
+
+        CHECK_THROWS_AS(SnapshotView(buffer.data(), size), std::runtime_error);
+    }
+}
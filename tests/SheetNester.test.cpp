@@ -0,0 +1,119 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "BoxFixtures.hpp"
+#include "render/nesting/SheetNester.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <map>
+
+using namespace silvanus::generatebox::nesting;
+using namespace silvanus::generatebox::testing;
+
+namespace {
+
+    auto boxParts() -> std::vector<NestingPart> {
+        return nestingParts(makeDividedPanels(3, 2));
+    }
+
+    struct Footprint {
+        double min_x;
+        double min_y;
+        double max_x;
+        double max_y;
+    };
+
+    auto footprint(const NestingPart& part, const NestedPart& placement) -> Footprint {
+        auto const length = placement.rotated ? part.width : part.length;
+        auto const width  = placement.rotated ? part.length : part.width;
+        return {placement.x, placement.y, placement.x + length, placement.y + width};
+    }
+
+}
+
+TEST_CASE("Nesting gives the same layout for the same seed on any number of threads", "[nesting]") {
+    auto const parts = boxParts();
+
+    auto options = NestingOptions{};
+    options.sheet   = {60, 40};
+    options.seeds   = 12;
+    options.threads = 1;
+    auto const single = nest(parts, options);
+
+    for (auto const threads: {size_t{2}, size_t{5}, size_t{0}}) {
+        options.threads = threads;
+        auto const result = nest(parts, options);
+
+        CHECK(result.seed == single.seed);
+        CHECK(result.sheets == single.sheets);
+        CHECK(result.unplaced == single.unplaced);
+        REQUIRE(result.placements.size() == single.placements.size());
+
+        for (size_t i = 0; i < result.placements.size(); ++i) {
+            CHECK(result.placements[i].id == single.placements[i].id);
+            CHECK(result.placements[i].sheet == single.placements[i].sheet);
+            CHECK(result.placements[i].x == single.placements[i].x);
+            CHECK(result.placements[i].y == single.placements[i].y);
+            CHECK(result.placements[i].rotated == single.placements[i].rotated);
+        }
+    }
+}
+
+TEST_CASE("Nested parts stay on their sheet and apart from each other", "[nesting]") {
+    auto const parts = boxParts();
+
+    auto options = NestingOptions{};
+    options.sheet = {45, 30};
+
+    auto const result = nest(parts, options);
+    CHECK(result.unplaced.empty());
+    REQUIRE(result.placements.size() == parts.size());
+    CHECK(result.utilization > 0);
+    CHECK(result.utilization <= 1);
+
+    auto placed = std::map<size_t, Footprint>{};
+    for (auto const& placement: result.placements) {
+        INFO("part " << placement.id);
+        REQUIRE(placement.id < parts.size());
+        REQUIRE(placed.count(placement.id) == 0);
+        CHECK(placement.sheet < result.sheets);
+
+        auto const area = footprint(parts[placement.id], placement);
+        CHECK(area.min_x >= options.margin - 1e-9);
+        CHECK(area.min_y >= options.margin - 1e-9);
+        CHECK(area.max_x <= options.sheet.length - options.margin + 1e-9);
+        CHECK(area.max_y <= options.sheet.width - options.margin + 1e-9);
+
+        for (auto const& other: result.placements) {
+            if (other.id == placement.id || other.sheet != placement.sheet) continue;
+
+            auto const next = footprint(parts[other.id], other);
+            auto const apart = area.max_x + options.spacing <= next.min_x + 1e-9 ||
+                               next.max_x + options.spacing <= area.min_x + 1e-9 ||
+                               area.max_y + options.spacing <= next.min_y + 1e-9 ||
+                               next.max_y + options.spacing <= area.min_y + 1e-9;
+            CHECK(apart);
+        }
+
+        placed[placement.id] = area;
+    }
+}
+
+TEST_CASE("Parts larger than the sheet are reported instead of placed", "[nesting]") {
+    auto options = NestingOptions{};
+    options.sheet = {20, 10};
+
+    auto result = nest({{0, 5, 5, true}, {1, 25, 5, true}, {2, 8, 15, true}, {3, 8, 15, false}}, options);
+    std::sort(result.unplaced.begin(), result.unplaced.end());
+
+    CHECK(result.unplaced == std::vector<size_t>{1, 3});
+    REQUIRE(result.placements.size() == 2);
+
+    for (auto const& placement: result.placements) {
+        if (placement.id == 2) CHECK(placement.rotated);
+    }
+}
@@ -0,0 +1,135 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "BoxFixtures.hpp"
+#include "render/gcode/GCodeWriter.hpp"
+#include "render/gcode/ToolpathPlanner.hpp"
+#include "render/gcode/ToolpathSimulator.hpp"
+#include "render/geometry/PanelOutline.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <sstream>
+
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::gcode;
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::nesting;
+using namespace silvanus::generatebox::testing;
+
+namespace {
+
+    auto boxPanels() -> std::vector<PanelGeometry> {
+        auto specification = BoxSpecification{};
+        specification.width_dividers.first = JointPatternType::LapJoint;
+
+        return makeDividedPanels(3, 2, specification);
+    }
+
+    auto sheets(const std::vector<PanelGeometry>& panels) -> std::vector<SheetToolpath> {
+        auto options = NestingOptions{};
+        options.sheet = {60, 40};
+
+        return collectContours(panels, nest(nestingParts(panels), options));
+    }
+
+    auto distance(const ToolPoint& from, const ToolPoint& to) -> double {
+        return std::hypot(to.x - from.x, to.y - from.y);
+    }
+
+    auto perimeter(const CutContour& contour) -> double {
+        auto length = 0.0;
+        for (size_t i = 0; i < contour.points.size(); ++i) {
+            length += distance(contour.points[i], contour.points[(i + 1) % contour.points.size()]);
+        }
+        return length;
+    }
+
+}
+
+TEST_CASE("Every panel outline is placed on a sheet", "[gcode]") {
+    auto const panels = boxPanels();
+
+    auto expected = 0.0;
+    auto outliner = PanelOutliner{};
+    auto outline  = PanelOutline{};
+    for (auto const& panel: panels) {
+        outliner.build(panel, outline);
+        expected += outlineLength(outline);
+    }
+
+    auto placed = 0.0;
+    for (auto const& toolpath: sheets(panels)) {
+        for (auto const& contour: toolpath.contours) {
+            placed += perimeter(contour);
+        }
+    }
+
+    CHECK(placed == Approx(expected));
+}
+
+TEST_CASE("Inner contours are cut before any outer contour", "[gcode]") {
+    for (auto& toolpath: sheets(boxPanels())) {
+        planToolpath(toolpath);
+        REQUIRE(toolpath.cuts.size() == toolpath.contours.size());
+
+        auto outer = false;
+        for (auto const& cut: toolpath.cuts) {
+            auto const inner = toolpath.contours[cut.contour].inner;
+            if (outer) CHECK_FALSE(inner);
+            outer = outer || !inner;
+        }
+    }
+}
+
+TEST_CASE("2-opt never travels further than the nearest neighbour order", "[gcode]") {
+    for (auto toolpath: sheets(boxPanels())) {
+        auto unordered = toolpath;
+        planToolpath(unordered, {0.1, false, 0});
+
+        auto nearest = toolpath;
+        planToolpath(nearest, {0.1, true, 0});
+
+        auto improved = toolpath;
+        planToolpath(improved, {0.1, true, 50});
+
+        CHECK(nearest.travel <= unordered.travel + 1e-9);
+        CHECK(improved.travel <= nearest.travel + 1e-9);
+    }
+}
+
+TEST_CASE("The simulator measures the cut length that was planned", "[gcode]") {
+    auto options = GCodeOptions{};
+    options.passes = 2;
+
+    auto stream = std::stringstream{};
+    auto writer = GCodeWriter(stream, options);
+
+    auto cuts          = size_t{0};
+    auto cut_length    = 0.0;
+    auto travel_length = 0.0;
+
+    writer.begin();
+    for (auto& toolpath: sheets(boxPanels())) {
+        planToolpath(toolpath);
+        writer.sheet(toolpath);
+
+        for (auto const& cut: toolpath.cuts) {
+            cut_length += distance(cut.lead_in, cut.entry) + options.passes * perimeter(toolpath.contours[cut.contour]);
+        }
+        cuts += toolpath.cuts.size();
+        travel_length += toolpath.travel;
+    }
+    writer.end();
+
+    auto const simulation = simulateGCode(stream);
+
+    CHECK(simulation.unsupported == 0);
+    CHECK(simulation.pierces == cuts);
+    CHECK(simulation.cuts.size() == cuts);
+    CHECK(simulation.cut_length == Approx(cut_length * 10).epsilon(1e-5));
+    CHECK(simulation.travel_length >= travel_length * 10 * (1 - 1e-5));
+}
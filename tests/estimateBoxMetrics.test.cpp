@@ -0,0 +1,79 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "BoxFixtures.hpp"
+#include "batch/BatchGenerator.hpp"
+#include "render/estimate/estimateBoxMetrics.hpp"
+#include "render/geometry/PanelOutline.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::estimate;
+using namespace silvanus::generatebox::geometry;
+using namespace silvanus::generatebox::testing;
+
+TEST_CASE("The estimate matches the traced outlines of divided boxes", "[estimate]") {
+    auto const patterns = {
+        JointPatternType::BoxJoint, JointPatternType::LapJoint, JointPatternType::Trim, JointPatternType::DoubleTenon
+    };
+
+    for (auto const pattern: patterns) {
+        for (auto const dividers: {0, 2}) {
+            for (auto const kerf: {0.0, 0.02}) {
+                auto specification = makeDividedBox(dividers, dividers / 2);
+                specification.joint_pattern          = pattern;
+                specification.kerf                   = kerf;
+                specification.top.enabled            = dividers > 0;
+                specification.length_dividers.first  = pattern;
+                specification.length_dividers.second = JointPatternType::LapJoint;
+                specification.width_dividers.first   = JointPatternType::Trim;
+                specification.width_dividers.second  = pattern;
+                specification.divider_orientations   = dividers > 0 ? 0 : 1;
+
+                INFO("pattern " << static_cast<int>(pattern) << ", " << dividers << " dividers, kerf " << kerf);
+
+                auto outliner      = PanelOutliner{};
+                auto outline       = PanelOutline{};
+                auto cut_length    = 0.0;
+                auto material_area = 0.0;
+                auto sheet_area    = 0.0;
+                auto contours      = size_t{0};
+
+                auto const panels = generateBox(specification);
+                for (auto const& panel: panels) {
+                    outliner.build(panel, outline);
+                    cut_length    += outlineLength(outline);
+                    material_area += outlineArea(outline);
+                    sheet_area    += panel.length * panel.width;
+                    contours      += outline.loops.size();
+                }
+
+                auto const metrics = estimateBox(specification);
+
+                CHECK(metrics.panels == panels.size());
+                CHECK(metrics.contours == contours);
+                CHECK(metrics.cut_length == Approx(cut_length));
+                CHECK(metrics.toolpath_length == Approx(cut_length));
+                CHECK(metrics.material_area == Approx(material_area));
+                CHECK(metrics.sheet_area == Approx(sheet_area));
+            }
+        }
+    }
+}
+
+TEST_CASE("Laser time covers cutting, travel and pierces for every pass", "[estimate]") {
+    auto machine = MachineProfile{};
+    machine.cut_feed    = 1200;
+    machine.rapid_feed  = 12000;
+    machine.pierce_time = 0.25;
+    machine.passes      = 3;
+
+    auto const metrics = estimateBox(BoxSpecification{}, machine);
+
+    auto const expected = 3 * (metrics.toolpath_length * 10 / 1200 * 60 + metrics.travel_length * 10 / 12000 * 60 +
+                               static_cast<double>(metrics.contours) * 0.25);
+    CHECK(metrics.laser_time == Approx(expected));
+}
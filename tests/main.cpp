@@ -3,6 +3,5 @@
 // Copyright (c) 2020 Hobbyist Maker. All rights reserved.
 //
 
-#define CONFIG_CATCH_MAIN
-#include <catch.hpp>
-
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
@@ -0,0 +1,144 @@
+//
+// Created by Hobbyist Maker on 10/19/26.
+// Copyright (c) 2026 Hobbyist Maker. All rights reserved.
+//
+
+#include "batch/ReplayDialog.hpp"
+#include "batch/replayDialogInputs.hpp"
+#include "dialog/presentation/DialogInputLog.hpp"
+#include "entities/JointPattern.hpp"
+#include "entities/Panel.hpp"
+#include "entities/PanelMinPoint.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <fstream>
+#include <sstream>
+
+using namespace silvanus::generatebox::batch;
+using namespace silvanus::generatebox::dialog;
+using namespace silvanus::generatebox::entities;
+
+namespace {
+
+    auto countPatterns(entt::registry& registry, JointPatternType type) -> size_t {
+        auto count = size_t{0};
+        registry.view<const JointPattern>().each([&count, type](auto const& pattern) {
+            count += pattern.value == type;
+        });
+        return count;
+    }
+
+    auto minimumWidth(entt::registry& registry, const std::string& name) -> double {
+        auto width = -1.0;
+        registry.view<const Panel, const PanelMinPoint>().each([&width, &name](auto const& panel, auto const& point) {
+            if (panel.name == name) width = point.width;
+        });
+        return width;
+    }
+
+}
+
+TEST_CASE("The checked in dialog log replays without failures", "[replay]") {
+    auto file = std::ifstream{SILVANUS_TEST_DIR "/dialogInputs.log"};
+    REQUIRE(file);
+
+    auto const report = replayDialogInputs(readDialogInputLogs(file), true);
+
+    CHECK(report.sessions == 2);
+    CHECK(report.events == 55);
+    CHECK(report.ignored == 1);
+    CHECK(report.failed == 0);
+    CHECK(report.total.events == 54);
+}
+
+TEST_CASE("A joint table row only changes its own joints", "[replay]") {
+    auto dialog   = ReplayDialog{true};
+    auto registry = entt::registry{};
+
+    dialog.initializePanels(registry);
+    auto const joints = registry.view<const JointPattern>().size();
+    REQUIRE(joints > 0);
+    REQUIRE(countPatterns(registry, JointPatternType::Trim) == 0);
+
+    REQUIRE(dialog.update("jointRowType3", "6"));
+    dialog.initializePanels(registry);
+    auto const row = countPatterns(registry, JointPatternType::Trim);
+    CHECK(row > 0);
+    CHECK(row < joints);
+
+    REQUIRE(dialog.update("jointRowType4", "6"));
+    dialog.initializePanels(registry);
+    CHECK(countPatterns(registry, JointPatternType::Trim) > row);
+
+    REQUIRE(dialog.update("jointRowType3", "0"));
+    REQUIRE(dialog.update("jointRowType4", "0"));
+    dialog.initializePanels(registry);
+    CHECK(countPatterns(registry, JointPatternType::Trim) == 0);
+}
+
+TEST_CASE("Divider inputs add divider panels to the configuration", "[replay]") {
+    auto dialog   = ReplayDialog{false};
+    auto registry = entt::registry{};
+
+    auto const dividers = [&registry]() {
+        auto count = size_t{0};
+        registry.view<const Panel>().each([&count](auto const& panel) {
+            count += panel.name.find("Divider") != std::string::npos;
+        });
+        return count;
+    };
+
+    dialog.initializePanels(registry);
+    CHECK(dividers() == 0);
+
+    REQUIRE(dialog.update("lengthDividerCommandInput", "2"));
+    dialog.initializePanels(registry);
+    auto const length = dividers();
+    CHECK(length > 0);
+
+    // Length & Height hides the width dividers, so they do not change anything.
+    REQUIRE(dialog.update("dividerOrientationCommandInput", "1"));
+    REQUIRE(dialog.update("widthDividerCommandInput", "3"));
+    dialog.initializePanels(registry);
+    CHECK(dividers() == length);
+}
+
+TEST_CASE("Unknown inputs and unreadable values are not replayed", "[replay]") {
+    auto dialog = ReplayDialog{true};
+
+    CHECK_FALSE(dialog.update("estimateCommandInput", ""));
+    CHECK_FALSE(dialog.update("jointRowType99", "1"));
+    CHECK_FALSE(dialog.update("lengthSpinnerInput", "long"));
+    CHECK(dialog.update("lengthSpinnerInput", "30"));
+}
+
+TEST_CASE("Dialog input logs keep the model orientation", "[replay]") {
+    auto stream = std::stringstream{};
+    writeDialogInputLog({false, ModelOrientation::ZUp, {{1, 2, "lengthSpinnerInput", "30"}}}, stream);
+
+    auto logs = readDialogInputLogs(stream);
+    REQUIRE(logs.size() == 1);
+    CHECK_FALSE(logs[0].is_metric);
+    CHECK(logs[0].orientation == ModelOrientation::ZUp);
+    CHECK(logs[0].events.size() == 1);
+
+    auto older = std::istringstream{"# silvanus dialog inputs 1 imperial\n"};
+    logs = readDialogInputLogs(older);
+    REQUIRE(logs.size() == 1);
+    CHECK(logs[0].orientation == ModelOrientation::YUp);
+}
+
+TEST_CASE("Replays place the front and back panels for the recorded orientation", "[replay]") {
+    auto y_up     = ReplayDialog{true, ModelOrientation::YUp};
+    auto z_up     = ReplayDialog{true, ModelOrientation::ZUp};
+    auto registry = entt::registry{};
+
+    y_up.initializePanels(registry);
+    CHECK(minimumWidth(registry, "Front") > 0);
+    CHECK(minimumWidth(registry, "Back") == 0);
+
+    z_up.initializePanels(registry);
+    CHECK(minimumWidth(registry, "Front") == 0);
+    CHECK(minimumWidth(registry, "Back") > 0);
+}